@@ -0,0 +1,139 @@
+#include "cmd_dispatch.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// 不分大小写比较 text 的前 n 个字符与（大写的）前缀
+static bool prefixMatch(const char* text, size_t len, const char* prefix, size_t n) {
+    if (len < n) return false;
+    for (size_t i = 0; i < n; i++) {
+        if (toupper((unsigned char)text[i]) != prefix[i]) return false;
+    }
+    return true;
+}
+
+const char* cmdResultName(CmdResult r) {
+    switch (r) {
+        case CMD_OK:      return "OK";
+        case CMD_EMPTY:   return "EMPTY";
+        case CMD_UNKNOWN: return "UNKNOWN";
+        case CMD_BAD_ARG: return "BAD_ARG";
+        case CMD_DENIED:  return "DENIED";
+    }
+    return "?";
+}
+
+CmdDispatcher::CmdDispatcher(const CmdEntry* table, uint8_t count) : m_table(table), m_count(count) {
+    memset(m_results, 0, sizeof(m_results));
+}
+
+CmdResult CmdDispatcher::resolve(const char* text, uint8_t source, CmdArgs& args) const {
+    // 去掉首尾空白（只移动指针）
+    const char* begin = text;
+    while (isBlank(*begin)) begin++;
+    const char* end = begin + strlen(begin);
+    while (end > begin && isBlank(end[-1])) end--;
+    size_t len = (size_t)(end - begin);
+    if (len == 0) return CMD_EMPTY;
+
+    // 最长前缀；CMD_ARG_NONE 要求整行相同
+    const CmdEntry* best = nullptr;
+    for (uint8_t k = 0; k < m_count; k++) {
+        const CmdEntry& e = m_table[k];
+        if (best && e.prefixLen <= best->prefixLen) continue;
+        if (e.argType == CMD_ARG_NONE && len != e.prefixLen) continue;
+        if (prefixMatch(begin, len, e.prefix, e.prefixLen)) best = &e;
+    }
+    if (!best) return CMD_UNKNOWN;
+    if (!(best->sources & source)) return CMD_DENIED;
+
+    args.entry = best;
+    args.line = begin;
+    args.lineLen = (uint16_t)len;
+    args.text = begin + best->prefixLen;
+    args.len = (uint16_t)(len - best->prefixLen);
+    args.f = 0.0f;
+    args.i = 0;
+    args.source = source;
+
+    // 数字参数必须恰好占满前缀之后的部分（空则按 0）
+    if (args.len > 0 && (best->argType == CMD_ARG_FLOAT || best->argType == CMD_ARG_INT)) {
+        char* stop = nullptr;
+        if (best->argType == CMD_ARG_FLOAT) args.f = strtof(args.text, &stop);
+        else args.i = strtol(args.text, &stop, 10);
+        if (stop != end) return CMD_BAD_ARG;
+    }
+    return CMD_OK;
+}
+
+CmdResult CmdDispatcher::dispatch(const char* text, uint8_t source) {
+    CmdArgs args;
+    CmdResult r = resolve(text, source, args);
+    if (r == CMD_OK) args.entry->handler(args);
+    m_results[r]++;
+    return r;
+}
+
+void CmdDispatcher::printStats(Print& out) const {
+    out.printf("commands: ok=%lu unknown=%lu bad_arg=%lu denied=%lu (table=%u)\n",
+               (unsigned long)m_results[CMD_OK], (unsigned long)m_results[CMD_UNKNOWN],
+               (unsigned long)m_results[CMD_BAD_ARG], (unsigned long)m_results[CMD_DENIED],
+               (unsigned)m_count);
+}
+
+void cmdBenchmark(Print& out, const CmdDispatcher& dispatcher, const CmdEntry* table, uint8_t count,
+                  uint32_t iterations) {
+    static const char* const samples[] = {
+        "F70", "S", "SV1", "SPEED=40", "TURN=-25", "LINK_TIMEOUT:800", "vive_status",
+        "MP_PARAM:KP=1.5", "CAL_START:1000,2", "KPB2.5", "SEQ_START", "XYZ",
+    };
+    const uint8_t nSamples = sizeof(samples) / sizeof(samples[0]);
+    if (iterations == 0) iterations = 1;
+    volatile float sink = 0.0f;
+
+    // 原写法：每行构造 String，trim + toUpperCase，按表顺序 startsWith/== 先匹配先得，再 substring().toFloat()
+    uint32_t shadowed = 0;
+    uint32_t t0 = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (uint8_t s = 0; s < nSamples; s++) {
+            String cmd(samples[s]);
+            cmd.trim();
+            cmd.toUpperCase();
+            const CmdEntry* hit = nullptr;
+            for (uint8_t k = 0; k < count && !hit; k++) {
+                const CmdEntry& e = table[k];
+                if (e.argType == CMD_ARG_NONE ? cmd == e.prefix : cmd.startsWith(e.prefix)) hit = &e;
+            }
+            if (hit) sink = sink + cmd.substring(hit->prefixLen).toFloat();
+            if (i == 0) {
+                CmdArgs args;
+                bool ok = dispatcher.resolve(samples[s], CMD_SRC_ALL, args) == CMD_OK;
+                if ((ok ? args.entry : nullptr) != hit) shadowed++;
+            }
+        }
+    }
+    uint32_t chainUs = micros() - t0;
+
+    uint32_t t1 = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (uint8_t s = 0; s < nSamples; s++) {
+            CmdArgs args;
+            if (dispatcher.resolve(samples[s], CMD_SRC_ALL, args) == CMD_OK) sink = sink + args.f + args.i;
+        }
+    }
+    uint32_t tableUs = micros() - t1;
+    (void)sink;
+
+    uint32_t total = iterations * nSamples;
+    out.printf("CMD_BENCH %u lines x%lu, table=%u entries\n", (unsigned)nSamples, (unsigned long)iterations,
+               (unsigned)count);
+    out.printf("  String chain: %.2f us/cmd (trim + toUpperCase + startsWith + substring, heap per line)\n",
+               (float)chainUs / total);
+    out.printf("  dispatcher  : %.2f us/cmd (longest prefix on const char*, no heap)\n", (float)tableUs / total);
+    out.printf("  lines the first-match chain routes differently: %lu/%u\n", (unsigned long)shadowed,
+               (unsigned)nSamples);
+}
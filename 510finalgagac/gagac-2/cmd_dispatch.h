@@ -0,0 +1,92 @@
+/*
+ * 文本命令分发：USB 串口、网页 /cmd、Owner 的 ASCII 行共用一张命令表
+ * - 命令表是编译期常量数组：前缀 -> 处理函数 + 参数类型 + 允许的来源
+ * - 按最长前缀匹配（不分大小写），与表中顺序无关，所以 "S" 不会再吃掉 "SV1"/"SPEED=50"，
+ *   "L" 也不会吃掉 "LINK_TIMEOUT:800"
+ * - 直接在调用方的 const char* 上匹配与解析参数，不拷贝、不用 String，不分配堆内存
+ */
+
+#ifndef CMD_DISPATCH_H
+#define CMD_DISPATCH_H
+
+#include <Arduino.h>
+
+enum CmdArgType : uint8_t {
+    CMD_ARG_NONE = 0,  // 整行必须与前缀完全相同（如 "S"、"VIVE_ON"）
+    CMD_ARG_FLOAT,     // 前缀后接一个数（可省略，省略按 0，与原 String::toFloat 一致）
+    CMD_ARG_INT,
+    CMD_ARG_TEXT       // 前缀后原样交给处理函数（可为空）
+};
+
+// 命令来源（位掩码，命令表中标明允许哪些来源）
+#define CMD_SRC_SERIAL  0x01
+#define CMD_SRC_WEB     0x02
+#define CMD_SRC_OWNER   0x04
+#define CMD_SRC_LOCAL   (CMD_SRC_SERIAL | CMD_SRC_WEB)
+#define CMD_SRC_ALL     (CMD_SRC_SERIAL | CMD_SRC_WEB | CMD_SRC_OWNER)
+
+enum CmdResult : uint8_t {
+    CMD_OK = 0,
+    CMD_EMPTY,         // 空行
+    CMD_UNKNOWN,       // 没有匹配的前缀
+    CMD_BAD_ARG,       // 前缀匹配但参数不是数字
+    CMD_DENIED         // 该来源不允许此命令
+};
+
+struct CmdEntry;
+
+// 处理函数拿到的参数；line/text 都指向调用方的缓冲区
+struct CmdArgs {
+    const CmdEntry* entry;
+    const char* line;  // 去掉首尾空白后的整行（lineLen 处不一定是 \0）
+    uint16_t lineLen;
+    const char* text;  // 前缀之后的部分
+    uint16_t len;
+    float f;           // CMD_ARG_FLOAT
+    long i;            // CMD_ARG_INT
+    uint8_t source;
+};
+
+typedef void (*CmdHandler)(const CmdArgs& args);
+
+struct CmdEntry {
+    const char* prefix;   // 大写
+    uint8_t prefixLen;
+    uint8_t argType;      // CmdArgType
+    uint8_t sources;      // CMD_SRC_*
+    CmdHandler handler;
+    const void* target;   // 处理函数可选的附加参数（如要修改的参数名）
+};
+
+#define CMD_ENTRY(prefix, argType, sources, handler) \
+    { prefix, sizeof(prefix) - 1, argType, sources, handler, nullptr }
+#define CMD_ENTRY_ARG(prefix, argType, sources, handler, target) \
+    { prefix, sizeof(prefix) - 1, argType, sources, handler, (const void*)(target) }
+
+class CmdDispatcher {
+private:
+    const CmdEntry* m_table;
+    uint8_t m_count;
+
+    uint32_t m_results[CMD_DENIED + 1];
+
+public:
+    CmdDispatcher(const CmdEntry* table, uint8_t count);
+
+    // 只匹配与解析、不执行；text 须以 \0 结尾（尾部空白可有可无）
+    CmdResult resolve(const char* text, uint8_t source, CmdArgs& args) const;
+    // 匹配并调用处理函数
+    CmdResult dispatch(const char* text, uint8_t source);
+
+    uint32_t getCount(CmdResult r) const { return m_results[r]; }
+    void printStats(Print& out) const;
+};
+
+const char* cmdResultName(CmdResult r);
+
+// 板上基准测试：同一组命令行，原 String 比较链（trim + toUpperCase + startsWith，按表顺序先匹配先得）
+// 与本分发器的匹配+参数解析耗时，并统计两者选中的命令不同的行数（先匹配先得的遮挡问题）
+void cmdBenchmark(Print& out, const CmdDispatcher& dispatcher, const CmdEntry* table, uint8_t count,
+                  uint32_t iterations);
+
+#endif // CMD_DISPATCH_H
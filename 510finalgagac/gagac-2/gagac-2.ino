@@ -3,14 +3,32 @@
 // 主控（Servant）程序：负责电机驱动、编码器测速、VIVE 追踪、Wi-Fi 网页控制，以及与 Owner 板的 UART 通信
 #include <WiFi.h>
 #include <WebServer.h>
+#include <WebSocketsServer.h>
+#include <WiFiUdp.h>
 #include <HardwareSerial.h>
-#include "gagac-web.h"
+#include "gagac-web.gz.h"   // 由 tools/build_web_assets.py 从 gagac-web.h 生成
 #include "vive_tracker.h"
 #include "vive_utils.h"
+#include "slip_estimator.h"
+#include "odometry.h"
+#include "motor_pid.h"
+#include "link_proto.h"
+#include "cmd_dispatch.h"
+#include "servant_commands.h"
+#include "param_registry.h"
+#include "param_store.h"
+#include "web_bridge.h"
+#include "loop_stats.h"
+#include "json_writer.h"
+#include "pose_history.h"
+#include "teleop.h"
+#include "scope_capture.h"
 //TOPHAT
 #include <Wire.h>  // I2C
 //Fighting
 #include <ESP32Servo.h> 
+//标定参数持久化
+#include <Preferences.h>
 
 #define TOPHAT_ADDR 0x28
 #define PIN_I2C_SDA 15  // GPIO 15
@@ -31,6 +49,16 @@ byte wifiPacketCount = 0; // 数WiFi packet
 
 //UART from owner board
 HardwareSerial OwnerSerial(1);   // use UART1，RX/TX pin
+LinkPort ownerLink;              // 与 Owner 之间的二进制消息层（ASCII 行仍然兼容）
+LinkReceiver ownerRx(OwnerSerial, ownerLink);  // UART 事件任务中拼帧，主循环从队列取
+LinkPort consoleLink;            // USB 串口监视器的行拼接（只用文本部分）
+LinkSupervisor ownerSup;         // Owner 心跳：超时则停车，统计 RTT/丢包
+bool motionFromOwner = false;    // 当前目标速度是否由 Owner 下发（只对这种情况做掉线停车）
+bool motionFromTeleop = false;   // 当前目标速度是否来自连续遥控（只对这种情况做静默停车）
+TeleopChannel teleop;            // 网页 WebSocket 二进制帧与 UDP 遥控包，主循环只执行最新一包
+uint32_t motionLatencyUs = 0;    // 最近一条 Owner 运动命令从决策到生效的时间（需时钟同步）
+bool ownerAutoOn = false;        // 最近发给 Owner 的模式（网页遥测显示用）
+bool ownerPlannerOn = false;
 
 // 车体左右电机驱动引脚（接双路驱动器）
 #define MOTOR_L_PWM   9
@@ -66,14 +94,11 @@ const char* AP_SSID = "ESP32-MobileBase";
 const char* AP_PASSWORD = "12345678"; 
 
 // PID parameters base (set)
-float Kp_base = 2.55;
-float Ki_base = 0.7;
-float Kd_base = 0.0;
-
-// dynamic PID parameter
-float Kp = 2.5;
-float Ki = 0.7;
-float Kd = 0.0;
+// 按 tools/pid_sim 的要求整定：25..60 RPM、0.5~1.5 倍负载、11.1~12.6 V 下阶跃 1 s 内稳定、
+// 稳态误差 ≤ 1.5 RPM；测速窗口 100 ms，Ki 小了积分追不上前馈误差，Kp 大了被测速延迟推成振荡
+float Kp_base = 0.25;
+float Ki_base = 21.0;
+float Kd_base = 0.1;
 
 //前馈控制参数
 float feedforwardA = 11.0;   // 线性系数：PWM = A * 转速 + B
@@ -89,6 +114,10 @@ bool useFeedforward = true;  // 是否启用前馈控制
 #define GEAR_RATIO        46.8
 #define PULSES_PER_REV    (ENCODER_PPR * GEAR_RATIO * 2)
 
+//Wheel geometry（标称值，实际值由 UMBmark 标定后存入 NVS）
+#define WHEEL_DIAMETER_MM 65.0
+#define TRACK_WIDTH_MM    150.0
+
 //Moto parameter
 #define MOTOR_MAX_RPM_NO_LOAD    130
 #define MOTOR_MAX_RPM_RATED      100
@@ -96,6 +125,48 @@ bool useFeedforward = true;  // 是否启用前馈控制
 // PWM deadzone
 int deadZonePWM = 400;
 
+// 打滑时 PWM 每个控制周期最大变化量（牵引力控制）
+int slipPwmSlew = 12;
+
+// 网页 WebSocket 遥测推送频率 (Hz)
+uint8_t wsTelemetryHz = 20;
+
+// 连续遥控静默超时 (ms)：发送端 50 Hz，约 12 包收不到就停车
+uint16_t teleopTimeoutMs = 250;
+
+// VIVE 坐标单位换算 (mm/单位)。VIVE 给的是扫描计时单位（场地内约 1000-8000），不是 mm；
+// 0 = 未标定：打滑检测和 UMBmark 标定都不用 VIVE。标定见 VIVE_MARK / VIVE_SCALE:，PSAVE 保存
+float viveMmPerUnit = 0.0f;
+
+// 本板可调参数表：KPB/FFA/SLEW 等串口命令、网页 PARAM: 滑块都经由 servantParams 修改，
+// 新值在下一个控制周期开头一次性生效（控制器不会用到改了一半的 Kp/Ki）
+constexpr ParamDesc SERVANT_PARAMS[] = {
+    PARAM_ENTRY(0, Kp_base,        PARAM_FLOAT, PARAM_GROUP_MOTOR, 0.0f, 20.0f, 0.05f),
+    PARAM_ENTRY(1, Ki_base,        PARAM_FLOAT, PARAM_GROUP_MOTOR, 0.0f, 50.0f, 0.05f),
+    PARAM_ENTRY(2, Kd_base,        PARAM_FLOAT, PARAM_GROUP_MOTOR, 0.0f, 5.0f, 0.01f),
+    PARAM_ENTRY(3, feedforwardA,   PARAM_FLOAT, PARAM_GROUP_MOTOR, 0.0f, 30.0f, 0.1f),
+    PARAM_ENTRY(4, feedforwardB,   PARAM_FLOAT, PARAM_GROUP_MOTOR, 0.0f, 600.0f, 5.0f),
+    PARAM_ENTRY(5, useFeedforward, PARAM_BOOL,  PARAM_GROUP_MOTOR, 0.0f, 1.0f, 1.0f),
+    PARAM_ENTRY(6, deadZonePWM,    PARAM_INT,   PARAM_GROUP_MOTOR, 0.0f, 1000.0f, 10.0f),
+    PARAM_ENTRY(7, slipPwmSlew,    PARAM_INT,   PARAM_GROUP_MOTOR, 1.0f, 200.0f, 1.0f),
+    PARAM_ENTRY(8, wsTelemetryHz,  PARAM_U8,    PARAM_GROUP_WEB,   10.0f, 50.0f, 5.0f),
+    PARAM_ENTRY(9, teleopTimeoutMs, PARAM_U16,  PARAM_GROUP_WEB,   60.0f, 2000.0f, 10.0f),
+    PARAM_ENTRY(10, viveMmPerUnit, PARAM_FLOAT, PARAM_GROUP_VIVE,  0.0f, 5.0f, 0.001f),
+};
+const uint8_t SERVANT_PARAM_COUNT = sizeof(SERVANT_PARAMS) / sizeof(SERVANT_PARAMS[0]);
+static_assert(paramIdsDense(SERVANT_PARAMS, SERVANT_PARAM_COUNT), "param id must equal its table index");
+ParamRegistry servantParams(SERVANT_PARAMS, SERVANT_PARAM_COUNT);
+// 参数配置持久化（附加段存 SEQ 序列），开机恢复上次使用的配置
+ParamStore servantStore(servantParams);
+
+// Owner 参数表的本地镜像（LINK_PARAM_DESC 填充），只用来给网页生成滑块
+// 主循环写、网页任务读，读写都在 ownerParamMux 内
+LinkParamDesc ownerParamDesc[PARAM_MAX_ENTRIES];
+uint8_t ownerParamCount = 0;     // Owner 报告的表长
+uint64_t ownerParamSeen = 0;     // 已收到的项（按位）
+portMUX_TYPE ownerParamMux = portMUX_INITIALIZER_UNLOCKED;
+volatile bool webWantsOwnerParams = false;   // 网页要参数表而镜像不全：主循环代发 PARAM_LIST
+
 //Globals
 volatile long encoderCountL = 0;
 volatile long encoderCountR = 0;
@@ -104,20 +175,24 @@ float speedL = 0.0;
 float speedR = 0.0;
 
 float targetSpeedL = 0.0;
-float errorL = 0.0;
-float lastErrorL = 0.0;
-float integralL = 0.0;
 int pwmOutputL = 0;
 
 float targetSpeedR = 0.0;
-float errorR = 0.0;
-float lastErrorR = 0.0;
-float integralR = 0.0;
 int pwmOutputR = 0;
 
+// 左右轮控制器状态（误差/积分/本周期调度后的增益），算法见 motor_pid.cpp
+MotorPidState pidStateL = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+MotorPidState pidStateR = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
 hw_timer_t *controlTimer = NULL;
 volatile bool controlFlag = false;
 
+// 主循环周期分布；超过一个控制周期即有 PID 输出被推迟
+LoopStats loopStats(CONTROL_PERIOD_MS * 1000);
+
+// 控制信号示波器：布防后每个控制周期记一条（网页 /scope，串口 SCOPE_ARM:）
+ScopeCapture scope(CONTROL_PERIOD_MS);
+
 // ======= 简单序列执行（直行/转向按时间顺序执行，纯网页控制用） =======
 struct SeqStep {
     char mode;         // 'F','B','L','R'
@@ -199,6 +274,36 @@ void seqProcess() {
     }
 }
 
+// SEQ 序列随参数配置一起保存：[步数][模式 1B, 值 f32, 时长 u32] × 步数
+uint16_t seqExport(uint8_t* buf, uint16_t cap) {
+    const uint16_t stepLen = 1 + sizeof(float) + sizeof(uint32_t);
+    uint16_t n = 0;
+    buf[n++] = 0;
+    for (uint8_t i = 0; i < seqCount && n + stepLen <= cap; i++) {
+        buf[n++] = (uint8_t)seqSteps[i].mode;
+        memcpy(buf + n, &seqSteps[i].value, sizeof(float));
+        n += sizeof(float);
+        memcpy(buf + n, &seqSteps[i].duration, sizeof(uint32_t));
+        n += sizeof(uint32_t);
+        buf[0]++;
+    }
+    return n;
+}
+
+void seqImport(const uint8_t* buf, uint16_t len) {
+    const uint16_t stepLen = 1 + sizeof(float) + sizeof(uint32_t);
+    if (len < 1 || len != 1 + buf[0] * stepLen || buf[0] > SEQ_MAX) return;
+    if (seqActive) seqStop();
+    seqCount = buf[0];
+    const uint8_t* p = buf + 1;
+    for (uint8_t i = 0; i < seqCount; i++, p += stepLen) {
+        seqSteps[i].mode = (char)p[0];
+        memcpy(&seqSteps[i].value, p + 1, sizeof(float));
+        memcpy(&seqSteps[i].duration, p + 1 + sizeof(float), sizeof(uint32_t));
+    }
+    seqIndex = 0;
+}
+
 //VIVE 默认开启（便于直接读坐标）
 bool isViveActive = true;
 bool isViveTestMode = false;  // 测试模式：输出详细坐标数据
@@ -214,6 +319,16 @@ uint16_t viveXFront = 0, viveYFront = 0;
 uint16_t viveXBack = 0, viveYBack = 0;
 float viveX = 0.0, viveY = 0.0;
 float viveAngle = 0.0;
+uint32_t viveStampUs = 0;   // 本次坐标的计算时刻（micros），随位姿发给 Owner
+
+// 打滑检测（编码器 vs VIVE）
+SlipEstimator slipEstimator;
+
+// 里程计（当前生效的几何参数 + 航迹推算位姿）与 UMBmark 标定
+OdomGeometry odomGeom = {WHEEL_DIAMETER_MM, WHEEL_DIAMETER_MM, TRACK_WIDTH_MM};
+OdomPose odomPose = {0.0, 0.0, 0.0};
+OdomCalibrator odomCal;
+Preferences odomPrefs;
 
 //interrupts
 // 左轮编码器 A 相上升沿中断：根据 B 相判断计数方向
@@ -274,8 +389,10 @@ void stopMotors() {
     setMotorR(0);
     targetSpeedL = 0;
     targetSpeedR = 0;
-    integralL = 0;
-    integralR = 0;
+    motionFromOwner = false;
+    motionFromTeleop = false;
+    pidStateL.integral = 0;
+    pidStateR.integral = 0;
 }
 
 // speed calculate
@@ -291,114 +408,203 @@ void calculateSpeed() {
         long deltaCountR = encoderCountR - lastEncoderCountR;
         speedR = (float)deltaCountR / PULSES_PER_REV * 60000.0 / (float)deltaTime;
         
+        odomIntegrate(odomPose, deltaCountL, deltaCountR, odomGeom, PULSES_PER_REV);
+        
         lastEncoderCountL = encoderCountL;
         lastEncoderCountR = encoderCountR;
         lastSpeedCalcTime = currentTime;
     }
 }
 
-//updated PID function
-// 左轮 PID + 前馈控制，动态调整 Kp/Ki
-int pidControlL() {
-    float speedRatio = abs(targetSpeedL) / 45.0;  
-    
-    if (speedRatio > 1.5) {
-        Kp = Kp_base * 1.3;
-        Ki = Ki_base * 1.2;
-    } else if (speedRatio < 0.5) {
-        Kp = Kp_base * 0.8;
-        Ki = Ki_base * 0.9;
-    } else {
-        Kp = Kp_base;
-        Ki = Ki_base;
+// RPM -> 轮缘线速度 (mm/s)
+float rpmToMmPerSec(float rpm, float wheelDiam) {
+    return rpm * PI * wheelDiam / 60.0;
+}
+
+// 打滑时限制 PWM 斜率：只限制加速方向，减速/停车立即生效
+// 起步时从死区边缘开始爬升，避免在死区内空耗
+int slewLimitPWM(int target, int last, int maxStep) {
+    if (target == 0) return 0;
+    if (abs(target) <= abs(last) && (target > 0) == (last > 0)) return target;
+    if (abs(last) < deadZonePWM || (target > 0) != (last > 0)) {
+        last = (target > 0) ? deadZonePWM : -deadZonePWM;
     }
-    
-    errorL = targetSpeedL - speedL;
-    
-    integralL += errorL * (CONTROL_PERIOD_MS / 1000.0);
-    float integralLimit = PWM_MAX / (Ki + 0.001);
-    integralL = constrain(integralL, -integralLimit, integralLimit);
-    
-    float derivative = (errorL - lastErrorL) / (CONTROL_PERIOD_MS / 1000.0);
-    lastErrorL = errorL;
-    
-    float output;
-    
-    if (useFeedforward && targetSpeedL != 0) {
-        float feedforward = feedforwardA * abs(targetSpeedL) + feedforwardB;
-        if (targetSpeedL < 0) feedforward = -feedforward;
-        
-        float feedback = Kp * errorL + Ki * integralL + Kd * derivative;
-        output = feedforward + feedback;
-    } else {
-        output = Kp * errorL + Ki * integralL + Kd * derivative;
+    return constrain(target, last - maxStep, last + maxStep);
+}
+
+// 两个跟踪器都在接收且坐标有效
+bool viveFixValid() {
+    return isViveActive &&
+           viveFront.getStatus() == VIVE_STATUS_RECEIVING &&
+           viveBack.getStatus() == VIVE_STATUS_RECEIVING &&
+           viveX > 0 && viveY > 0;
+}
+
+// 当前 VIVE 坐标换算成 mm；比例未标定时返回 false
+bool viveToMm(float& xMm, float& yMm) {
+    if (viveMmPerUnit <= 0.0f) return false;
+    xMm = viveX * viveMmPerUnit;
+    yMm = viveY * viveMmPerUnit;
+    return true;
+}
+
+// 打滑检测：每次 loop 调用，事件结束时打印一条带时间戳的日志
+// 编码器车体速度用当前（标定后存入 NVS 的）轮径换算，VIVE 先换算成 mm 再差分
+void updateSlip() {
+    unsigned long now = millis();
+    float xMm = 0.0f, yMm = 0.0f;
+    bool viveValid = viveFixValid() && viveToMm(xMm, yMm);
+    float encSpeed = (rpmToMmPerSec(speedL, odomGeom.wheelDiamL) +
+                      rpmToMmPerSec(speedR, odomGeom.wheelDiamR)) / 2.0;
+    bool wasSlipping = slipEstimator.isSlipping();
+
+    if (slipEstimator.update(now, encSpeed, xMm, yMm, viveValid)) {
+        const SlipEvent& ev = slipEstimator.getLastEvent();
+        Serial.printf("[SLIP] t=%lu ms dur=%lu ms peak=%.2f enc=%.0f mm/s vive=%.0f mm/s\n",
+                      (unsigned long)ev.startMs, (unsigned long)ev.durationMs,
+                      ev.peakRatio, ev.encSpeed, ev.viveSpeed);
+    } else if (!wasSlipping && slipEstimator.isSlipping()) {
+        Serial.printf("[SLIP] start t=%lu ms ratio=%.2f PWM L=%d R=%d -> slew cap %d/tick\n",
+                      now, slipEstimator.getRatio(), pwmOutputL, pwmOutputR, slipPwmSlew);
     }
-    
-    output = constrain(output, -PWM_MAX, PWM_MAX);
-    
-    if (targetSpeedL == 0) {
-        output = 0;
-        integralL = 0;
-    } else {
-        if (output > 0 && output < deadZonePWM) {
-            output = deadZonePWM;
-        } else if (output < 0 && output > -deadZonePWM) {
-            output = -deadZonePWM;
-        }
+}
+
+void printSlipLog() {
+    Serial.printf("打滑事件: 共 %lu 次，最近 %d 条 (ratio 进入=%.2f 退出=%.2f, slew=%d)\n",
+                  (unsigned long)slipEstimator.getTotalEvents(), slipEstimator.getEventCount(),
+                  SLIP_RATIO_ENTER, SLIP_RATIO_EXIT, slipPwmSlew);
+    if (viveMmPerUnit <= 0.0f) Serial.println("  VIVE 比例未标定 (viveMmPerUnit=0)，打滑检测未启用");
+    for (uint8_t i = 0; i < slipEstimator.getEventCount(); i++) {
+        const SlipEvent& ev = slipEstimator.getEvent(i);
+        Serial.printf("  #%d t=%lu ms dur=%lu ms peak=%.2f enc=%.0f vive=%.0f\n",
+                      i, (unsigned long)ev.startMs, (unsigned long)ev.durationMs,
+                      ev.peakRatio, ev.encSpeed, ev.viveSpeed);
     }
-    
-    return (int)output;
 }
 
-int pidControlR() {
-    float speedRatio = abs(targetSpeedR) / 45.0;
-    
-    if (speedRatio > 1.5) {
-        Kp = Kp_base * 1.3;
-        Ki = Ki_base * 1.2;
-    } else if (speedRatio < 0.5) {
-        Kp = Kp_base * 0.8;
-        Ki = Ki_base * 0.9;
-    } else {
-        Kp = Kp_base;
-        Ki = Ki_base;
+// 里程计几何参数：上电从 NVS 读取（没有则用标称值）
+void loadOdomGeometry() {
+    odomPrefs.begin("odom", true);
+    odomGeom.wheelDiamL = odomPrefs.getFloat("dL", WHEEL_DIAMETER_MM);
+    odomGeom.wheelDiamR = odomPrefs.getFloat("dR", WHEEL_DIAMETER_MM);
+    odomGeom.trackWidth = odomPrefs.getFloat("b", TRACK_WIDTH_MM);
+    odomPrefs.end();
+}
+
+void saveOdomGeometry() {
+    odomPrefs.begin("odom", false);
+    odomPrefs.putFloat("dL", odomGeom.wheelDiamL);
+    odomPrefs.putFloat("dR", odomGeom.wheelDiamR);
+    odomPrefs.putFloat("b", odomGeom.trackWidth);
+    odomPrefs.end();
+}
+
+void printOdomGeometry(const char* tag, const OdomGeometry& g) {
+    Serial.printf("%s: D_L=%.2f mm, D_R=%.2f mm, b=%.1f mm\n",
+                  tag, g.wheelDiamL, g.wheelDiamR, g.trackWidth);
+}
+
+// UMBmark 标定：每次 loop 调用，标定期间接管左右轮目标转速
+void processOdomCal() {
+    if (!odomCal.isActive()) return;
+
+    // 标定按 mm 解算：VIVE 坐标先乘 viveMmPerUnit
+    float xMm = 0.0f, yMm = 0.0f;
+    bool viveValid = viveFixValid() && viveToMm(xMm, yMm);
+    float tL, tR;
+    odomCal.step(millis(), encoderCountL, encoderCountR, xMm, yMm, viveValid, tL, tR);
+    targetSpeedL = tL;
+    targetSpeedR = tR;
+    if (odomCal.isActive()) return;
+
+    // 标定刚结束：闭合误差确实变小才采用并写入 NVS
+    stopMotors();
+    const OdomCalResult& r = odomCal.getResult();
+    if (!r.solved) {
+        Serial.printf("[CAL] failed: %s\n", odomCal.getError());
+        return;
     }
-    
-    errorR = targetSpeedR - speedR;
-    
-    integralR += errorR * (CONTROL_PERIOD_MS / 1000.0);
-    float integralLimit = PWM_MAX / (Ki + 0.001);
-    integralR = constrain(integralR, -integralLimit, integralLimit);
-    
-    float derivative = (errorR - lastErrorR) / (CONTROL_PERIOD_MS / 1000.0);
-    lastErrorR = errorR;
-    
-    float output;
-    
-    if (useFeedforward && targetSpeedR != 0) {
-        float feedforward = feedforwardA * abs(targetSpeedR) + feedforwardB;
-        if (targetSpeedR < 0) feedforward = -feedforward;
-        
-        float feedback = Kp * errorR + Ki * integralR + Kd * derivative;
-        output = feedforward + feedback;
+    Serial.printf("[CAL] alpha=%.2f° beta=%.2f° Ed=%.4f Eb=%.4f scale=%.4f\n",
+                  r.alphaDeg, r.betaDeg, r.ed, r.eb, r.scale);
+    Serial.printf("[CAL] closure error (%s): before=%.1f mm, after=%.1f mm\n",
+                  r.heldOut ? "held-out runs" : "in-sample, use >= 2 runs/dir to validate",
+                  r.closureBefore, r.closureAfter);
+    printOdomGeometry("[CAL] before", r.before);
+    printOdomGeometry("[CAL] after ", r.after);
+    if (!r.valid) {
+        Serial.printf("[CAL] not applied: %s (scale %.1f-%.1f, Ed/Eb %.1f-%.1f)\n", odomCal.getError(),
+                      CAL_SCALE_MIN, CAL_SCALE_MAX, CAL_RATIO_MIN, CAL_RATIO_MAX);
+        return;
+    }
+    if (r.closureAfter < r.closureBefore) {
+        odomGeom = r.after;
+        saveOdomGeometry();
+        Serial.println("[CAL] applied and saved");
     } else {
-        output = Kp * errorR + Ki * integralR + Kd * derivative;
+        Serial.println("[CAL] not applied (no improvement)");
     }
-    
-    output = constrain(output, -PWM_MAX, PWM_MAX);
-    
-    if (targetSpeedR == 0) {
-        output = 0;
-        integralR = 0;
+}
+
+// 标定相关命令：CAL_START[:边长mm[,每方向圈数]]、CAL_STOP、CAL_RESET、ODOM_RESET
+void cmdCalStart(const CmdArgs& a) {
+    float side = CAL_DEFAULT_SIDE_MM;
+    int runs = 1;
+    if (a.len > 0 && a.text[0] == ':') {
+        char* p = nullptr;
+        side = strtof(a.text + 1, &p);
+        if (*p == ',') runs = (int)strtol(p + 1, nullptr, 10);
+    }
+    if (viveMmPerUnit <= 0.0f) {
+        Serial.println("[CAL] VIVE scale not calibrated (VIVE_MARK / VIVE_SCALE:<mm> first)");
+        return;
+    }
+    seqStop();
+    if (odomCal.start(side, runs, odomGeom, PULSES_PER_REV)) {
+        Serial.printf("[CAL] UMBmark start: side=%.0f mm, runs/dir=%d\n", side, runs);
     } else {
-        if (output > 0 && output < deadZonePWM) {
-            output = deadZonePWM;
-        } else if (output < 0 && output > -deadZonePWM) {
-            output = -deadZonePWM;
-        }
+        Serial.println("[CAL] bad args (side >= 200 mm, runs >= 1)");
     }
-    
-    return (int)output;
+}
+
+void cmdCalStop(const CmdArgs&) {
+    odomCal.stop();
+    stopMotors();
+    Serial.println("[CAL] stopped");
+}
+
+void cmdCalReset(const CmdArgs&) {
+    odomGeom = OdomGeometry{WHEEL_DIAMETER_MM, WHEEL_DIAMETER_MM, TRACK_WIDTH_MM};
+    saveOdomGeometry();
+    printOdomGeometry("[CAL] reset to nominal", odomGeom);
+}
+
+void cmdOdomReset(const CmdArgs&) {
+    odomPose = OdomPose{0.0, 0.0, 0.0};
+}
+
+//updated PID function
+// 用当前可调全局量组装控制器参数（参数随时可能被串口/网页修改）
+MotorPidConfig currentPidConfig() {
+    MotorPidConfig cfg;
+    cfg.kpBase = Kp_base;
+    cfg.kiBase = Ki_base;
+    cfg.kdBase = Kd_base;
+    cfg.ffA = feedforwardA;
+    cfg.ffB = feedforwardB;
+    cfg.useFeedforward = useFeedforward;
+    cfg.deadZonePWM = deadZonePWM;
+    cfg.pwmMax = PWM_MAX;
+    cfg.dtSec = CONTROL_PERIOD_MS / 1000.0;
+    return cfg;
+}
+
+// 左轮 PID + 前馈控制，动态调整 Kp/Ki
+int pidControlL() {
+    return motorPidStep(pidStateL, currentPidConfig(), targetSpeedL, speedL);
+}
+
+int pidControlR() {
+    return motorPidStep(pidStateR, currentPidConfig(), targetSpeedR, speedR);
 }
 
 //set car speed &turn
@@ -409,6 +615,8 @@ void setCarSpeed(float speedPercent) {
     
     targetSpeedL = 0.999* targetRPM; //给左轮 - 一点
     targetSpeedR = targetRPM;
+    motionFromOwner = false;  // Owner 的运动命令由 handleOwnerMessage() 重新置位
+    motionFromTeleop = false;
 }
 
 void setCarTurn(float speedPercent, float turnRate) {
@@ -419,6 +627,24 @@ void setCarTurn(float speedPercent, float turnRate) {
     float turnFactor = turnRate / 100.0;
     targetSpeedL = baseSpeed * (1.0 + turnFactor);  // 
     targetSpeedR = baseSpeed * (1.0 - turnFactor); ///
+    motionFromOwner = false;
+    motionFromTeleop = false;
+}
+
+// 连续遥控：线速度 + 角速度（均为 %，角速度为正时右转），差速叠加；原地转向时 linear = 0
+// 左右轮都按最大转速限幅，推满斜向时保持两轮比例不变（转弯半径不被限幅改掉）
+void setCarTwist(float linearPercent, float angularPercent) {
+    float maxRPM = MOTOR_MAX_RPM_RATED * 0.9;
+    float l = linearPercent + angularPercent;
+    float r = linearPercent - angularPercent;
+    float m = max(fabsf(l), fabsf(r));
+    if (m > 100.0f) {
+        l *= 100.0f / m;
+        r *= 100.0f / m;
+    }
+    targetSpeedL = maxRPM * l / 100.0;
+    targetSpeedR = maxRPM * r / 100.0;
+    motionFromOwner = false;
 }
 
 //test hardware
@@ -473,74 +699,740 @@ void testHardware() {
 
 
 
-void handleCommand(String cmd) {
-    cmd.trim();
-    cmd.toUpperCase();
+// 运动命令（来自 Owner 的二进制帧，或文本命令 F/B/L/R/S）
+void applyMotion(char mode, float value) {
+    switch (mode) {
+        case 'F': setCarSpeed(value); break;
+        case 'B': setCarSpeed(-value); break;
+        case 'L': setCarTurn(50, -value); break;
+        case 'R': setCarTurn(50, value); break;
+        case 'S': stopMotors(); break;
+    }
+}
 
-    // 只有在调试时才解开下面这一行，平时comment掉
-    // Serial.println(cmd); 
+bool ownerParamsComplete() {
+    portENTER_CRITICAL(&ownerParamMux);
+    uint8_t count = ownerParamCount;
+    uint64_t seen = ownerParamSeen;
+    portEXIT_CRITICAL(&ownerParamMux);
+    if (count == 0) return false;
+    uint64_t all = (count >= 64) ? ~0ULL : ((1ULL << count) - 1);
+    return (seen & all) == all;
+}
 
-    // keyboard control
-    if (cmd.startsWith("F")) {
-        float speed = cmd.substring(1).toFloat();
-        setCarSpeed(speed);
+// 参数以二进制 PARAM 帧转发给 Owner（target: 镜像中的分组，未知时按 'W' 巡墙），同时更新镜像中的值
+// 镜像由网页任务同时读取：表长、已收位图与每一项都在 ownerParamMux 内读写（逐项加锁，临界区只是一次比较）
+void forwardParamToOwner(const char* name, float value) {
+    char target = LINK_PARAM_WALL;
+    bool found = false;
+    for (uint8_t i = 0; i < PARAM_MAX_ENTRIES && !found; i++) {
+        portENTER_CRITICAL(&ownerParamMux);
+        bool end = i >= ownerParamCount;
+        LinkParamDesc& d = ownerParamDesc[i];
+        if (!end && (ownerParamSeen >> i & 1) && strcasecmp(d.name, name) == 0) {
+            target = d.group;
+            d.value = constrain(value, d.minVal, d.maxVal);
+            found = true;
+        }
+        portEXIT_CRITICAL(&ownerParamMux);
+        if (end) break;
     }
-    else if (cmd.startsWith("B")) {
-        float speed = cmd.substring(1).toFloat();
-        setCarSpeed(-speed);
+    ownerLink.sendParam(OwnerSerial, target, name, value);
+}
+
+// Owner 发来的二进制消息（rxUs 为拼帧完成时刻）
+void handleOwnerMessage(const LinkMessage& msg, uint32_t rxUs) {
+    switch (msg.type) {
+        case LINK_MOTION:
+            applyMotion(msg.motion.mode, msg.motion.value);
+            motionFromOwner = (msg.motion.mode != 'S');
+            if (ownerSup.clock().isValid()) {
+                motionLatencyUs = micros() - ownerSup.clock().remoteToLocal(msg.motion.stampUs);
+            }
+            break;
+        case LINK_HEARTBEAT:
+            ownerSup.onHeartbeat(msg, rxUs, millis());
+            break;
+        case LINK_PARAM_DESC: {
+            const LinkParamDesc& d = msg.paramDesc;
+            if (d.index < PARAM_MAX_ENTRIES) {
+                portENTER_CRITICAL(&ownerParamMux);
+                if (d.count != ownerParamCount) ownerParamSeen = 0;  // Owner 换了固件/参数表
+                ownerParamCount = min<uint8_t>(d.count, PARAM_MAX_ENTRIES);
+                ownerParamDesc[d.index] = d;
+                ownerParamSeen |= 1ULL << d.index;
+                portEXIT_CRITICAL(&ownerParamMux);
+            }
+            break;
+        }
+        case LINK_ACK:
+            Serial.printf("[LINK] ack type=%d seq=%d %s\n", msg.ack.type, msg.ack.seq,
+                          msg.ack.status == 0 ? "OK" : "REJECTED");
+            break;
+        default:
+            break;
     }
-    else if (cmd.startsWith("L")) {
-        float turnRate = cmd.substring(1).toFloat();
-        setCarTurn(50, -turnRate);  
+}
+
+// ===== 文本命令（USB 串口 / 网页 /cmd / Owner 的 ASCII 行共用，见 cmd_dispatch.h） =====
+// 运动
+void cmdForward(const CmdArgs& a) { setCarSpeed(a.f); }
+void cmdBackward(const CmdArgs& a) { setCarSpeed(-a.f); }
+void cmdLeft(const CmdArgs& a) { setCarTurn(50, -a.f); }   // 网页按L -> 传负数
+void cmdRight(const CmdArgs& a) { setCarTurn(50, a.f); }   // 网页按R -> 传正数
+void cmdStop(const CmdArgs&) { stopMotors(); }
+
+// slider
+void cmdSliderSpeed(const CmdArgs& a) {
+    setCarSpeed(a.f);
+    Serial.printf("⚙ slider speed %.1f%%\n", a.f);
+}
+
+void cmdSliderTurn(const CmdArgs& a) {
+    setCarTurn(50, a.f);
+    Serial.printf("↔ slider turn %.1f\n", a.f);
+}
+
+///到时候网页要加button
+void cmdServo(const CmdArgs& a) {
+    if (a.i == 1) {
+        // 收到 SV1 -> 开启攻击模式
+        isAttacking = true;
+        Serial.println(">>> Attack Mode STARTED (Loop 0-180)");
+    } else {
+        // 收到 SV0 (或其他) -> 停止攻击并归位
+        isAttacking = false;
+        attackServo.write(0); // 归位到0度
+        Serial.println(">>> Attack Mode STOPPED");
     }
-    else if (cmd.startsWith("R")) {
-        float turnRate = cmd.substring(1).toFloat();
-        setCarTurn(50, turnRate); 
+}
+
+// PID / Feedforward 参数（target 为参数表中的名字）
+void cmdSetParam(const CmdArgs& a) {
+    servantParams.set((const char*)a.entry->target, a.entry->argType == CMD_ARG_INT ? (float)a.i : a.f);
+}
+void cmdFeedforwardOn(const CmdArgs&) { servantParams.set("useFeedforward", 1.0f); }
+void cmdFeedforwardOff(const CmdArgs&) { servantParams.set("useFeedforward", 0.0f); }
+
+void cmdResetEncoders(const CmdArgs&) {
+    encoderCountL = 0;
+    encoderCountR = 0;
+}
+
+// 转发给 Owner：模式切换 / 参数
+void cmdAutoOn(const CmdArgs&) {
+    ownerLink.sendMode(OwnerSerial, LINK_MODE_AUTO_ON);
+    ownerAutoOn = true;
+    Serial.println("Sent AUTO_ON to Owner");
+}
+
+void cmdAutoOff(const CmdArgs&) {
+    ownerLink.sendMode(OwnerSerial, LINK_MODE_AUTO_OFF);
+    ownerAutoOn = false;
+    Serial.println("Sent AUTO_OFF to Owner");
+    stopMotors(); // 顺便让车停下
+}
+
+// 手动规划开关
+void cmdPlannerOn(const CmdArgs&) {
+    ownerLink.sendMode(OwnerSerial, LINK_MODE_MP_ON);
+    ownerPlannerOn = true;
+    ownerAutoOn = false;   // Owner 开手动规划时会关掉巡墙
+    Serial.println("Sent MP_ON to Owner (manual planner)");
+}
+
+void cmdPlannerOff(const CmdArgs&) {
+    ownerLink.sendMode(OwnerSerial, LINK_MODE_MP_OFF);
+    ownerPlannerOn = false;
+    Serial.println("Sent MP_OFF to Owner (manual planner)");
+}
+
+// 路线长度不定，仍按 ASCII 行下发
+void cmdPlannerRoute(const CmdArgs& a) {
+    OwnerSerial.write((const uint8_t*)a.line, a.lineLen);
+    OwnerSerial.println();
+    Serial.printf("Sent %.*s to Owner (manual planner)\n", a.lineLen, a.line);
+}
+
+// Owner 的 ToF 测量模式（TOF_BENCH[:ms] / TOF_BENCH_STOP），结果打印在 Owner 的串口
+void cmdToFBench(const CmdArgs& a) {
+    OwnerSerial.write((const uint8_t*)a.line, a.lineLen);
+    OwnerSerial.println();
+    Serial.printf("Sent %.*s to Owner\n", a.lineLen, a.line);
+}
+
+// "PARAM:参数名=值"（MP_PARAM: 为旧写法）：本板参数表里有就本地修改，否则转发给 Owner
+void cmdParam(const CmdArgs& a) {
+    char name[PARAM_NAME_MAX];
+    float value;
+    if (!paramParseAssignment(a.text, a.len, name, value)) {
+        Serial.printf("bad param: %.*s (PARAM:名字=值)\n", a.lineLen, a.line);
+        return;
     }
-    else if (cmd == "S") {
-        stopMotors();
+    if (servantParams.set(name, value)) {
+        Serial.printf("param %s = %g\n", name, value);
+    } else if (a.source != CMD_SRC_OWNER) {
+        forwardParamToOwner(name, value);
+        Serial.printf("Sent parameter update: %s = %g\n", name, value);
     }
+}
 
+void cmdParamList(const CmdArgs&) {
+    servantParams.printAll(Serial);
+    servantParams.printStats(Serial);
+    portENTER_CRITICAL(&ownerParamMux);
+    uint8_t count = ownerParamCount;
+    uint64_t seen = ownerParamSeen;
+    portEXIT_CRITICAL(&ownerParamMux);
+    Serial.printf("owner params mirrored: %u/%u\n", (unsigned)__builtin_popcountll(seen), (unsigned)count);
+}
 
+// 参数配置：PSAVE[:名字] / PLOAD:名字 / PDIFF[:名字] / PLIST / PDEL:名字
+// 本板执行后把同一行转发给 Owner，两块板的同名配置一起保存/加载
+void forwardProfileCommand(const CmdArgs& a) {
+    if (a.source == CMD_SRC_OWNER) return;
+    OwnerSerial.write((const uint8_t*)a.line, a.lineLen);
+    OwnerSerial.println();
+}
 
-    ///到时候网页要加button
-    else if (cmd.startsWith("SV")) {
-            int val = cmd.substring(2).toInt(); 
-            
-            if (val == 1) {
-                // 收到 SV1 -> 开启攻击模式
-                isAttacking = true;
-                Serial.println(">>> Attack Mode STARTED (Loop 0-180)");
-            } 
-            else {
-                // 收到 SV0 (或其他) -> 停止攻击并归位
-                isAttacking = false;
-                attackServo.write(0); // 归位到0度
-                Serial.println(">>> Attack Mode STOPPED");
+// 名字为空时用当前配置
+const char* profileName(const CmdArgs& a, char* buf) {
+    size_t n = a.len < PARAM_PROFILE_NAME_LEN ? a.len : PARAM_PROFILE_NAME_LEN;   // 过长的名字由 normalizeName 拒绝
+    memcpy(buf, a.text, n);
+    buf[n] = '\0';
+    return a.len == 0 ? servantStore.activeProfile() : buf;
+}
+
+void cmdProfileSave(const CmdArgs& a) {
+    char buf[PARAM_PROFILE_NAME_LEN + 1];
+    const char* name = profileName(a, buf);
+    uint8_t extra[PARAM_STORE_MAX_EXTRA];
+    uint16_t extraLen = seqExport(extra, sizeof(extra));
+    ParamStoreResult r = servantStore.save(name, extra, extraLen);
+    Serial.printf("PSAVE %s: %s\n", name, paramStoreResultName(r));
+    forwardProfileCommand(a);
+}
+
+void cmdProfileLoad(const CmdArgs& a) {
+    char buf[PARAM_PROFILE_NAME_LEN + 1];
+    const char* name = profileName(a, buf);
+    uint8_t extra[PARAM_STORE_MAX_EXTRA];
+    uint16_t extraLen = sizeof(extra);
+    ParamStoreResult r = servantStore.load(name, extra, &extraLen);
+    if (r == PSTORE_OK) {
+        seqImport(extra, extraLen);
+        servantStore.printLoadInfo(Serial);
+    } else {
+        Serial.printf("PLOAD %s: %s\n", name, paramStoreResultName(r));
+    }
+    forwardProfileCommand(a);
+}
+
+void cmdProfileDiff(const CmdArgs& a) {
+    char buf[PARAM_PROFILE_NAME_LEN + 1];
+    servantStore.diff(profileName(a, buf), Serial);
+    forwardProfileCommand(a);
+}
+
+void cmdProfileList(const CmdArgs& a) {
+    servantStore.list(Serial);
+    forwardProfileCommand(a);
+}
+
+void cmdProfileDelete(const CmdArgs& a) {
+    char buf[PARAM_PROFILE_NAME_LEN + 1];
+    const char* name = profileName(a, buf);
+    Serial.printf("PDEL %s: %s\n", name, paramStoreResultName(servantStore.remove(name)));
+    forwardProfileCommand(a);
+}
+
+// 本地序列控制（网页直接让小车按时间执行直行/转向）
+void cmdSeqLoad(const CmdArgs& a) {
+    if (seqParse(String(a.text))) {
+        Serial.printf("Loaded SEQ with %d steps\n", seqCount);
+    } else {
+        Serial.println("SEQ parse failed");
+    }
+}
+
+void cmdSeqStart(const CmdArgs&) {
+    seqStart();
+    Serial.println("SEQ start");
+}
+
+void cmdSeqStop(const CmdArgs&) {
+    seqStop();
+    Serial.println("SEQ stop");
+}
+
+// VIVE 开关 / 测试模式
+void cmdViveOn(const CmdArgs&) {
+    isViveActive = true;
+    Serial.println("✅ VIVE 系统已激活");
+}
+
+void cmdViveOff(const CmdArgs&) {
+    isViveActive = false;
+    isViveTestMode = false;
+    Serial.println("❌ VIVE 系统已关闭");
+}
+
+void cmdViveTestOn(const CmdArgs&) {
+    isViveTestMode = true;
+    isViveActive = true;
+    Serial.println("✅ VIVE 测试模式已启用 - 每200ms输出详细数据");
+    Serial.println("   发送 'VIVE_TEST_OFF' 或 'TEST_OFF' 关闭测试模式");
+}
+
+void cmdViveTestOff(const CmdArgs&) {
+    isViveTestMode = false;
+    Serial.println("❌ VIVE 测试模式已关闭");
+}
+
+void cmdStatus(const CmdArgs&);
+void cmdBench(const CmdArgs& a);
+
+void cmdSlipLog(const CmdArgs&) { printSlipLog(); }
+
+// VIVE 比例标定：车停在 A 点 VIVE_MARK，推到 B 点再 VIVE_MARK，卷尺量出 AB 距离后 VIVE_SCALE:毫米
+float viveMarkX[2] = {0.0f, 0.0f}, viveMarkY[2] = {0.0f, 0.0f};
+uint8_t viveMarkCount = 0;
+
+void cmdViveMark(const CmdArgs&) {
+    if (!viveFixValid()) {
+        Serial.println("[VIVE] no fix, mark not taken");
+        return;
+    }
+    viveMarkX[0] = viveMarkX[1];
+    viveMarkY[0] = viveMarkY[1];
+    viveMarkX[1] = viveX;
+    viveMarkY[1] = viveY;
+    if (viveMarkCount < 2) viveMarkCount++;
+    if (viveMarkCount < 2) {
+        Serial.printf("[VIVE] mark A: %.1f, %.1f\n", viveX, viveY);
+        return;
+    }
+    float d = hypotf(viveMarkX[1] - viveMarkX[0], viveMarkY[1] - viveMarkY[0]);
+    Serial.printf("[VIVE] mark B: %.1f, %.1f  |AB| = %.1f units; measure it and send VIVE_SCALE:<mm>\n",
+                  viveX, viveY, d);
+}
+
+void cmdViveScale(const CmdArgs& a) {
+    float d = hypotf(viveMarkX[1] - viveMarkX[0], viveMarkY[1] - viveMarkY[0]);
+    if (viveMarkCount < 2 || d < 100.0f || a.f <= 0.0f) {
+        Serial.println("[VIVE] need two VIVE_MARK points >= 100 units apart and a distance in mm");
+        return;
+    }
+    servantParams.set("viveMmPerUnit", a.f / d);
+    Serial.printf("[VIVE] viveMmPerUnit = %.4f (%.0f mm / %.1f units), PSAVE to keep\n", a.f / d, a.f, d);
+}
+
+void cmdLinkStats(const CmdArgs&) {
+    ownerRx.printStats(Serial);
+    ownerSup.printStats(Serial, millis());
+}
+
+// Owner 心跳超时窗口：LINK_TIMEOUT:毫秒
+void cmdLinkTimeout(const CmdArgs& a) {
+    ownerSup.setTimeout((uint32_t)a.i);
+    Serial.printf("Owner heartbeat timeout = %lu ms\n", (unsigned long)ownerSup.getTimeout());
+}
+
+// 二进制 vs ASCII 位姿消息基准：LINK_BENCH[:次数]
+void cmdLinkBench(const CmdArgs& a) { linkBenchmark(Serial, a.i > 0 ? (uint32_t)a.i : 2000); }
+
+// 主循环周期直方图（网页同 /loopStats）
+void cmdLoopStats(const CmdArgs&) { loopStats.printStats(Serial); }
+void cmdLoopReset(const CmdArgs&) {
+    loopStats.reset();
+    Serial.println("loop stats reset");
+}
+
+// 示波器布防：SCOPE_ARM:触发,门限,触发前,触发后（如 SCOPE_ARM:error,5,200,300），结果从网页下载
+void cmdScopeArm(const CmdArgs& a) {
+    char args[48];
+    char name[16] = "now";
+    ScopeConfig cfg{SCOPE_TRIG_NOW, 0.0f, SCOPE_DEPTH / 4, SCOPE_DEPTH * 3 / 4};
+    unsigned pre = cfg.pre, post = cfg.post;
+    size_t n = min((size_t)a.len, sizeof(args) - 1);
+    memcpy(args, a.text, n);
+    args[n] = '\0';
+    sscanf(args, "%15[^,],%f,%u,%u", name, &cfg.level, &pre, &post);
+    cfg.pre = pre;
+    cfg.post = post;
+    if (!ScopeCapture::parseTrigger(name, cfg.trigger) || pre > SCOPE_DEPTH || post > SCOPE_DEPTH ||
+        !scope.arm(cfg)) {
+        Serial.println("[SCOPE] bad args (trigger now|setpoint|error|mode, pre + post <= depth) or busy");
+        return;
+    }
+    scope.printStats(Serial);
+}
+void cmdScopeStop(const CmdArgs&) {
+    scope.stop();
+    scope.printStats(Serial);
+}
+
+// 当前模式位（示波器的模式触发与图上的模式条）
+uint8_t scopeModeBits() {
+    uint8_t m = 0;
+    if (isViveActive) m |= SCOPE_MODE_VIVE;
+    if (seqActive) m |= SCOPE_MODE_SEQ;
+    if (ownerAutoOn) m |= SCOPE_MODE_AUTO;
+    if (ownerPlannerOn) m |= SCOPE_MODE_PLANNER;
+    if (motionFromOwner) m |= SCOPE_MODE_OWNER;
+    if (motionFromTeleop) m |= SCOPE_MODE_TELEOP;
+    if (odomCal.isActive()) m |= SCOPE_MODE_CAL;
+    if (slipEstimator.isLimiting(millis())) m |= SCOPE_MODE_SLIP;
+    return m;
+}
+
+// 命令表见 servant_commands.h
+#define SERVANT_CMD(prefix, argType, sources, handler) CMD_ENTRY(prefix, argType, sources, handler),
+#define SERVANT_CMD_ARG(prefix, argType, sources, handler, target) \
+    CMD_ENTRY_ARG(prefix, argType, sources, handler, target),
+const CmdEntry servantCommands[] = { SERVANT_COMMAND_TABLE(SERVANT_CMD, SERVANT_CMD_ARG) };
+const uint8_t SERVANT_COMMAND_COUNT = sizeof(servantCommands) / sizeof(servantCommands[0]);
+CmdDispatcher commands(servantCommands, SERVANT_COMMAND_COUNT);
+
+// 文本命令字典基准：CMD_BENCH[:次数]
+void cmdBench(const CmdArgs& a) {
+    cmdBenchmark(Serial, commands, servantCommands, SERVANT_COMMAND_COUNT, a.i > 0 ? (uint32_t)a.i : 1000);
+}
+
+void wsPrintStats(Print& out);
+
+void cmdStatus(const CmdArgs&) {
+    Serial.println("═══════════════════════════════════════");
+    Serial.println("📍 VIVE 系统状态");
+    Serial.println("───────────────────────────────────────");
+    Serial.printf("系统激活: %s\n", isViveActive ? "是" : "否");
+    Serial.printf("测试模式: %s\n", isViveTestMode ? "是" : "否");
+    Serial.printf("跟踪器1状态 (车后左边): %d (0=无信号, 1=仅同步, 2=接收中)\n", viveFront.getStatus());
+    Serial.printf("跟踪器2状态 (车后右边): %d (0=无信号, 1=仅同步, 2=接收中)\n", viveBack.getStatus());
+    Serial.printf("当前坐标: X=%.2f, Y=%.2f\n", viveX, viveY);
+    Serial.printf("当前角度: %.2f°\n", viveAngle);
+    Serial.printf("里程计: X=%.1f, Y=%.1f, θ=%.1f° | D_L=%.2f D_R=%.2f b=%.1f\n",
+                  odomPose.x, odomPose.y, odomPose.theta * 180.0 / PI,
+                  odomGeom.wheelDiamL, odomGeom.wheelDiamR, odomGeom.trackWidth);
+    Serial.printf("打滑: ratio=%.2f enc=%.0f vive=%.0f mm/s %s\n",
+                  slipEstimator.getRatio(), slipEstimator.getEncSpeed(),
+                  slipEstimator.getViveSpeed(), slipEstimator.isSlipping() ? "(SLIP)" : "");
+    ownerSup.printStats(Serial, millis());
+    ownerSup.clock().printStatus(Serial);
+    if (ownerSup.clock().isValid()) {
+        Serial.printf("Owner 运动命令生效延迟: %.2f ms\n", motionLatencyUs / 1000.0);
+    }
+    commands.printStats(Serial);
+    servantParams.printStats(Serial);
+    wsPrintStats(Serial);
+    teleop.printStats(Serial);
+    loopStats.printStats(Serial);
+    scope.printStats(Serial);
+    Serial.printf("参数配置: %s\n", servantStore.activeProfile());
+    Serial.println("═══════════════════════════════════════");
+}
+
+// 处理一行文本命令；无法识别的命令回报给串口
+CmdResult runCommand(const char* line, uint8_t source) {
+    CmdResult r = commands.dispatch(line, source);
+    if (r != CMD_OK && r != CMD_EMPTY) {
+        Serial.printf("[CMD] %s: %s\n", cmdResultName(r), line);
+    }
+    return r;
+}
+
+WebServer server(80);
+
+// ===== 网页任务（核 0）：HTTP + WebSocket，与主循环（核 1，控制）分开 =====
+// 慢客户端、大页面发送、半开的 TCP 连接只会卡住网页任务，不会推迟 PID、VIVE 与 UART 处理
+// 网页处理函数只做两件事：把命令放进 webCmds，读 webState 快照；不直接碰电机/VIVE 全局量
+#define WEB_TASK_CORE        0
+#define WEB_TASK_STACK       8192
+#define WEB_TASK_PRIORITY    1
+TaskHandle_t webTaskHandle = NULL;
+WebCommandQueue webCmds;
+
+// 主循环每个控制周期记一条，网页用 /history?since= 取
+PoseHistory poseHistory;
+
+// 连续遥控的 UDP 端口（TELEOP_UDP_PORT），在网页任务中收包
+WiFiUDP teleopUdp;
+IPAddress teleopUdpPeer;       // 最近一个 UDP 发送端（回执发给它），只在网页任务中使用
+uint16_t teleopUdpPeerPort = 0;
+
+// 主循环每圈发布一次，网页（/viveData、/calib、WebSocket 遥测）只读这份拷贝
+struct ServantWebState {
+    uint32_t ms;
+    float x, y, angle;
+    uint16_t frontRaw[2], backRaw[2];
+    uint16_t frontFilt[2], backFilt[2];
+    int8_t frontStatus, backStatus;
+    float speedL, speedR, targetL, targetR;
+    int pwmL, pwmR;
+    float slipRatio;
+    bool slipping;
+    uint32_t slipEvents;
+    bool vive, seq, autoOn, planner, attacking, ownerMotion, linkAlive, teleop;
+    // 里程计与标定
+    OdomPose pose;
+    OdomGeometry geom;
+    bool calActive, calValid, calHeldOut;
+    uint8_t calRun, calRuns, calSeg;
+    const char* calError;   // 指向字符串常量
+    float calBefore, calAfter;
+};
+WebSnapshot<ServantWebState> webState;
+
+void publishWebState() {
+    ServantWebState w;
+    w.ms = millis();
+    w.x = viveX; w.y = viveY; w.angle = viveAngle;
+    w.frontRaw[0] = viveFront.getXCoordinate(); w.frontRaw[1] = viveFront.getYCoordinate();
+    w.backRaw[0] = viveBack.getXCoordinate();   w.backRaw[1] = viveBack.getYCoordinate();
+    w.frontFilt[0] = viveXFront; w.frontFilt[1] = viveYFront;
+    w.backFilt[0] = viveXBack;   w.backFilt[1] = viveYBack;
+    w.frontStatus = viveFront.getStatus(); w.backStatus = viveBack.getStatus();
+    w.speedL = speedL; w.speedR = speedR;
+    w.targetL = targetSpeedL; w.targetR = targetSpeedR;
+    w.pwmL = pwmOutputL; w.pwmR = pwmOutputR;
+    w.slipRatio = slipEstimator.getRatio();
+    w.slipping = slipEstimator.isSlipping();
+    w.slipEvents = slipEstimator.getTotalEvents();
+    w.vive = isViveActive; w.seq = seqActive; w.autoOn = ownerAutoOn; w.planner = ownerPlannerOn;
+    w.attacking = isAttacking; w.ownerMotion = motionFromOwner; w.linkAlive = ownerSup.isAlive();
+    w.teleop = motionFromTeleop;
+    w.pose = odomPose;
+    w.geom = odomGeom;
+    const OdomCalResult& r = odomCal.getResult();
+    w.calActive = odomCal.isActive(); w.calValid = r.valid; w.calHeldOut = r.heldOut;
+    w.calRun = odomCal.getRunIndex(); w.calRuns = odomCal.getTotalRuns(); w.calSeg = odomCal.getSegmentIndex();
+    w.calError = odomCal.getError();
+    w.calBefore = r.closureBefore; w.calAfter = r.closureAfter;
+    webState.publish(w);
+}
+
+// ===== WebSocket（端口 81）：遥测推送 + 命令通道，代替网页的 /viveData 轮询与每条命令一次的 /cmd 请求 =====
+// 网页发 "编号 命令"（编号可省略），命令与 /cmd 一样排进 webCmds 由主循环执行；执行成功的命令在下一个控制周期
+// 输出 PWM 之后回 ack（act = 收到命令到电机输出的微秒数），网页结合往返时间算出命令到执行的延迟
+// webSocket 对象只在网页任务中使用；ack 由主循环经 webCmds 的回程队列交给网页任务发送
+WebSocketsServer webSocket(81);
+
+struct WsPendingAck {
+    uint8_t client;
+    uint32_t id;
+    uint32_t rxUs;
+};
+const uint8_t WS_MAX_PENDING_ACKS = 8;
+WsPendingAck wsPendingAcks[WS_MAX_PENDING_ACKS];   // 主循环：等本控制周期输出 PWM
+uint8_t wsPendingAckCount = 0;
+
+uint32_t wsCommands = 0;
+uint32_t wsFramesPushed = 0;
+uint32_t wsActLastUs = 0;
+uint32_t wsActMaxUs = 0;
+volatile uint8_t wsClientCount = 0;   // 网页任务更新，STATUS 读
+
+void wsSendAck(uint8_t client, uint32_t id, const char* result, uint32_t actUs) {
+    char buf[80];
+    int n = snprintf(buf, sizeof(buf), "{\"t\":\"ack\",\"id\":%lu,\"r\":\"%s\",\"act\":%lu}",
+                     (unsigned long)id, result, (unsigned long)actUs);
+    webSocket.sendTXT(client, buf, n);
+}
+
+// 主循环：在控制周期输出 PWM 之后调用，本周期生效的命令逐条交给网页任务回 ack
+void wsFlushAcks() {
+    if (wsPendingAckCount == 0) return;
+    uint32_t now = micros();
+    for (uint8_t k = 0; k < wsPendingAckCount; k++) {
+        const WsPendingAck& p = wsPendingAcks[k];
+        wsActLastUs = now - p.rxUs;
+        if (wsActLastUs > wsActMaxUs) wsActMaxUs = wsActLastUs;
+        webCmds.postAck(p.client, p.id, CMD_OK, wsActLastUs);
+    }
+    wsPendingAckCount = 0;
+}
+
+// 主循环：执行网页任务排进来的命令
+void processWebCommands() {
+    static WebCommand c;
+    while (webCmds.poll(c)) {
+        if (c.client == WEB_CLIENT_HTTP) {
+            wifiPacketCount++; //wifi包
+            Serial.print("Web: ");
+            Serial.println(c.line);
+        }
+        CmdResult r = runCommand(c.line, CMD_SRC_WEB);
+        if (c.id == 0) continue;
+        if (r == CMD_OK && wsPendingAckCount < WS_MAX_PENDING_ACKS) {
+            wsPendingAcks[wsPendingAckCount++] = WsPendingAck{c.client, c.id, c.rxUs};
+        } else {
+            webCmds.postAck(c.client, c.id, r, r == CMD_OK ? micros() - c.rxUs : 0);
+        }
+    }
+}
+
+// 主循环：执行最新的遥控设定值；死人开关松开即停车，遥控中静默超过 teleopTimeoutMs 也停车
+void processTeleop() {
+    TeleopSetpoint sp;
+    switch (teleop.poll(micros(), teleopTimeoutMs * 1000UL, sp)) {
+        case TELEOP_APPLY:
+            if (sp.enable) {
+                setCarTwist(sp.linear, sp.angular);
+                motionFromTeleop = true;
+            } else if (motionFromTeleop) {
+                stopMotors();
+            }
+            break;
+        case TELEOP_TIMEOUT:
+            if (motionFromTeleop) {
+                Serial.printf("[TELEOP] no packet for %u ms -> STOP\n", (unsigned)teleopTimeoutMs);
+                stopMotors();
             }
+            break;
+        default:
+            break;
+    }
+}
+
+// 以下在网页任务中运行
+void onWebSocketEvent(uint8_t client, WStype_t type, uint8_t* payload, size_t length) {
+    switch (type) {
+        case WStype_CONNECTED:
+            Serial.printf("[WS] client %u connected from %s\n", client, webSocket.remoteIP(client).toString().c_str());
+            break;
+        case WStype_DISCONNECTED:
+            Serial.printf("[WS] client %u disconnected\n", client);
+            break;
+        case WStype_TEXT: {
+            uint32_t rxUs = micros();
+            const char* line = (const char*)payload;   // 库保证文本帧以 \0 结尾
+            char* rest = nullptr;
+            uint32_t id = strtoul(line, &rest, 10);
+            if (rest == line || *rest != ' ') {
+                id = 0;   // 没有编号：只执行，不回 ack
+                rest = (char*)line;
+            }
+            wsCommands++;
+            if (!webCmds.post(client, id, rest, length - (rest - line), rxUs) && id != 0) {
+                wsSendAck(client, id, "BUSY", 0);
+            }
+            break;
         }
+        case WStype_BIN:
+            teleop.offer(payload, length, client, micros());
+            break;
+        default:
+            break;
+    }
+}
 
+void wsSendQueuedAcks() {
+    WebAck a;
+    while (webCmds.pollAck(a)) {
+        wsSendAck(a.client, a.id, cmdResultName((CmdResult)a.result), a.actUs);
+    }
+}
 
+// UDP 遥控包：一次把缓冲里的包都交给 teleop（它只留最新的一包）
+void teleopPollUdp() {
+    uint8_t buf[sizeof(TeleopPacket)];
+    int size;
+    while ((size = teleopUdp.parsePacket()) > 0) {
+        uint32_t rxUs = micros();
+        if (teleopUdp.read(buf, sizeof(buf)) <= 0) continue;
+        // 长度不对的包由 offer() 记为 bad；多余字节在下一次 parsePacket() 时丢弃
+        if (teleop.offer(buf, size, TELEOP_SOURCE_UDP, rxUs)) {
+            teleopUdpPeer = teleopUdp.remoteIP();
+            teleopUdpPeerPort = teleopUdp.remotePort();
+        }
+    }
+}
 
-    // PID / Feedforward 参数
-    else if (cmd.startsWith("KPB")) Kp_base = cmd.substring(3).toFloat();
-    else if (cmd.startsWith("KIB")) Ki_base = cmd.substring(3).toFloat();
-    else if (cmd.startsWith("KDB")) Kd_base = cmd.substring(3).toFloat();
-    else if (cmd.startsWith("FFA")) feedforwardA = cmd.substring(3).toFloat();
-    else if (cmd.startsWith("FFB")) feedforwardB = cmd.substring(3).toFloat();
-    else if (cmd == "FF1") useFeedforward = true;
-    else if (cmd == "FF0") useFeedforward = false;
-    else if (cmd == "RESET") {
-        encoderCountL = 0;
-        encoderCountR = 0;
+// 主循环执行了一包之后回执给发送端（二进制 WebSocket 帧或 UDP 包）
+void teleopSendAck() {
+    TeleopAck ack;
+    uint8_t source;
+    if (!teleop.takeAck(ack, source)) return;
+    if (source == TELEOP_SOURCE_UDP) {
+        if (teleopUdpPeerPort == 0) return;
+        teleopUdp.beginPacket(teleopUdpPeer, teleopUdpPeerPort);
+        teleopUdp.write((const uint8_t*)&ack, sizeof(ack));
+        teleopUdp.endPacket();
+    } else {
+        webSocket.sendBIN(source, (const uint8_t*)&ack, sizeof(ack));
     }
+}
 
+// 遥测帧：位姿、两个 tracker 的原始/滤波坐标、轮速/目标/PWM、各模式状态；按 wsTelemetryHz 推给所有网页
+void wsPushTelemetry() {
+    static uint32_t lastPushMs = 0;
+    if (millis() - lastPushMs < 1000u / wsTelemetryHz) return;
+    lastPushMs = millis();
+    if (webSocket.connectedClients() == 0) return;
+
+    ServantWebState w;
+    webState.read(w);
+    char buf[512];
+    int n = snprintf(buf, sizeof(buf),
+        "{\"t\":\"tel\",\"ms\":%lu,\"hz\":%u,\"x\":%.1f,\"y\":%.1f,\"a\":%.1f,"
+        "\"fr\":[%u,%u],\"br\":[%u,%u],\"ff\":[%u,%u],\"bf\":[%u,%u],\"st\":[%d,%d],"
+        "\"vl\":%.1f,\"vr\":%.1f,\"tl\":%.1f,\"tr\":%.1f,\"pl\":%d,\"pr\":%d,\"slip\":%.2f,"
+        "\"m\":{\"vive\":%d,\"seq\":%d,\"auto\":%d,\"mp\":%d,\"atk\":%d,\"cal\":%d,\"owner\":%d,\"link\":%d,"
+        "\"tele\":%d}}",
+        (unsigned long)w.ms, (unsigned)wsTelemetryHz, w.x, w.y, w.angle,
+        w.frontRaw[0], w.frontRaw[1], w.backRaw[0], w.backRaw[1],
+        w.frontFilt[0], w.frontFilt[1], w.backFilt[0], w.backFilt[1], w.frontStatus, w.backStatus,
+        w.speedL, w.speedR, w.targetL, w.targetR, w.pwmL, w.pwmR, w.slipRatio,
+        w.vive, w.seq, w.autoOn, w.planner, w.attacking, w.calActive, w.ownerMotion, w.linkAlive, w.teleop);
+    if (n > 0 && n < (int)sizeof(buf)) {
+        webSocket.broadcastTXT(buf, n);
+        wsFramesPushed++;
+    }
 }
 
-WebServer server(80);
+void wsPrintStats(Print& out) {
+    out.printf("WebSocket: clients=%u rate=%u Hz cmds=%lu frames=%lu, cmd->PWM last=%.2f max=%.2f ms\n",
+               (unsigned)wsClientCount, (unsigned)wsTelemetryHz, (unsigned long)wsCommands,
+               (unsigned long)wsFramesPushed, wsActLastUs / 1000.0, wsActMaxUs / 1000.0);
+    webCmds.printStats(out);
+}
 
 //Routes
-void handleRoot() { server.send(200, "text/html", webpage); }
+// 网页是预压缩的 gzip；ETag 为内容哈希，浏览器带 If-None-Match 重新验证时只回 304
+void handleRoot() {
+    server.sendHeader("ETag", webpage_etag);
+    server.sendHeader("Cache-Control", "no-cache");   // 每次都重新验证，固件更新后不会用到旧页面
+    if (server.header("If-None-Match") == webpage_etag) {
+        server.send(304);
+        return;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, "text/html", (const char*)webpage_gz, webpage_gz_len);
+}
+
+// JsonWriter 写满（缓冲不够）时回 500，不发半截 JSON
+void sendJson(const JsonWriter& j) {
+    if (!j.ok()) {
+        server.send(500, "text/plain", "json overflow");
+        return;
+    }
+    server.setContentLength(j.length());
+    server.send(200, "application/json", "");
+    server.sendContent(j.c_str(), j.length());
+}
+
+void webTask(void*) {
+    for (;;) {
+        server.handleClient();
+        webSocket.loop();
+        teleopPollUdp();
+        wsSendQueuedAcks();
+        teleopSendAck();
+        wsPushTelemetry();
+        wsClientCount = webSocket.connectedClients();
+        vTaskDelay(1);
+    }
+}
 
 // Arduino main function 
 // 初始化串口、Wi-Fi AP、Web API、引脚模式、PWM、编码器中断、VIVE、控制定时器
@@ -556,6 +1448,7 @@ void setup() {
 
     //来自 owner 的 UART（实际接线：Servant TX=GPIO17 -> Owner RX，Servant RX=GPIO18 <- Owner TX）
     OwnerSerial.begin(115200, SERIAL_8N1, 18, 17);
+    ownerRx.begin();
     Serial.println("UART from owner ready");
     
     // TopHat I2C init
@@ -574,145 +1467,216 @@ void setup() {
     Serial.println("\n\n");
 
     //web
+    static const char* requestHeaders[] = { "If-None-Match" };
+    server.collectHeaders(requestHeaders, 1);
     server.on("/", handleRoot);
 
     // VIVE data endpoint - 合并为一个API以减少网络包
+    // JSON 直接写进定长缓冲（JsonWriter），网页轮询不再每次拼 20 个 String
     server.on("/viveData", [](){
         // 返回中心坐标/角度，以及两只tracker的原始/滤波数据与状态
-        uint16_t rawXFront = viveFront.getXCoordinate();
-        uint16_t rawYFront = viveFront.getYCoordinate();
-        uint16_t rawXBack  = viveBack.getXCoordinate();
-        uint16_t rawYBack  = viveBack.getYCoordinate();
-
-        String json = "{";
-        json += "\"x\":" + String(viveX);
-        json += ",\"y\":" + String(viveY);
-        json += ",\"angle\":" + String(viveAngle);
-        json += ",\"frontRaw\":{\"x\":" + String(rawXFront) + ",\"y\":" + String(rawYFront) + "}";
-        json += ",\"backRaw\":{\"x\":" + String(rawXBack) + ",\"y\":" + String(rawYBack) + "}";
-        json += ",\"frontFiltered\":{\"x\":" + String(viveXFront) + ",\"y\":" + String(viveYFront) + "}";
-        json += ",\"backFiltered\":{\"x\":" + String(viveXBack) + ",\"y\":" + String(viveYBack) + "}";
-        json += ",\"status\":{\"front\":" + String(viveFront.getStatus()) + ",\"back\":" + String(viveBack.getStatus()) + "}";
-        json += "}";
-        server.send(200, "application/json", json);
+        ServantWebState w;
+        webState.read(w);
+        char buf[384];
+        JsonWriter j(buf, sizeof(buf));
+        j.beginObject();
+        j.field("x", w.x).field("y", w.y).field("angle", w.angle);
+        j.key("frontRaw").beginObject().field("x", w.frontRaw[0]).field("y", w.frontRaw[1]).endObject();
+        j.key("backRaw").beginObject().field("x", w.backRaw[0]).field("y", w.backRaw[1]).endObject();
+        j.key("frontFiltered").beginObject().field("x", w.frontFilt[0]).field("y", w.frontFilt[1]).endObject();
+        j.key("backFiltered").beginObject().field("x", w.backFilt[0]).field("y", w.backFilt[1]).endObject();
+        j.key("status").beginObject().field("front", w.frontStatus).field("back", w.backStatus).endObject();
+        j.key("slip").beginObject().field("ratio", w.slipRatio).field("active", w.slipping ? 1 : 0)
+         .field("events", w.slipEvents).endObject();
+        j.endObject();
+        sendJson(j);
+    });
+    
+    // 里程计标定状态与结果（闭合误差前后对比）
+    server.on("/calib", [](){
+        ServantWebState w;
+        webState.read(w);
+        char buf[320];
+        JsonWriter j(buf, sizeof(buf));
+        j.beginObject();
+        j.field("active", w.calActive ? 1 : 0);
+        j.field("run", w.calRun).field("runs", w.calRuns).field("seg", w.calSeg);
+        j.field("error", w.calError);
+        j.field("valid", w.calValid ? 1 : 0).field("heldOut", w.calHeldOut ? 1 : 0);
+        j.field("before", w.calBefore).field("after", w.calAfter);
+        j.field("dL", w.geom.wheelDiamL).field("dR", w.geom.wheelDiamR).field("b", w.geom.trackWidth);
+        j.key("odom").beginObject().field("x", w.pose.x).field("y", w.pose.y)
+         .field("theta", w.pose.theta * 180.0 / PI).endObject();
+        j.endObject();
+        sendJson(j);
     });
     
+    // 参数表（本板 + Owner 镜像），网页据此生成滑块；Owner 部分不全时请主循环代发 PARAM_LIST
+    // 本板的值直接读变量（单个 32 位读，不会读到半个值）；Owner 镜像逐项在 ownerParamMux 内拷出
+    server.on("/params", [](){
+        bool complete = ownerParamsComplete();
+        static uint32_t lastListRequest = 0;
+        if (!complete && millis() - lastListRequest > 1000) {
+            lastListRequest = millis();
+            webWantsOwnerParams = true;
+        }
+        static char buf[6144];   // 只在网页任务中使用；两张表满载约 5 KB
+        JsonWriter j(buf, sizeof(buf));
+        j.beginObject().field("complete", complete ? 1 : 0).key("params").beginArray();
+        auto add = [&](const char* name, char group, uint8_t type, float v, float lo, float hi, float step) {
+            j.beginObject().field("n", name).field("g", group).field("t", type);
+            j.field("v", v, 3).field("min", lo, 3).field("max", hi, 3).field("step", step, 3).endObject();
+        };
+        for (uint8_t i = 0; i < servantParams.count(); i++) {
+            const ParamDesc& d = servantParams.desc(i);
+            add(d.name, d.group, d.type, servantParams.get(i), d.minVal, d.maxVal, d.step);
+        }
+        for (uint8_t i = 0; i < PARAM_MAX_ENTRIES; i++) {
+            LinkParamDesc d;
+            portENTER_CRITICAL(&ownerParamMux);
+            bool have = i < ownerParamCount && (ownerParamSeen >> i & 1);
+            if (have) d = ownerParamDesc[i];
+            portEXIT_CRITICAL(&ownerParamMux);
+            if (have) add(d.name, d.group, d.type, d.value, d.minVal, d.maxVal, d.step);
+        }
+        j.endArray().endObject();
+        sendJson(j);
+    });
+
+    // 位姿/轮速历史：since 之后的全部样本，每条 [seq, ms, x, y, angle, vL, vR, tL, tR]
+    // seq = 最新序号（下次请求带上），gap = 网页取得太慢、中间有样本已被覆盖
+    server.on("/history", [](){
+        static PoseSample samples[POSE_HISTORY_SIZE];   // 只在网页任务中使用
+        static char buf[POSE_HISTORY_SIZE * 64 + 64];
+        uint32_t since = strtoul(server.arg("since").c_str(), nullptr, 10);
+        bool gap = false;
+        size_t n = poseHistory.copySince(since, samples, POSE_HISTORY_SIZE, &gap);
+        JsonWriter j(buf, sizeof(buf));
+        j.beginObject();
+        j.field("seq", n ? samples[n - 1].seq : poseHistory.latestSeq());
+        j.field("gap", gap);
+        j.field("period", CONTROL_PERIOD_MS);
+        j.key("s").beginArray();
+        for (size_t k = 0; k < n; k++) {
+            const PoseSample& p = samples[k];
+            j.beginArray().value(p.seq).value(p.ms);
+            j.value(p.x, 1).value(p.y, 1).value(p.angle, 1);
+            j.value(p.speedL, 1).value(p.speedR, 1).value(p.targetL, 1).value(p.targetR, 1);
+            j.endArray();
+        }
+        j.endArray().endObject();
+        sendJson(j);
+    });
+
     // 保留单独端点以兼容（可选）
     server.on("/viveX", [](){
-        server.send(200, "text/plain", String(viveX));
+        ServantWebState w;
+        webState.read(w);
+        server.send(200, "text/plain", String(w.x));
     });
     
     server.on("/viveY", [](){
-        server.send(200, "text/plain", String(viveY));
+        ServantWebState w;
+        webState.read(w);
+        server.send(200, "text/plain", String(w.y));
     });
     
     server.on("/viveAngle", [](){
-        server.send(200, "text/plain", String(viveAngle));
+        ServantWebState w;
+        webState.read(w);
+        server.send(200, "text/plain", String(w.angle));
     });
 
+    // 命令只排队，由主循环执行：202 = 已排队，503 = 队列满（结果见串口；要逐条结果用 WebSocket 的 ack）
     server.on("/cmd", [](){
-        wifiPacketCount++; //wifi包
-        String data = server.arg("data");
-        Serial.print("Web: ");
-        Serial.println(data);
-
-        // movement control
-        if (data.startsWith("F")) { setCarSpeed(data.substring(1).toFloat()); }
-        else if (data.startsWith("B")) { setCarSpeed(-data.substring(1).toFloat()); }
-        // [修改] 网页按L -> 传负数
-        else if (data.startsWith("L")) { setCarTurn(50, -data.substring(1).toFloat()); } 
-        // [修改] 网页按R -> 传正数
-        else if (data.startsWith("R")) { setCarTurn(50, data.substring(1).toFloat()); }
-        else if (data == "S") { stopMotors(); }
-
-
-        // [新增] 转发 Auto 开关给 Owner
-        else if (data == "AUTO_ON") {
-            OwnerSerial.println("AUTO_ON"); 
-            Serial.println("Sent AUTO_ON to Owner");
-        }
-        else if (data == "AUTO_OFF") {
-            OwnerSerial.println("AUTO_OFF");
-            Serial.println("Sent AUTO_OFF to Owner");
-            stopMotors(); // 顺便让车停下
-        }
-        // 手动规划开关/路线下发
-        else if (data == "MP_ON" || data == "MP_OFF" || data.startsWith("MP_ROUTE:")) {
-            OwnerSerial.println(data);
-            Serial.printf("Sent %s to Owner (manual planner)\n", data.c_str());
-        }
-        // 手动规划参数下发
-        else if (data.startsWith("MP_PARAM:")) {
-            OwnerSerial.println(data);
-            Serial.printf("Sent %s to Owner (manual param)\n", data.c_str());
-        }
-        // 本地序列控制（网页直接让小车按时间执行直行/转向）
-        else if (data.startsWith("SEQ:")) {
-            String payload = data.substring(4);
-            if (seqParse(payload)) {
-                Serial.printf("Loaded SEQ with %d steps\n", seqCount);
-            } else {
-                Serial.println("SEQ parse failed");
-            }
-        }
-        else if (data == "SEQ_START") {
-            seqStart();
-            Serial.println("SEQ start");
-        }
-        else if (data == "SEQ_STOP") {
-            seqStop();
-            Serial.println("SEQ stop");
-        }
-        
-        // [新增] 转发参数调整命令给 Owner
-        else if (data.startsWith("PARAM:")) {
-            OwnerSerial.println(data); // 直接转发 "PARAM:参数名=值"
-            Serial.printf("Sent parameter update: %s\n", data.c_str());
-        }
-        
-        // [新增] 本地处理 VIVE 开关
-        else if (data == "VIVE_ON") { 
-            isViveActive = true; 
-            Serial.println("VIVE System ACTIVATED");
-        }
-        else if (data == "VIVE_OFF") { 
-            isViveActive = false; 
-            Serial.println("VIVE System DISABLED");
-        }
-        else if (data == "VIVE_TEST_ON") {
-            isViveTestMode = true;
-            isViveActive = true;
-            Serial.println("VIVE Test Mode ACTIVATED - 详细数据输出");
-        }
-        else if (data == "VIVE_TEST_OFF") {
-            isViveTestMode = false;
-            Serial.println("VIVE Test Mode DISABLED");
-        }
+        const String& data = server.arg("data");
+        bool queued = webCmds.post(WEB_CLIENT_HTTP, 0, data.c_str(), data.length(), micros());
+        server.send(queued ? 202 : 503, "text/plain", queued ? "QUEUED" : "BUSY");
+    });
+
+    // 主循环周期分布（tools/cmd_flood.py 洪泛 /cmd 时对比）；?reset=1 清零
+    server.on("/loopStats", [](){
+        if (server.arg("reset") == "1") loopStats.reset();
+        char buf[384];
+        JsonWriter j(buf, sizeof(buf));
+        loopStats.toJson(j);
+        sendJson(j);
+    });
 
-        // slider
-        else if (data.startsWith("SPEED=")) {
-            float val = data.substring(6).toFloat();
-            setCarSpeed(val);
-            Serial.printf("⚙ slider speed %.1f%%\n", val);
+    // 示波器：/scope 状态，/scope/arm?trig=&level=&pre=&post= 布防，/scope/stop，/scope/data 下载（冻结后）
+    server.on("/scope", [](){
+        char buf[192];
+        JsonWriter j(buf, sizeof(buf));
+        scope.toJson(j);
+        sendJson(j);
+    });
+    server.on("/scope/arm", [](){
+        ScopeConfig cfg{SCOPE_TRIG_NOW, server.arg("level").toFloat(), SCOPE_DEPTH / 4, SCOPE_DEPTH * 3 / 4};
+        if (server.hasArg("pre")) cfg.pre = constrain(server.arg("pre").toInt(), 0, SCOPE_DEPTH);
+        if (server.hasArg("post")) cfg.post = constrain(server.arg("post").toInt(), 0, SCOPE_DEPTH);
+        if (server.hasArg("trig") && !ScopeCapture::parseTrigger(server.arg("trig").c_str(), cfg.trigger)) {
+            server.send(400, "text/plain", "trig: now|setpoint|error|mode");
+            return;
         }
-        else if (data.startsWith("TURN=")) {
-            float val = data.substring(5).toFloat();
-            setCarTurn(50, val);
-            Serial.printf("↔ slider turn %.1f\n", val);
+        if (!scope.arm(cfg)) {
+            server.send(409, "text/plain", "bad depth or download in progress");
+            return;
         }
-
+        char buf[192];
+        JsonWriter j(buf, sizeof(buf));
+        scope.toJson(j);
+        sendJson(j);
+    });
+    server.on("/scope/stop", [](){
+        scope.stop();
         server.send(200, "text/plain", "OK");
     });
+    // 头 + 样本直接从环形缓冲发出（最多两段），不拷贝
+    server.on("/scope/data", [](){
+        ScopeHeader h;
+        const uint8_t *a, *b;
+        size_t na, nb;
+        if (!scope.beginRead(h, a, na, b, nb)) {
+            server.send(409, "text/plain", "no capture");
+            return;
+        }
+        server.sendHeader("Content-Disposition", "attachment; filename=scope.bin");
+        server.setContentLength(sizeof(h) + na + nb);
+        server.send(200, "application/octet-stream", "");
+        server.sendContent((const char*)&h, sizeof(h));
+        server.sendContent((const char*)a, na);
+        if (nb) server.sendContent((const char*)b, nb);
+        scope.endRead();
+    });
 
     server.onNotFound([](){ server.send(404, "text/plain", "Not found"); });
     server.begin();
     Serial.println("Web server started at http://192.168.4.1");
+    webSocket.begin();
+    webSocket.onEvent(onWebSocketEvent);
+    Serial.println("WebSocket telemetry/commands on ws://192.168.4.1:81");
+    teleopUdp.begin(TELEOP_UDP_PORT);
+    Serial.printf("Teleop UDP on port %u\n", TELEOP_UDP_PORT);
+    if (!webCmds.begin()) Serial.println("web command queue alloc failed!");
 
     Serial.println("ESP32-S3 PID Control System");
     Serial.println();
     Serial.println("System Info:");
     Serial.println("Motor: JGA25-370-46.8K (12V, 130RPM)");
     Serial.printf("Encoder: %.0f pulses/rev\n", PULSES_PER_REV);
+    loadOdomGeometry();
+    printOdomGeometry("Odometry", odomGeom);
+    {
+        uint8_t extra[PARAM_STORE_MAX_EXTRA];
+        uint16_t extraLen = sizeof(extra);
+        ParamStoreResult r = servantStore.restore(extra, &extraLen);
+        if (r == PSTORE_OK) {
+            seqImport(extra, extraLen);
+            servantStore.printLoadInfo(Serial);
+        } else {
+            Serial.printf("Param profile '%s': %s, using built-in defaults\n", servantStore.activeProfile(), paramStoreResultName(r));
+        }
+    }
     Serial.printf("   Arduino ESP32: v%d.%d.%d\n", 
                   ESP_ARDUINO_VERSION_MAJOR, 
                   ESP_ARDUINO_VERSION_MINOR, 
@@ -780,12 +1744,19 @@ void setup() {
     
     lastSpeedCalcTime = millis();
     
+    // 网页任务放在核 0（与 Wi-Fi 协议栈同核），主循环在核 1；此前连上的客户端在排队等待
+    publishWebState();
+    xTaskCreatePinnedToCore(webTask, "web", WEB_TASK_STACK, NULL, WEB_TASK_PRIORITY, &webTaskHandle, WEB_TASK_CORE);
+    Serial.printf("Web task on core %d, control loop on core %d\n", WEB_TASK_CORE, xPortGetCoreID());
+    
     Serial.println("System Ready");
 }
 
 void loop() {
-    // 轮询处理 Web 请求
-    server.handleClient(); 
+    loopStats.record(micros());
+    // 网页请求在网页任务中处理，这里只取出排队的命令
+    processWebCommands();
+    processTeleop();
     if (isViveActive) {
         // Process VIVE tracking data
         processViveData(viveFront, viveXFront, viveYFront);
@@ -808,6 +1779,7 @@ void loop() {
         // VIVE_ANGLE_OFFSET 表示车辆前进方向相对于连线方向的偏移
         // 如果角度方向不对，可以调整 VIVE_ANGLE_OFFSET 的值（如改为 -90.0）
         viveAngle = (180.0 / PI) * atan2f(deltaY, deltaX) + VIVE_ANGLE_OFFSET;
+        viveStampUs = micros();
         
         // Normalize angle to -180 to 180 range
         if (viveAngle > 180.0) {
@@ -817,74 +1789,75 @@ void loop() {
         }
     }
     calculateSpeed();
+    updateSlip();
     
     //PID control
     if (controlFlag) {
         controlFlag = false;
+        servantParams.applyPending();   // 参数在控制周期边界生效
         
-        pwmOutputL = pidControlL();
-        pwmOutputR = pidControlR();
+        int newPwmL = pidControlL();
+        int newPwmR = pidControlR();
+        
+        // 打滑（及其保持期）内限制 PWM 斜率
+        if (slipEstimator.isLimiting(millis())) {
+            newPwmL = slewLimitPWM(newPwmL, pwmOutputL, slipPwmSlew);
+            newPwmR = slewLimitPWM(newPwmR, pwmOutputR, slipPwmSlew);
+        }
+        pwmOutputL = newPwmL;
+        pwmOutputR = newPwmR;
         
         setMotorL(pwmOutputL);
         setMotorR(pwmOutputR);
+        wsFlushAcks();   // 本周期生效的网页命令回 ack
+        if (scope.isRecording()) {
+            scope.record(ScopeSample{(uint16_t)millis(), scopeModeBits(), 0,
+                scopeQuantize(targetSpeedL, SCOPE_RPM_SCALE), scopeQuantize(speedL, SCOPE_RPM_SCALE),
+                scopeQuantize(pidStateL.error, SCOPE_RPM_SCALE), scopeQuantize(pidStateL.ki * pidStateL.integral),
+                (int16_t)pwmOutputL,
+                scopeQuantize(targetSpeedR, SCOPE_RPM_SCALE), scopeQuantize(speedR, SCOPE_RPM_SCALE),
+                scopeQuantize(pidStateR.error, SCOPE_RPM_SCALE), scopeQuantize(pidStateR.ki * pidStateR.integral),
+                (int16_t)pwmOutputR}, millis());
+        }
+        poseHistory.push(PoseSample{0, (uint32_t)millis(), viveX, viveY, viveAngle,
+                                    speedL, speedR, targetSpeedL, targetSpeedR});
     }
+    publishWebState();
     
     // 串口命令（用于测试，USB直接供电时启用）
-    if (Serial.available()) {
-        String cmd = Serial.readStringUntil('\n');
-        cmd.trim();
-        cmd.toUpperCase();
-        
-        // VIVE测试命令
-        if (cmd == "VIVE_TEST_ON" || cmd == "TEST_ON") {
-            isViveTestMode = true;
-            isViveActive = true;
-            Serial.println("✅ VIVE 测试模式已启用 - 每200ms输出详细数据");
-            Serial.println("   发送 'VIVE_TEST_OFF' 或 'TEST_OFF' 关闭测试模式");
-        }
-        else if (cmd == "VIVE_TEST_OFF" || cmd == "TEST_OFF") {
-            isViveTestMode = false;
-            Serial.println("❌ VIVE 测试模式已关闭");
-        }
-        else if (cmd == "VIVE_ON") {
-            isViveActive = true;
-            Serial.println("✅ VIVE 系统已激活");
-        }
-        else if (cmd == "VIVE_OFF") {
-            isViveActive = false;
-            isViveTestMode = false;
-            Serial.println("❌ VIVE 系统已关闭");
-        }
-        else if (cmd == "VIVE_STATUS" || cmd == "STATUS") {
-            Serial.println("═══════════════════════════════════════");
-            Serial.println("📍 VIVE 系统状态");
-            Serial.println("───────────────────────────────────────");
-            Serial.printf("系统激活: %s\n", isViveActive ? "是" : "否");
-            Serial.printf("测试模式: %s\n", isViveTestMode ? "是" : "否");
-            Serial.printf("跟踪器1状态 (车后左边): %d (0=无信号, 1=仅同步, 2=接收中)\n", viveFront.getStatus());
-            Serial.printf("跟踪器2状态 (车后右边): %d (0=无信号, 1=仅同步, 2=接收中)\n", viveBack.getStatus());
-            Serial.printf("当前坐标: X=%.2f, Y=%.2f\n", viveX, viveY);
-            Serial.printf("当前角度: %.2f°\n", viveAngle);
-            Serial.println("═══════════════════════════════════════");
-        }
-        else {
-            // 其他命令交给handleCommand处理
-            handleCommand(cmd);
+    // USB 串口可能是 USB-CDC，没有 UART 事件任务：按已到字节拼行，不等待
+    while (Serial.available()) {
+        if (consoleLink.feed(Serial.read()) == LINK_RX_TEXT) {
+            runCommand(consoleLink.text(), CMD_SRC_SERIAL);
+            break;
         }
     }
 
     //commands from owner (UART)
-        // ===== commands from owner (UART) =====
-    if (OwnerSerial.available()) {
-    String cmd = OwnerSerial.readStringUntil('\n');
-    Serial.print("[OWNER CMD] ");
-    Serial.println(cmd);
+    // ===== commands from owner (UART)：二进制帧与 ASCII 行混合 =====
+    static LinkRxItem ownerItem;
+    while (ownerRx.poll(ownerItem)) {
+        if (ownerItem.kind == LINK_RX_MESSAGE) {
+            handleOwnerMessage(ownerItem.msg, ownerItem.rxUs);
+        } else {
+            Serial.print("[OWNER CMD] ");
+            Serial.println(ownerItem.text);
+            runCommand(ownerItem.text, CMD_SRC_OWNER);
+        }
+    }
 
-    //OwnerSerial.print("[SERVANT CMD] ");
-    //OwnerSerial.println(cmd);
+    if (webWantsOwnerParams) {
+        webWantsOwnerParams = false;
+        OwnerSerial.println("PARAM_LIST");
+    }
 
-    handleCommand(cmd);
-}
+    // 链路监督：发心跳；Owner 掉线且当前在执行 Owner 的运动命令时立即停车
+    ownerSup.service(ownerLink, OwnerSerial, millis());
+    if (ownerSup.checkLost(millis())) {
+        Serial.printf("[LINK] owner heartbeat lost (> %lu ms)%s\n", (unsigned long)ownerSup.getTimeout(),
+                      motionFromOwner ? " -> STOP" : "");
+        if (motionFromOwner) stopMotors();
+    }
 
     
     // update status 
@@ -894,10 +1867,10 @@ void loop() {
         
         if (targetSpeedL != 0 || targetSpeedR != 0) {
             Serial.printf("⚙ L: target=%5.1f current=%5.1f error=%+5.1f PWM=%4d | ", 
-                         targetSpeedL, speedL, errorL, pwmOutputL);
+                         targetSpeedL, speedL, pidStateL.error, pwmOutputL);
             Serial.printf("R: target=%5.1f current=%5.1f error=%+5.1f PWM=%4d | ", 
-                         targetSpeedR, speedR, errorR, pwmOutputR);
-            Serial.printf("Kp=%.2f\n", Kp);  // show current kp
+                         targetSpeedR, speedR, pidStateR.error, pwmOutputR);
+            Serial.printf("Kp=%.2f/%.2f\n", pidStateL.kp, pidStateR.kp);  // show current kp
         }
         
         // Print VIVE data periodically
@@ -946,14 +1919,17 @@ void loop() {
         static unsigned long lastViveUartTime = 0;
         if (millis() - lastViveUartTime > 100 && isViveActive) {
             lastViveUartTime = millis();
-            // Format: "VIVE:x.xx,y.yy,a.aa\n"
-            OwnerSerial.printf("VIVE:%.2f,%.2f,%.2f\n", viveX, viveY, viveAngle);
+            // 二进制 LINK_POSE 帧（原 ASCII 格式为 "VIVE:x.xx,y.yy,a.aa\n"）
+            ownerLink.sendPose(OwnerSerial, viveX, viveY, viveAngle, viveStampUs);
         }
     }
     
     // 本地序列执行（直行/转向按时间）
     seqProcess();
     
+    // 里程计标定（UMBmark 正方形）
+    processOdomCal();
+    
     //TopHat update
     if (millis() - lastTopHatTime > 500) {
         lastTopHatTime = millis();
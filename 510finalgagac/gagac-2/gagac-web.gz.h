@@ -0,0 +1,624 @@
+// Generated by tools/build_web_assets.py from gagac-web.h (35455 bytes minified, 9788 bytes gzip). Do not edit.
+#ifndef GAGAC_WEB_GZ_H
+#define GAGAC_WEB_GZ_H
+
+#include <Arduino.h>
+
+const char webpage_etag[] = "\"48389c00477e52e7\"";
+const size_t webpage_gz_len = 9788;
+const uint8_t webpage_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x6b, 0x73, 0x23, 0xc7,
+  0x91, 0xe0, 0x77, 0xfc, 0x8a, 0x52, 0x7b, 0xe5, 0x05, 0x3c, 0x20, 0x08, 0x80, 0x04, 0x5f, 0x20,
+  0x39, 0x37, 0x33, 0x24, 0xad, 0x59, 0x93, 0x22, 0x4d, 0x52, 0x92, 0xe7, 0x18, 0x0c, 0xa9, 0x01,
+  0x34, 0x88, 0x16, 0x01, 0x34, 0xd4, 0xdd, 0xe0, 0x43, 0x63, 0x46, 0x8c, 0x7c, 0x5e, 0x6b, 0x46,
+  0x8f, 0x1d, 0xc9, 0xa1, 0xc7, 0x49, 0x96, 0xc3, 0x96, 0xc3, 0x27, 0x29, 0xe2, 0x2c, 0xc9, 0x1b,
+  0xb6, 0x1e, 0xb6, 0x46, 0x56, 0xc4, 0xfe, 0x80, 0xfb, 0x11, 0xbb, 0x02, 0x87, 0xf3, 0x69, 0xfe,
+  0xc2, 0x65, 0x66, 0x3d, 0xba, 0xfa, 0x81, 0x07, 0xc7, 0xd6, 0x5a, 0xb7, 0x71, 0x9a, 0x10, 0x81,
+  0xae, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0x47, 0x55, 0x76, 0x61, 0xfe, 0xa1, 0xa5, 0xf5, 0x2b,
+  0xdb, 0xd7, 0x36, 0x96, 0x59, 0xc3, 0x6f, 0x35, 0x17, 0x53, 0xf3, 0xf8, 0xc1, 0x9a, 0x66, 0x7b,
+  0x6f, 0xc1, 0xb0, 0xda, 0x06, 0x16, 0x58, 0x66, 0x0d, 0x3e, 0x5a, 0x96, 0x6f, 0xb2, 0x6a, 0xc3,
+  0x74, 0x3d, 0xcb, 0x5f, 0x30, 0x1e, 0xdb, 0x5e, 0x19, 0x9b, 0x31, 0x64, 0x71, 0xdb, 0x6c, 0x59,
+  0x0b, 0xc6, 0x81, 0x6d, 0x1d, 0x76, 0x1c, 0xd7, 0x37, 0x58, 0xd5, 0x69, 0xfb, 0x56, 0x1b, 0xc0,
+  0x0e, 0xed, 0x9a, 0xdf, 0x58, 0xa8, 0x59, 0x07, 0x76, 0xd5, 0x1a, 0xa3, 0x87, 0x2c, 0xb3, 0xdb,
+  0xb6, 0x6f, 0x9b, 0xcd, 0x31, 0xaf, 0x6a, 0x36, 0xad, 0x85, 0x42, 0x2e, 0x8f, 0x68, 0x7c, 0xdb,
+  0x6f, 0x5a, 0x8b, 0x6b, 0x4e, 0xc5, 0x6e, 0x5a, 0xec, 0xb2, 0xe9, 0x59, 0xec, 0x0a, 0xe0, 0x70,
+  0x9d, 0xe6, 0xfc, 0x38, 0xaf, 0x4a, 0xcd, 0x7b, 0xfe, 0x31, 0x7e, 0x56, 0x9c, 0xda, 0x31, 0xbb,
+  0x9e, 0xaa, 0x98, 0xd5, 0xfd, 0x3d, 0xd7, 0xe9, 0xb6, 0x6b, 0x73, 0xec, 0x3b, 0xf5, 0xc9, 0xfa,
+  0x74, 0x7d, 0xaa, 0x9c, 0xaa, 0x43, 0x9b, 0xb1, 0xba, 0xd9, 0xb2, 0x9b, 0xc7, 0x73, 0xcc, 0xd8,
+  0x70, 0x3a, 0x1d, 0xbb, 0xed, 0x19, 0x59, 0xe6, 0x99, 0x6d, 0x6f, 0xcc, 0xb3, 0x5c, 0xbb, 0x5e,
+  0x4e, 0xd5, 0x6c, 0xaf, 0xd3, 0x34, 0xa1, 0xbe, 0xde, 0xb4, 0x8e, 0xca, 0xa9, 0xa7, 0xbb, 0x9e,
+  0x6f, 0xd7, 0x8f, 0xc7, 0x04, 0xc9, 0x73, 0xac, 0x0a, 0x7f, 0x2d, 0xb7, 0x9c, 0x32, 0x9b, 0xf6,
+  0x5e, 0x7b, 0xcc, 0xf6, 0xad, 0x96, 0xc7, 0x61, 0xc7, 0x3c, 0xdf, 0x74, 0xfd, 0x72, 0xaa, 0x65,
+  0xb7, 0xc7, 0x1a, 0x96, 0xbd, 0xd7, 0x00, 0xe0, 0x42, 0x3e, 0x7f, 0xd0, 0x80, 0x22, 0xd3, 0xdd,
+  0xb3, 0xdb, 0x73, 0x2c, 0x5f, 0x4e, 0x75, 0xcc, 0x5a, 0xcd, 0x6e, 0xef, 0xcd, 0xb1, 0x62, 0xbe,
+  0x73, 0x84, 0x05, 0x27, 0xa9, 0x5c, 0x95, 0x0f, 0x65, 0xac, 0x6a, 0xba, 0xb5, 0x18, 0xe9, 0x75,
+  0xa0, 0xa9, 0xe2, 0xb8, 0x35, 0xcb, 0x1d, 0x73, 0xcd, 0x9a, 0xdd, 0x85, 0xde, 0x8a, 0x93, 0x9d,
+  0x23, 0x2c, 0x84, 0x2e, 0x1b, 0x66, 0xcd, 0x39, 0x04, 0xc4, 0xac, 0x50, 0x04, 0x74, 0x13, 0x88,
+  0xd3, 0xdd, 0xab, 0x98, 0xe9, 0x7c, 0x96, 0xfe, 0xe5, 0xf2, 0x33, 0x19, 0xbd, 0x4f, 0x6a, 0x48,
+  0x7c, 0x9e, 0x63, 0x13, 0x48, 0x41, 0x39, 0xe5, 0x5b, 0x47, 0xfe, 0x18, 0x0d, 0x26, 0x18, 0x1b,
+  0xa7, 0x77, 0xcc, 0x77, 0x3a, 0x38, 0x04, 0x84, 0x3a, 0x49, 0x35, 0x8a, 0x40, 0x5a, 0xd5, 0x69,
+  0x3a, 0x2e, 0x50, 0x35, 0x39, 0x39, 0x29, 0xb8, 0xe9, 0xd9, 0xcf, 0x5a, 0x00, 0x94, 0x9b, 0xb4,
+  0x5a, 0xaa, 0x5d, 0xc5, 0xf1, 0x7d, 0xa7, 0x05, 0xdd, 0x95, 0xb0, 0x29, 0x81, 0x1d, 0x0a, 0x86,
+  0x4c, 0xe5, 0xf9, 0x90, 0xbd, 0xa6, 0x8d, 0x23, 0xc2, 0x61, 0x76, 0x00, 0x6f, 0x62, 0x43, 0x9d,
+  0xb2, 0xa6, 0x55, 0xf7, 0xb1, 0x61, 0xd3, 0xac, 0x58, 0x4d, 0x68, 0xa0, 0xf5, 0x9d, 0xcf, 0xcd,
+  0x62, 0xdf, 0x92, 0xb4, 0xa9, 0xa9, 0xa9, 0x48, 0x9f, 0x25, 0xec, 0x53, 0xf4, 0x80, 0x78, 0x00,
+  0x3f, 0x1f, 0x92, 0xdd, 0xee, 0x74, 0xfd, 0x1d, 0xff, 0xb8, 0x63, 0x2d, 0xb8, 0x20, 0xd0, 0xd6,
+  0x2e, 0x20, 0x86, 0x56, 0x95, 0x7d, 0x1b, 0xfa, 0xed, 0x74, 0x2c, 0x13, 0x4a, 0xab, 0xd0, 0x43,
+  0xdb, 0x69, 0x5b, 0x8a, 0x6d, 0x30, 0xa5, 0x0f, 0x47, 0x38, 0x44, 0xe8, 0xe4, 0x94, 0xcf, 0xf0,
+  0xb9, 0x09, 0x4d, 0x18, 0x0d, 0x27, 0x34, 0xad, 0x56, 0x15, 0xff, 0x95, 0x53, 0x4e, 0xd7, 0x6f,
+  0xda, 0x6d, 0xd5, 0x47, 0xb5, 0xeb, 0x7a, 0x38, 0x8a, 0x8e, 0x63, 0xf3, 0x99, 0x48, 0x20, 0x72,
+  0x6e, 0x4e, 0xd2, 0x28, 0x98, 0xe8, 0x37, 0xba, 0xad, 0xca, 0x40, 0xd2, 0xfb, 0x0e, 0x86, 0x8b,
+  0x80, 0x24, 0x9d, 0x3f, 0x45, 0x69, 0xc7, 0xe1, 0x86, 0x68, 0x9f, 0x2d, 0x5e, 0xc9, 0xcf, 0x2c,
+  0x47, 0x05, 0x10, 0xe5, 0xaf, 0x14, 0x15, 0xbf, 0x62, 0x26, 0x61, 0x4c, 0x3e, 0x50, 0xe2, 0xc1,
+  0x1a, 0x77, 0x60, 0x5e, 0xe9, 0x7b, 0xdd, 0x71, 0x5b, 0x30, 0x8d, 0x05, 0xef, 0x1c, 0xe3, 0x9d,
+  0x6b, 0x38, 0x07, 0x96, 0x0b, 0xa3, 0x56, 0x18, 0xe6, 0x18, 0x69, 0x8c, 0x74, 0x21, 0x57, 0xc8,
+  0x84, 0x96, 0x15, 0x88, 0x3f, 0xc0, 0xa9, 0x75, 0xbd, 0xe7, 0xda, 0xb5, 0x72, 0x0a, 0xff, 0x8e,
+  0xc1, 0xe2, 0x85, 0x32, 0xdf, 0x82, 0xd5, 0xdd, 0xec, 0xb6, 0xda, 0x30, 0xda, 0x19, 0x5c, 0x41,
+  0xea, 0x4f, 0x14, 0xcc, 0x75, 0x0e, 0x13, 0x60, 0x46, 0x53, 0x11, 0x89, 0x6b, 0x8b, 0x04, 0x23,
+  0x51, 0xf8, 0x81, 0xfe, 0x8a, 0xdf, 0x8e, 0x6a, 0x83, 0x80, 0xf5, 0x38, 0x47, 0x4a, 0x6a, 0xb8,
+  0xe8, 0x1f, 0x36, 0xa0, 0xab, 0xc8, 0xb2, 0x2c, 0xe2, 0xd2, 0x88, 0xcc, 0x68, 0x61, 0x52, 0x9f,
+  0xf4, 0xa9, 0xbc, 0xa6, 0x13, 0xf8, 0xc3, 0xc0, 0x19, 0x33, 0x9b, 0x4d, 0x98, 0xab, 0xa2, 0xc7,
+  0x2c, 0xd0, 0xc2, 0x51, 0x21, 0x00, 0xcc, 0xa4, 0x30, 0xb8, 0x14, 0x14, 0x26, 0xa7, 0xb2, 0xac,
+  0x30, 0x5b, 0x84, 0x3f, 0x93, 0xf0, 0x27, 0x9f, 0x9b, 0xcc, 0xc8, 0x81, 0xcd, 0x99, 0x55, 0xdf,
+  0x3e, 0xb0, 0x92, 0xe6, 0x0f, 0xd6, 0x73, 0x29, 0x33, 0x50, 0xba, 0x62, 0x78, 0x27, 0x02, 0xbc,
+  0x52, 0x2c, 0x42, 0x6c, 0x9b, 0x29, 0x54, 0x26, 0xa6, 0x6b, 0x04, 0xd3, 0x72, 0x6a, 0xd6, 0x18,
+  0x00, 0x2a, 0xd5, 0x13, 0xd1, 0xf7, 0x7b, 0xe6, 0xd0, 0x79, 0x91, 0x28, 0x50, 0x0d, 0x41, 0x1b,
+  0x00, 0x1f, 0x79, 0x42, 0x70, 0x6c, 0x38, 0x23, 0x71, 0x9d, 0x38, 0x70, 0x8e, 0x4a, 0xa3, 0x4e,
+  0xcb, 0x84, 0x37, 0x78, 0x46, 0x94, 0x59, 0x40, 0x0e, 0x93, 0x7e, 0xd5, 0x2c, 0x08, 0x00, 0x15,
+  0xa3, 0x80, 0x62, 0x29, 0xc9, 0x21, 0x27, 0x4e, 0x1b, 0x7d, 0xc5, 0xf5, 0x71, 0x2d, 0x0d, 0xed,
+  0x33, 0x23, 0x29, 0x06, 0x22, 0xe0, 0x04, 0xf8, 0xe0, 0xf8, 0x34, 0x5d, 0x52, 0x7b, 0x57, 0xab,
+  0xd5, 0x08, 0xc3, 0xa6, 0x4b, 0x9a, 0x65, 0xa1, 0x55, 0x23, 0x27, 0xe2, 0xbf, 0xb5, 0xac, 0x9a,
+  0x6d, 0xb2, 0x74, 0xcb, 0x3c, 0x52, 0x06, 0x77, 0x3a, 0x0f, 0x63, 0xcd, 0xe0, 0xfc, 0x93, 0x1b,
+  0xc0, 0x94, 0xe9, 0x2b, 0x70, 0x73, 0xcb, 0x62, 0xe6, 0x96, 0x85, 0x2c, 0x72, 0x99, 0x89, 0x95,
+  0x30, 0x5b, 0x3a, 0x38, 0x2c, 0x33, 0x44, 0x2d, 0xcd, 0x25, 0xad, 0x0d, 0x68, 0x7f, 0x92, 0x9a,
+  0x1f, 0x17, 0xbe, 0xc6, 0xfc, 0xb8, 0x70, 0x7e, 0xb0, 0x37, 0xf8, 0xa8, 0xd9, 0x07, 0xac, 0xda,
+  0x34, 0x3d, 0x6f, 0xc1, 0xd0, 0x3b, 0x21, 0x2f, 0xa9, 0x98, 0xec, 0xbd, 0x40, 0x79, 0xa8, 0x9d,
+  0x6e, 0x18, 0xb1, 0x1d, 0x37, 0x78, 0xc0, 0x68, 0xa8, 0xea, 0x58, 0x56, 0x6d, 0x8b, 0xea, 0x8d,
+  0xc5, 0x2d, 0x7c, 0x98, 0x63, 0xf3, 0x5e, 0xc7, 0x6c, 0x33, 0xbb, 0x26, 0x6a, 0x1f, 0x37, 0x9b,
+  0xc6, 0x22, 0x68, 0x6c, 0xa0, 0x10, 0xca, 0x17, 0xe7, 0xc7, 0xa9, 0x39, 0xa0, 0x21, 0xad, 0xca,
+  0x48, 0xab, 0x1a, 0xa4, 0x56, 0x8d, 0xa0, 0x91, 0x40, 0xc9, 0xc0, 0x71, 0x59, 0x30, 0xf2, 0x06,
+  0x0e, 0x7a, 0xc1, 0x00, 0x33, 0x67, 0xb0, 0x03, 0xb3, 0xd9, 0x85, 0x06, 0x25, 0x72, 0xc1, 0xc6,
+  0x81, 0xca, 0x91, 0x69, 0xf5, 0xbb, 0x6e, 0x5b, 0x92, 0xba, 0x0d, 0xdf, 0xd9, 0x0a, 0x48, 0x0e,
+  0xce, 0x70, 0x40, 0x30, 0x82, 0x10, 0xbd, 0x13, 0xa3, 0xd3, 0xab, 0xa1, 0xed, 0x4f, 0xee, 0x44,
+  0x1f, 0x72, 0x35, 0x7b, 0x60, 0xf0, 0x9a, 0x45, 0x09, 0x55, 0xe9, 0xc2, 0x1a, 0x6f, 0x4b, 0x40,
+  0x10, 0x74, 0xde, 0x1d, 0x7c, 0x59, 0x31, 0x16, 0x57, 0xe6, 0xc7, 0x79, 0xfd, 0xc8, 0x8d, 0x56,
+  0x8d, 0xc5, 0x55, 0xad, 0x51, 0x7f, 0xc0, 0x2d, 0x98, 0xc8, 0x91, 0x00, 0x37, 0x8d, 0xc5, 0xcd,
+  0x73, 0x93, 0x71, 0xd9, 0x58, 0xbc, 0xdc, 0xa7, 0x51, 0x9c, 0x3b, 0x61, 0xc5, 0x68, 0xc4, 0x10,
+  0xcb, 0x7a, 0x85, 0xfd, 0x52, 0xd7, 0x77, 0x0c, 0x46, 0x2b, 0x01, 0x9e, 0x03, 0x75, 0xfb, 0x9d,
+  0x95, 0xe9, 0xe5, 0xe2, 0x6c, 0xbe, 0x0c, 0x28, 0xb6, 0xd0, 0x23, 0x66, 0x08, 0x98, 0xea, 0x3b,
+  0xca, 0x18, 0xde, 0xc7, 0x41, 0xc1, 0x24, 0xe2, 0x5d, 0x9e, 0x9e, 0x5d, 0xba, 0x32, 0x81, 0x78,
+  0x97, 0xdb, 0x66, 0x05, 0x56, 0xd2, 0xe3, 0x57, 0x1f, 0x5f, 0xd6, 0x11, 0x0f, 0x1d, 0x94, 0xc4,
+  0xaa, 0x69, 0x13, 0x72, 0x6f, 0x47, 0x18, 0xed, 0xb6, 0xd5, 0xb4, 0x9c, 0x4e, 0x22, 0x5d, 0x95,
+  0x52, 0xad, 0x54, 0x2d, 0xf1, 0xf1, 0xba, 0x96, 0xd9, 0x62, 0x1c, 0x36, 0x81, 0x32, 0xaf, 0x85,
+  0x6a, 0x9a, 0x04, 0x19, 0x40, 0xae, 0xb6, 0xeb, 0x01, 0x03, 0xb9, 0x02, 0xfc, 0xce, 0xf4, 0xf4,
+  0x74, 0x99, 0x49, 0x93, 0x54, 0x69, 0x3a, 0xd5, 0x7d, 0x54, 0x42, 0x8a, 0xda, 0x29, 0x22, 0xd6,
+  0x27, 0xfc, 0x73, 0xcc, 0xa9, 0xd7, 0x61, 0xe1, 0x20, 0xce, 0x6f, 0x6a, 0xd4, 0x6b, 0xc9, 0x23,
+  0x9e, 0xad, 0x57, 0x4b, 0xd6, 0x4c, 0x30, 0xc3, 0x6b, 0x66, 0xbb, 0x6b, 0x36, 0xd9, 0x06, 0x84,
+  0x85, 0xe7, 0x98, 0xe8, 0x2d, 0xab, 0x5d, 0xdb, 0x04, 0x07, 0x38, 0x79, 0xb6, 0xcd, 0xc9, 0xda,
+  0xb4, 0x39, 0x4d, 0x7d, 0x00, 0x1c, 0x23, 0xc0, 0xc1, 0x93, 0x1d, 0x52, 0x47, 0x83, 0x06, 0xad,
+  0xe9, 0x29, 0x17, 0xd1, 0x5e, 0x45, 0x65, 0x03, 0x0b, 0x0c, 0xbf, 0xb3, 0xf4, 0x51, 0xf6, 0x38,
+  0x8b, 0x6a, 0x1d, 0x6c, 0x42, 0xb6, 0xd2, 0x6d, 0x75, 0xbc, 0x72, 0x2e, 0x97, 0xcb, 0x04, 0xaa,
+  0x09, 0xcd, 0xa6, 0x09, 0xf3, 0x4c, 0xc3, 0xd0, 0xda, 0xcb, 0x1e, 0xb9, 0xbd, 0xa0, 0x30, 0x81,
+  0x09, 0xb3, 0x34, 0x4d, 0xa6, 0x43, 0x23, 0x05, 0x83, 0x04, 0x16, 0x36, 0xf9, 0x44, 0x9d, 0x28,
+  0x9b, 0x43, 0x5b, 0xec, 0x39, 0x30, 0x1e, 0xf6, 0x9d, 0x5a, 0xad, 0x56, 0x56, 0x36, 0x8a, 0xda,
+  0x05, 0xe6, 0x91, 0x87, 0x3e, 0xa0, 0xf1, 0x0b, 0xc5, 0x7c, 0x76, 0x32, 0x3f, 0x93, 0xcf, 0xce,
+  0x82, 0x71, 0x2d, 0x4f, 0x4e, 0x4d, 0x15, 0xb2, 0x93, 0x85, 0xa9, 0xc9, 0x6c, 0x61, 0x26, 0xfc,
+  0x3c, 0x06, 0xf5, 0x85, 0xf2, 0x24, 0x44, 0x44, 0xd9, 0xd2, 0x4c, 0x9e, 0xc0, 0x27, 0x21, 0x82,
+  0x16, 0x23, 0x52, 0x12, 0x1a, 0x97, 0x49, 0x63, 0xf1, 0xee, 0x6f, 0xff, 0xfc, 0xf5, 0x5f, 0x5e,
+  0x9c, 0x63, 0x31, 0xf6, 0xb0, 0xde, 0x6f, 0xdf, 0xbe, 0xfb, 0xc5, 0x4f, 0xef, 0xbe, 0xf6, 0x41,
+  0xef, 0xe6, 0xcf, 0x7a, 0xb7, 0x3f, 0x83, 0xbf, 0xf7, 0xde, 0x7e, 0x2d, 0x10, 0xcc, 0x6f, 0x72,
+  0x55, 0x6e, 0x59, 0xcf, 0x90, 0x04, 0x26, 0x4a, 0x50, 0xbd, 0x6e, 0xce, 0x4e, 0xd6, 0x02, 0x29,
+  0x05, 0xe0, 0xae, 0x05, 0x31, 0xd0, 0xb9, 0x44, 0x14, 0xf0, 0xf7, 0x59, 0xf6, 0x75, 0xe0, 0xf7,
+  0x8c, 0x50, 0x73, 0x4e, 0x27, 0x11, 0xfb, 0xdf, 0x46, 0x46, 0x3d, 0xeb, 0x19, 0x21, 0xa1, 0xb2,
+  0x0f, 0x96, 0x5e, 0x5b, 0x5f, 0x5a, 0xce, 0x6e, 0x6d, 0x2c, 0x2f, 0x2f, 0x8d, 0x2f, 0x59, 0x7b,
+  0xae, 0x65, 0x65, 0x97, 0xba, 0xae, 0x89, 0xae, 0xe0, 0xda, 0x40, 0x79, 0x55, 0xb8, 0xfe, 0x8e,
+  0xd2, 0xba, 0x92, 0x2d, 0x81, 0xf8, 0xa1, 0xd7, 0xbb, 0x05, 0xbe, 0x20, 0x74, 0x5d, 0x5e, 0xc5,
+  0xbf, 0xd9, 0x02, 0x88, 0xe5, 0x88, 0xc2, 0x78, 0xfa, 0xc1, 0xbb, 0xbd, 0x3b, 0xb7, 0xd9, 0xca,
+  0xf8, 0xe5, 0xf1, 0xd5, 0xf1, 0xcd, 0xf1, 0xad, 0xfb, 0x77, 0x6e, 0x6e, 0x2d, 0x9c, 0xbe, 0xfd,
+  0x93, 0xde, 0x73, 0xef, 0x8c, 0xc3, 0xff, 0x67, 0x5f, 0xbe, 0x77, 0xff, 0xce, 0xad, 0xfb, 0x77,
+  0x5e, 0x3a, 0x7d, 0xfd, 0xf7, 0xbd, 0x1b, 0x77, 0x16, 0xee, 0xdd, 0xf8, 0x55, 0xef, 0xcf, 0xef,
+  0x9d, 0xde, 0x7c, 0xe3, 0xec, 0xcb, 0xdf, 0xf5, 0x5e, 0x79, 0xb5, 0xf7, 0xc2, 0x2f, 0xe0, 0x11,
+  0xab, 0x5f, 0x7a, 0xee, 0xee, 0x17, 0x1f, 0x9e, 0xbe, 0xf9, 0xe9, 0xbd, 0x37, 0xff, 0xc8, 0x5a,
+  0xde, 0xfd, 0x3b, 0xbf, 0x88, 0x48, 0xf1, 0x7f, 0xdc, 0xf8, 0x09, 0x97, 0xfb, 0xfb, 0x77, 0xde,
+  0x26, 0xb2, 0x8b, 0x79, 0x41, 0x76, 0x89, 0xc8, 0x86, 0xe5, 0x85, 0xe3, 0xa0, 0x2a, 0x4e, 0xbe,
+  0xae, 0x8e, 0xe3, 0xd3, 0x4b, 0x1c, 0x91, 0xea, 0x9d, 0x02, 0x0e, 0x86, 0x01, 0xc7, 0xe8, 0xe2,
+  0xde, 0xae, 0x81, 0x0c, 0xa8, 0xc9, 0xa3, 0xf0, 0xa3, 0x00, 0xf3, 0x90, 0xa4, 0x37, 0x49, 0x6d,
+  0x4a, 0x89, 0x89, 0x0b, 0xe5, 0xf9, 0x65, 0x53, 0x38, 0xc8, 0x62, 0x76, 0xf5, 0x22, 0x21, 0x1b,
+  0x3c, 0xa6, 0x0d, 0x84, 0xa1, 0x9e, 0xc7, 0x7f, 0x34, 0xb0, 0xc6, 0x84, 0xa2, 0x39, 0xba, 0x73,
+  0xc3, 0xa4, 0xef, 0x3f, 0x33, 0x33, 0xa3, 0xc4, 0x4e, 0x06, 0x5d, 0x5c, 0xce, 0xf4, 0x70, 0x09,
+  0x19, 0x6f, 0x2c, 0xae, 0xd7, 0x9c, 0x96, 0xe5, 0xbb, 0xc7, 0xec, 0x0a, 0x04, 0xd9, 0x15, 0x2e,
+  0xf9, 0x2c, 0xfd, 0xd8, 0xda, 0x65, 0x68, 0xbf, 0x0f, 0xc2, 0xdf, 0x98, 0x08, 0xcf, 0x41, 0x1f,
+  0x9e, 0x87, 0xa4, 0x73, 0xa6, 0x14, 0x50, 0x43, 0xdb, 0x48, 0xc1, 0x3a, 0x0c, 0xf3, 0xdb, 0x58,
+  0x3c, 0xfb, 0xcb, 0x9f, 0xee, 0xbd, 0xfe, 0x15, 0x6b, 0xb5, 0x98, 0xf0, 0x54, 0x71, 0x82, 0x20,
+  0x7a, 0xdd, 0x02, 0x0e, 0x1a, 0xc2, 0x6d, 0x6d, 0x77, 0x5b, 0x15, 0xf4, 0x53, 0x85, 0x57, 0x0a,
+  0x12, 0x9e, 0x17, 0x4e, 0x6b, 0x11, 0xbf, 0x79, 0xbe, 0xd5, 0x11, 0x7e, 0x6b, 0x7c, 0x29, 0x1a,
+  0x9a, 0x2b, 0x9c, 0x4c, 0xc1, 0xe9, 0xc7, 0xb7, 0x4f, 0xdf, 0xf8, 0x13, 0x0a, 0xf3, 0x3b, 0x37,
+  0x41, 0xca, 0x23, 0x74, 0x6c, 0x76, 0xdb, 0x5e, 0x3f, 0x3a, 0x04, 0x11, 0x05, 0xe1, 0x39, 0x4f,
+  0x0c, 0xeb, 0xff, 0x9b, 0xd4, 0xdf, 0x30, 0x7b, 0xfd, 0xf5, 0x77, 0x20, 0xc9, 0xa4, 0xbe, 0xb5,
+  0x99, 0x1e, 0x5d, 0x81, 0x53, 0x07, 0xc3, 0x14, 0x38, 0x42, 0x24, 0x6b, 0x6d, 0xd1, 0x4a, 0xdb,
+  0x89, 0xa4, 0x8d, 0xc8, 0xc1, 0x62, 0x13, 0x5a, 0x8e, 0xf5, 0x99, 0xfa, 0x6c, 0xdd, 0x0c, 0x74,
+  0x22, 0x6d, 0x16, 0x26, 0x2a, 0xd3, 0x24, 0xf6, 0x21, 0x25, 0x77, 0x5f, 0xf8, 0xf4, 0xf4, 0xc6,
+  0x73, 0x7a, 0xe4, 0x54, 0x25, 0xae, 0x81, 0xdf, 0xb4, 0x68, 0xd7, 0x9a, 0x96, 0x8a, 0x9d, 0x14,
+  0xd9, 0x8b, 0xf7, 0xde, 0xfc, 0xb0, 0xf7, 0xca, 0xcd, 0xb3, 0x8f, 0x3f, 0xee, 0x7d, 0xf6, 0x51,
+  0xa8, 0x19, 0xc4, 0x9e, 0xb6, 0x87, 0x93, 0x4b, 0x4d, 0xe6, 0x58, 0xc5, 0x02, 0x0b, 0x63, 0x2d,
+  0x84, 0x61, 0xa8, 0xcc, 0x58, 0x1c, 0x13, 0x50, 0x20, 0xe5, 0x59, 0x66, 0xd6, 0x21, 0x4e, 0x0f,
+  0xc3, 0x5d, 0xc2, 0xa2, 0x10, 0x98, 0x4e, 0xc2, 0xd2, 0x93, 0xab, 0x61, 0xf0, 0xa5, 0xd5, 0x08,
+  0xca, 0xa5, 0x27, 0x37, 0x23, 0x10, 0x9b, 0x11, 0x88, 0x4a, 0x84, 0xb0, 0xbe, 0x9d, 0xdd, 0x7b,
+  0xfe, 0xa5, 0xbb, 0x1f, 0xbc, 0x78, 0xf6, 0xd1, 0xbb, 0x73, 0xec, 0x47, 0x5a, 0x1b, 0x07, 0x94,
+  0xc4, 0x8f, 0x8c, 0xc5, 0xbc, 0x68, 0x94, 0x65, 0xd7, 0x22, 0x95, 0xd7, 0xf4, 0xca, 0xff, 0xf3,
+  0x79, 0xa4, 0x76, 0xbb, 0x11, 0x54, 0xff, 0xdb, 0xef, 0x23, 0x7a, 0xf3, 0xff, 0x6d, 0xf5, 0x89,
+  0x91, 0x13, 0xdb, 0x76, 0x41, 0x4e, 0x81, 0x14, 0xb6, 0x64, 0xfa, 0x66, 0x5c, 0x65, 0xc6, 0xb6,
+  0xdf, 0x59, 0xa8, 0x6f, 0x5d, 0xec, 0xf9, 0xae, 0x7b, 0xc4, 0xb0, 0xd1, 0x99, 0x48, 0xcd, 0x76,
+  0xad, 0x2a, 0xdf, 0xa1, 0xe2, 0x7b, 0xac, 0xba, 0xf2, 0x7d, 0xa0, 0x75, 0x62, 0x0c, 0x52, 0xec,
+  0xb1, 0xad, 0x58, 0x98, 0xbc, 0x2a, 0x68, 0x04, 0xcb, 0x3f, 0xb4, 0xac, 0xb6, 0x5a, 0x52, 0x57,
+  0x68, 0x2f, 0x96, 0xfd, 0x48, 0x5f, 0x54, 0x07, 0x10, 0x76, 0xfe, 0x88, 0xf6, 0x23, 0xf2, 0x09,
+  0x2b, 0x4a, 0xb4, 0xb8, 0x16, 0x6d, 0x71, 0xad, 0x6f, 0x8b, 0x4b, 0xed, 0xbd, 0xa6, 0x15, 0x05,
+  0xa7, 0xc2, 0x50, 0x93, 0x98, 0x60, 0x0d, 0x36, 0x5a, 0xc4, 0x15, 0xe2, 0xec, 0xa1, 0x8b, 0x3b,
+  0x95, 0xf8, 0x37, 0xca, 0x12, 0xe9, 0x15, 0xe0, 0x41, 0x94, 0xd0, 0xe9, 0x13, 0x71, 0x7e, 0xd7,
+  0xeb, 0x51, 0xf6, 0xce, 0x68, 0xe2, 0x49, 0x0f, 0x51, 0xbc, 0x9a, 0x18, 0xa1, 0xd7, 0x23, 0x75,
+  0x5e, 0xa9, 0x84, 0xc1, 0xef, 0x8a, 0x0b, 0xd5, 0x2c, 0xfd, 0xfd, 0x8d, 0xab, 0xeb, 0x85, 0x12,
+  0xeb, 0x7d, 0xf6, 0x5e, 0x46, 0xe7, 0xc6, 0xa6, 0x79, 0x18, 0x5e, 0x9b, 0x75, 0x04, 0x87, 0xd2,
+  0xbe, 0xeb, 0x53, 0x02, 0x5c, 0x4b, 0x66, 0xef, 0x8a, 0xdd, 0x84, 0x09, 0xc1, 0x2d, 0xb0, 0x18,
+  0x56, 0xac, 0x1a, 0x8c, 0x16, 0x21, 0xfa, 0xe0, 0x45, 0xc5, 0x8a, 0x1b, 0xb0, 0x91, 0x16, 0xbc,
+  0x38, 0xde, 0x24, 0x3e, 0x69, 0x7f, 0x1f, 0xee, 0x5f, 0x06, 0xe4, 0x82, 0xf9, 0x53, 0xac, 0x77,
+  0xfb, 0x0f, 0x83, 0x99, 0x8f, 0xa4, 0x0c, 0xe2, 0xbd, 0xa8, 0x3f, 0x17, 0xeb, 0xb1, 0xcd, 0x40,
+  0xce, 0x4b, 0x80, 0x91, 0x19, 0x8f, 0x0d, 0x86, 0xf0, 0xfd, 0xef, 0xa9, 0x93, 0x13, 0x16, 0x2a,
+  0x1b, 0x49, 0x0b, 0xb1, 0xa4, 0x73, 0xa1, 0x44, 0xcd, 0xfd, 0x00, 0xaa, 0x1f, 0x0f, 0x99, 0x13,
+  0x14, 0x3e, 0x6e, 0x49, 0x71, 0x87, 0x39, 0xe0, 0xef, 0xa1, 0xc7, 0xbd, 0x88, 0x48, 0x84, 0x65,
+  0xd5, 0x67, 0xcd, 0x59, 0x13, 0xda, 0xa4, 0x9d, 0x7a, 0x1d, 0x0f, 0x27, 0x33, 0x8a, 0xf7, 0x64,
+  0x22, 0x3c, 0x40, 0x55, 0xf5, 0xe5, 0x2e, 0xd6, 0xa6, 0x8e, 0x21, 0x41, 0xa2, 0xfb, 0x84, 0x88,
+  0x21, 0x07, 0x8a, 0xa2, 0xc2, 0xd4, 0xbc, 0xd3, 0x21, 0x2f, 0x5e, 0xf9, 0xcb, 0xc6, 0x62, 0x21,
+  0xcf, 0x1e, 0x79, 0x76, 0x7e, 0x9c, 0x57, 0x2c, 0x46, 0x00, 0x8a, 0xe8, 0x39, 0x13, 0x2d, 0x56,
+  0x6d, 0xb1, 0x18, 0x82, 0x8c, 0xe2, 0xc2, 0x1d, 0xe1, 0x89, 0x41, 0xb8, 0x70, 0x87, 0xbb, 0x14,
+  0x41, 0x31, 0xce, 0x91, 0xff, 0xdd, 0x1c, 0x42, 0x69, 0xac, 0xce, 0xbe, 0xfc, 0x08, 0xe2, 0x57,
+  0xb6, 0x1a, 0xda, 0x3b, 0xb7, 0x9a, 0x8f, 0xaf, 0x06, 0xab, 0x82, 0x8d, 0x87, 0xeb, 0xb6, 0xf5,
+  0x3a, 0xb7, 0x03, 0xae, 0xd4, 0xc6, 0x13, 0x6b, 0x61, 0x90, 0x8d, 0xd5, 0xe4, 0x65, 0x28, 0x7a,
+  0xdb, 0x8c, 0xf6, 0xb6, 0x39, 0xa0, 0xb7, 0xcd, 0xe1, 0xbd, 0x6d, 0x26, 0xf7, 0xc6, 0xe3, 0xf8,
+  0x48, 0x5f, 0x6b, 0xe0, 0xc4, 0x7b, 0x81, 0xaf, 0xa7, 0xc3, 0xf7, 0x5e, 0xfd, 0xf2, 0xeb, 0x2f,
+  0x7e, 0xfb, 0xef, 0x3f, 0xfb, 0xf9, 0xe9, 0xad, 0xf7, 0xcf, 0xde, 0x7d, 0x29, 0xd2, 0x70, 0xd5,
+  0xf4, 0x75, 0x17, 0xd1, 0x63, 0xe9, 0xde, 0x9f, 0xfe, 0xd0, 0xfb, 0xe5, 0xf3, 0x31, 0xa8, 0x4b,
+  0x07, 0x7b, 0x01, 0x60, 0x96, 0x9d, 0xbe, 0x73, 0xa3, 0xf7, 0xdb, 0xf7, 0x63, 0x50, 0x6b, 0xe6,
+  0x51, 0x00, 0x95, 0x49, 0x52, 0xf5, 0xfd, 0x26, 0x7d, 0x76, 0x76, 0x16, 0xa6, 0xaf, 0xf7, 0x97,
+  0x1b, 0x67, 0x5f, 0xbd, 0x16, 0x46, 0xbb, 0xe9, 0x87, 0x49, 0x84, 0xce, 0x7f, 0xf9, 0xd5, 0xd7,
+  0x9f, 0xbf, 0x70, 0xf7, 0xc3, 0x5b, 0xbd, 0xbf, 0xfc, 0x73, 0x18, 0xf6, 0x52, 0x35, 0x0a, 0x1b,
+  0xaa, 0x7e, 0xe4, 0x59, 0x8d, 0xed, 0xbd, 0xcf, 0xdf, 0x1f, 0xf7, 0x22, 0x7a, 0xb0, 0x6a, 0xb6,
+  0x0f, 0x4c, 0x8f, 0xc0, 0x1b, 0xb6, 0xe7, 0x6f, 0x34, 0x1d, 0x88, 0xb3, 0x78, 0xc6, 0x8d, 0x31,
+  0x31, 0x05, 0xab, 0x87, 0xef, 0xf7, 0xc0, 0x52, 0x2b, 0x26, 0x06, 0xa1, 0xf1, 0x2d, 0xa0, 0x04,
+  0x31, 0x4e, 0x14, 0xdc, 0xf9, 0x71, 0xde, 0x77, 0x7f, 0x76, 0x4d, 0xc7, 0xd9, 0x05, 0xb3, 0x70,
+  0xf6, 0xd5, 0xab, 0xda, 0x18, 0x91, 0xe8, 0x2d, 0x78, 0xd0, 0x86, 0x19, 0xe2, 0x01, 0xd6, 0x7f,
+  0xdf, 0xec, 0x68, 0xd5, 0xa7, 0xbf, 0x7b, 0xf7, 0xeb, 0xcf, 0x7f, 0x73, 0xfa, 0xeb, 0xcf, 0xfe,
+  0xbf, 0x45, 0x18, 0x6a, 0x11, 0xb6, 0xaa, 0x4e, 0xc7, 0xd2, 0xcf, 0x0f, 0xf1, 0x39, 0xd1, 0x20,
+  0xf0, 0xe9, 0x09, 0x85, 0x9a, 0x51, 0x43, 0x40, 0x8d, 0x1f, 0xb7, 0xad, 0xc3, 0x6f, 0xc4, 0x14,
+  0xd0, 0x29, 0xa5, 0x01, 0xaa, 0xe9, 0x77, 0xa0, 0x9a, 0xfa, 0xa9, 0x70, 0xcb, 0x75, 0x1d, 0x08,
+  0x47, 0x45, 0xd0, 0xdb, 0x07, 0xa8, 0x73, 0xd8, 0x32, 0x16, 0x51, 0x3b, 0x8d, 0xb3, 0xbb, 0xef,
+  0x7f, 0xdc, 0xbb, 0xf9, 0xb3, 0x11, 0xf5, 0x7d, 0xdc, 0x13, 0x9f, 0x0a, 0x3b, 0xe2, 0xe4, 0x87,
+  0x87, 0xa6, 0x51, 0xce, 0x62, 0x74, 0x78, 0xd1, 0x0d, 0xa6, 0x28, 0x17, 0xb7, 0x5d, 0x7b, 0xef,
+  0xfc, 0x5c, 0x4c, 0x60, 0x9a, 0xe5, 0x53, 0xa2, 0x80, 0xb1, 0x78, 0xf7, 0x17, 0x1f, 0x9d, 0xfe,
+  0xfa, 0xf9, 0xb3, 0xcf, 0xfe, 0xd0, 0xbb, 0xfd, 0x3f, 0x47, 0xe2, 0xde, 0xd9, 0xa7, 0xff, 0x7c,
+  0xef, 0xad, 0x57, 0xfa, 0x5a, 0x53, 0xdc, 0x64, 0x91, 0x5b, 0xb0, 0xbd, 0x9b, 0xcf, 0x9f, 0xbe,
+  0xfc, 0x9b, 0x7e, 0x58, 0xdb, 0xce, 0x21, 0x74, 0xff, 0xbf, 0x5f, 0xec, 0xbd, 0xfc, 0x87, 0x24,
+  0x46, 0xdf, 0x7b, 0xf3, 0x03, 0xe8, 0x87, 0x85, 0x0e, 0x7b, 0xe5, 0x6e, 0x95, 0xe2, 0xc7, 0xaa,
+  0x75, 0x60, 0x35, 0x83, 0xa3, 0xe8, 0xe0, 0xdc, 0x57, 0x6c, 0xa0, 0x45, 0x34, 0x57, 0x89, 0xaf,
+  0x12, 0xb4, 0x43, 0xa9, 0xde, 0xad, 0x97, 0x87, 0x20, 0xdf, 0x70, 0x2d, 0x7d, 0x83, 0x2e, 0x76,
+  0xa8, 0x5c, 0x8c, 0xee, 0x8e, 0x95, 0x4a, 0x7c, 0x11, 0xf6, 0x5e, 0xf9, 0x97, 0x61, 0xa8, 0x1d,
+  0xcf, 0x57, 0xb8, 0x27, 0x15, 0xee, 0x42, 0x80, 0x7b, 0xb2, 0x0f, 0xee, 0xa1, 0xbb, 0xc0, 0x88,
+  0xfe, 0x92, 0xdb, 0x1a, 0x6d, 0x1b, 0x18, 0x00, 0xe3, 0x7b, 0x5b, 0x9a, 0x69, 0xe0, 0xc4, 0xf6,
+  0xb7, 0x0d, 0x53, 0xdf, 0x06, 0xdb, 0x10, 0x51, 0x53, 0x74, 0x72, 0x1a, 0x98, 0xc6, 0x79, 0x93,
+  0x35, 0x5c, 0xab, 0xbe, 0x60, 0x8c, 0x53, 0xed, 0x78, 0xcd, 0xf4, 0x4d, 0x83, 0xd5, 0x9c, 0xc3,
+  0x76, 0xd3, 0x31, 0x65, 0x9b, 0x5c, 0xc5, 0x06, 0x4b, 0xa2, 0xbe, 0xce, 0x8f, 0x9b, 0x8b, 0xff,
+  0x25, 0xad, 0x44, 0xe9, 0x6f, 0x6a, 0x25, 0x7a, 0xb7, 0x7f, 0x72, 0xfa, 0xfa, 0xef, 0xcf, 0x7e,
+  0xff, 0x3f, 0x4e, 0x5f, 0xff, 0xa3, 0x50, 0xfb, 0x42, 0x3a, 0x71, 0x32, 0x3a, 0xa6, 0x6b, 0xb6,
+  0xb6, 0x9d, 0xbd, 0xbd, 0x66, 0xe2, 0x19, 0xae, 0xca, 0x57, 0x63, 0xa1, 0xf4, 0x28, 0x16, 0x4a,
+  0x8f, 0x0a, 0xf2, 0x6f, 0x30, 0x49, 0x88, 0xc8, 0x8f, 0x08, 0x0e, 0xa5, 0x54, 0xb2, 0x68, 0xf6,
+  0x53, 0x64, 0x37, 0x8a, 0x0c, 0x47, 0xef, 0x5f, 0x5f, 0xef, 0xdd, 0xb9, 0x91, 0xbc, 0x95, 0xab,
+  0xe8, 0xdd, 0x30, 0xdb, 0xa8, 0x50, 0xa2, 0x53, 0x40, 0xa4, 0x19, 0x51, 0xe0, 0xef, 0xa3, 0x04,
+  0xe0, 0x8e, 0x69, 0xff, 0xb3, 0x28, 0x94, 0x31, 0xa0, 0x3f, 0x97, 0xcb, 0xc9, 0xd3, 0x9f, 0xe4,
+  0xb0, 0x94, 0xe7, 0x3a, 0x2d, 0xae, 0x9a, 0x95, 0xc9, 0x5c, 0x91, 0x6d, 0x5b, 0x66, 0x6b, 0x9a,
+  0x8d, 0xb1, 0x6b, 0x5d, 0x3b, 0xcb, 0x2e, 0x3b, 0x6e, 0x37, 0xcb, 0x7e, 0x08, 0x58, 0x8e, 0xbb,
+  0x20, 0x99, 0x02, 0x32, 0x48, 0x1b, 0xa8, 0xba, 0x76, 0x07, 0xf4, 0x25, 0xc8, 0x85, 0xe7, 0x33,
+  0x2d, 0x67, 0x87, 0x2d, 0x80, 0x94, 0x57, 0xbb, 0x2d, 0x10, 0x85, 0xdc, 0x9e, 0xe5, 0x2f, 0x63,
+  0x8c, 0xd7, 0xf6, 0x2f, 0x1f, 0x5f, 0xad, 0xa5, 0x43, 0xa9, 0x3d, 0x98, 0x85, 0x49, 0x6d, 0x83,
+  0xfc, 0x99, 0x41, 0x4d, 0xb5, 0x2c, 0x1b, 0xd5, 0x52, 0xa6, 0x17, 0x0d, 0xed, 0x12, 0x77, 0xb7,
+  0x42, 0xfd, 0x0d, 0x69, 0x24, 0xd3, 0x80, 0x54, 0x1b, 0x3e, 0x79, 0x1e, 0xb4, 0xb9, 0x9e, 0x5a,
+  0x99, 0xeb, 0xdf, 0x90, 0x92, 0x73, 0x32, 0xd9, 0xd4, 0xe5, 0xc1, 0x30, 0x97, 0x11, 0x66, 0x75,
+  0x30, 0xcc, 0x2a, 0xc2, 0x6c, 0x0e, 0x86, 0xd9, 0x44, 0x98, 0xad, 0xc1, 0x30, 0x5b, 0x46, 0x26,
+  0x75, 0x52, 0x4e, 0xd5, 0xbb, 0x6d, 0xda, 0xf3, 0x64, 0xdd, 0x0e, 0xa8, 0x22, 0x8b, 0xb3, 0xf2,
+  0xb2, 0x5a, 0x17, 0x69, 0xae, 0x5d, 0x32, 0x94, 0xf6, 0x86, 0x23, 0x26, 0x23, 0x01, 0xe3, 0x15,
+  0x15, 0x39, 0xfe, 0x3c, 0xc6, 0xc4, 0x23, 0xd8, 0x8d, 0x0c, 0x38, 0x2c, 0xb2, 0x16, 0xcc, 0x47,
+  0xa4, 0xee, 0x7b, 0x98, 0x94, 0x5c, 0x4e, 0x89, 0x22, 0x92, 0xd1, 0x5c, 0xb0, 0x0c, 0x01, 0xf1,
+  0x53, 0x18, 0xc6, 0x9b, 0xa8, 0xcf, 0x40, 0x54, 0x81, 0xe0, 0xb4, 0xef, 0x30, 0x17, 0x57, 0x79,
+  0x56, 0x2e, 0x51, 0x96, 0x7f, 0x38, 0xf8, 0xfe, 0x0f, 0xd7, 0x89, 0x82, 0x13, 0x2c, 0xe2, 0x89,
+  0xca, 0x49, 0x45, 0x68, 0x07, 0x32, 0x4f, 0x61, 0x22, 0x5e, 0xbf, 0x61, 0x06, 0x12, 0x08, 0x93,
+  0xdb, 0x07, 0x28, 0x90, 0xb5, 0x40, 0x00, 0x78, 0x6e, 0xd1, 0x20, 0xa1, 0x91, 0xe9, 0x47, 0xd0,
+  0xa6, 0x69, 0xf9, 0xcc, 0x84, 0xef, 0x18, 0x35, 0x42, 0x93, 0xba, 0xd9, 0xa4, 0xb4, 0x54, 0x0e,
+  0x90, 0x73, 0xda, 0xd5, 0xa6, 0x5d, 0xdd, 0x47, 0xe6, 0x66, 0xd8, 0xc2, 0x22, 0xb0, 0x5c, 0x83,
+  0x7d, 0x48, 0x7e, 0x2f, 0xa7, 0xec, 0x3a, 0x4b, 0xcb, 0x27, 0x4a, 0x1f, 0x14, 0xed, 0xed, 0x76,
+  0xdb, 0x72, 0xb7, 0x21, 0xda, 0x07, 0x70, 0x63, 0x6b, 0x7b, 0x7d, 0x83, 0xb2, 0x99, 0x8c, 0xa0,
+  0x83, 0x04, 0x6e, 0x1b, 0x62, 0x0b, 0xc5, 0x28, 0xb3, 0xf1, 0x71, 0xb6, 0xe5, 0xd4, 0x7d, 0xb6,
+  0x69, 0xd5, 0x52, 0x9e, 0xd5, 0xae, 0x5d, 0x71, 0x5a, 0x2d, 0x13, 0x46, 0x6d, 0x5c, 0x7a, 0x6c,
+  0x7b, 0xfd, 0xc9, 0xf5, 0x47, 0x71, 0x00, 0x27, 0xcc, 0x02, 0x92, 0xfb, 0xf6, 0xa9, 0x52, 0xa8,
+  0x86, 0x75, 0xba, 0x32, 0x71, 0x65, 0x69, 0xa2, 0xc4, 0x3b, 0xdd, 0x30, 0xc1, 0x3b, 0x6a, 0xb2,
+  0x6b, 0x56, 0xb3, 0xe9, 0x1c, 0x26, 0xf5, 0xbc, 0xb2, 0x42, 0x5d, 0x87, 0xa4, 0xb5, 0xda, 0xb0,
+  0xaa, 0xfb, 0x3c, 0x95, 0x67, 0xfd, 0x00, 0x1c, 0x42, 0x98, 0x94, 0x34, 0xf2, 0xa2, 0x1f, 0x6f,
+  0x88, 0xb3, 0xe9, 0x0c, 0x75, 0x88, 0x5e, 0xeb, 0x1e, 0x68, 0x15, 0x0f, 0x53, 0x21, 0x9a, 0xce,
+  0x9e, 0x5d, 0xa5, 0xc9, 0x74, 0x80, 0x4c, 0x78, 0x4a, 0x1b, 0x22, 0x43, 0x48, 0xe2, 0x9d, 0xa3,
+  0x11, 0x31, 0x9a, 0x07, 0x3c, 0x7d, 0xeb, 0x80, 0x7f, 0xcf, 0xe9, 0x09, 0x64, 0x00, 0xf3, 0xc0,
+  0x86, 0xc8, 0x00, 0xa5, 0x8a, 0x09, 0x19, 0xc0, 0xed, 0x75, 0x9e, 0x17, 0x56, 0x0b, 0x89, 0x01,
+  0xc2, 0x24, 0x88, 0x41, 0x18, 0xfc, 0x21, 0xed, 0x91, 0x0b, 0x83, 0x56, 0x20, 0xc6, 0x4c, 0x88,
+  0x42, 0x73, 0xb3, 0x64, 0x7b, 0x2a, 0x0f, 0xcd, 0x08, 0x3a, 0x4b, 0x9c, 0x9d, 0xaa, 0x35, 0x3b,
+  0x51, 0x9b, 0xd1, 0x44, 0x62, 0xa3, 0xeb, 0x76, 0x9a, 0x56, 0x78, 0x6e, 0x10, 0x51, 0x82, 0x54,
+  0xc4, 0x7b, 0xd6, 0x12, 0xe0, 0x86, 0x75, 0xcc, 0xb3, 0xe6, 0x42, 0x62, 0xb1, 0x61, 0xb7, 0xf7,
+  0x93, 0x3a, 0xd6, 0x84, 0x42, 0xcd, 0xc2, 0x5a, 0x67, 0xc8, 0x1c, 0xac, 0x75, 0x0c, 0x7d, 0xe5,
+  0xaa, 0xa4, 0xae, 0x21, 0xcd, 0x82, 0xe4, 0x2f, 0xd5, 0x3a, 0xc8, 0xa5, 0x1a, 0xd4, 0x56, 0xcb,
+  0xb8, 0x0a, 0xf7, 0xcb, 0x33, 0x81, 0x86, 0x76, 0x2b, 0x12, 0x86, 0x62, 0x6d, 0x9d, 0xce, 0x28,
+  0x4d, 0x9d, 0xf8, 0x68, 0xa1, 0x7c, 0x84, 0xb1, 0x62, 0xda, 0x46, 0x60, 0x4c, 0x45, 0x16, 0xce,
+  0x40, 0x63, 0x2a, 0x33, 0x75, 0x84, 0x7c, 0xb7, 0x3a, 0x49, 0xd2, 0xbd, 0xd6, 0x49, 0x90, 0x6d,
+  0x1d, 0xf4, 0x21, 0xf5, 0xc0, 0xe5, 0x5a, 0x3d, 0x0a, 0xa9, 0x06, 0x04, 0x11, 0x7d, 0x03, 0x8c,
+  0xd0, 0xf2, 0xf9, 0x0c, 0xd9, 0x4d, 0xa2, 0x70, 0xd5, 0x27, 0xcd, 0xe2, 0x54, 0x01, 0x60, 0x42,
+  0xd2, 0xb4, 0xb6, 0x91, 0x20, 0xc4, 0xf1, 0x8e, 0x22, 0x99, 0x83, 0x83, 0x7b, 0xe2, 0x29, 0x87,
+  0x49, 0x3d, 0x69, 0x52, 0xab, 0xcb, 0x55, 0x02, 0x5f, 0x34, 0x31, 0xdb, 0xf2, 0xd1, 0x03, 0x0a,
+  0x64, 0x89, 0xdb, 0xdc, 0x9c, 0xef, 0xda, 0x2d, 0xd0, 0x68, 0xc4, 0x29, 0x09, 0x97, 0x6b, 0x5a,
+  0xed, 0x3d, 0xbf, 0xc1, 0x16, 0x16, 0x16, 0x58, 0x3e, 0xc3, 0x5c, 0x0b, 0x4d, 0x56, 0x9c, 0x8e,
+  0xcd, 0xf5, 0xc7, 0xb6, 0x97, 0xe7, 0x0c, 0x76, 0x41, 0x75, 0x80, 0x54, 0x29, 0x9a, 0x60, 0xfe,
+  0xfb, 0x52, 0xe4, 0x91, 0x04, 0xc9, 0x09, 0x4f, 0x20, 0x05, 0xaa, 0x46, 0xa1, 0x62, 0x6b, 0xf9,
+  0x87, 0x44, 0x00, 0x80, 0x6b, 0x7d, 0x73, 0x81, 0x8f, 0x75, 0x1e, 0x6d, 0xf9, 0xe4, 0xd6, 0xf6,
+  0xa5, 0xcd, 0x6d, 0x64, 0x65, 0x20, 0xeb, 0xa3, 0x34, 0x5a, 0xdf, 0x90, 0x12, 0x6a, 0x7b, 0x6b,
+  0xce, 0x01, 0x9e, 0x27, 0x2b, 0x01, 0xc5, 0x52, 0xf0, 0xdb, 0x5d, 0x10, 0x6a, 0xa8, 0xb2, 0x96,
+  0xe4, 0x61, 0x30, 0x40, 0xb4, 0xbb, 0xcd, 0xa6, 0x6c, 0x86, 0x09, 0xe2, 0xfd, 0xda, 0x61, 0x5d,
+  0xbc, 0x9d, 0xe6, 0x5a, 0x00, 0x8d, 0xb6, 0x58, 0x4b, 0xd2, 0x92, 0x91, 0xd5, 0x92, 0xce, 0x68,
+  0x48, 0xea, 0xfc, 0x86, 0xed, 0x09, 0xf7, 0xea, 0x02, 0x33, 0x1e, 0x36, 0xfa, 0xbb, 0x25, 0x00,
+  0xc8, 0x79, 0x18, 0x38, 0x28, 0xfd, 0x7a, 0x12, 0x1e, 0xec, 0x5f, 0xdb, 0x11, 0x0e, 0xfa, 0xd0,
+  0x0b, 0xb1, 0xe6, 0xd0, 0xbb, 0xd2, 0xaa, 0x5d, 0xc5, 0x05, 0x90, 0x97, 0xaa, 0xe3, 0xd0, 0xdb,
+  0x80, 0x39, 0xe0, 0xdc, 0x6a, 0x5b, 0x87, 0xb0, 0x80, 0x3a, 0x68, 0x82, 0x19, 0xaa, 0xf7, 0xbb,
+  0x77, 0xde, 0xe8, 0xdd, 0xfe, 0x8c, 0x8d, 0x2d, 0xb2, 0xde, 0xed, 0x57, 0xef, 0xdd, 0x78, 0xee,
+  0xf4, 0xcd, 0x4f, 0x7b, 0x37, 0xbf, 0x08, 0x0c, 0xfc, 0xa1, 0xb7, 0xde, 0xb1, 0x38, 0xcd, 0x5c,
+  0x7e, 0xb0, 0xbf, 0x87, 0x16, 0x78, 0x8f, 0xec, 0xbb, 0xdf, 0x85, 0xc7, 0x9c, 0x6b, 0x99, 0xb5,
+  0x63, 0xda, 0x06, 0x24, 0x51, 0x7b, 0xc2, 0xaa, 0x6c, 0x39, 0xd5, 0x7d, 0xcb, 0xcf, 0xad, 0x6f,
+  0x2c, 0x3f, 0x4a, 0xaf, 0x6c, 0x04, 0xd8, 0xae, 0x38, 0x30, 0xe2, 0xaa, 0x4f, 0x08, 0x39, 0xe5,
+  0x40, 0x90, 0x6a, 0x91, 0x36, 0x0e, 0xbd, 0xb9, 0xf1, 0x71, 0x14, 0xc8, 0xa6, 0x53, 0xa5, 0xbc,
+  0x9d, 0x5c, 0xc3, 0xf1, 0x7c, 0x7c, 0x19, 0x14, 0x99, 0x32, 0x37, 0x53, 0x18, 0x47, 0xd1, 0x81,
+  0x4e, 0x9d, 0x36, 0x44, 0xe5, 0x6d, 0x6d, 0x5d, 0xf4, 0xd5, 0x8a, 0xf2, 0xcc, 0x2a, 0x13, 0x56,
+  0x26, 0xe9, 0x26, 0xd8, 0xbf, 0x0c, 0x70, 0x79, 0x84, 0x86, 0x5c, 0xbd, 0x50, 0x08, 0xc7, 0x35,
+  0x0b, 0x39, 0xbd, 0x06, 0xcd, 0x01, 0xd1, 0x52, 0x6d, 0x3a, 0x9e, 0xf5, 0xd7, 0x10, 0x23, 0xcf,
+  0xcd, 0x1e, 0x8c, 0x1e, 0xe9, 0x3c, 0xa6, 0x34, 0x61, 0x50, 0xb3, 0x0e, 0x4e, 0x17, 0x38, 0xf2,
+  0xa8, 0x17, 0x3c, 0xcb, 0xdf, 0xb6, 0x5b, 0x16, 0xe8, 0x9a, 0xb4, 0x9a, 0x89, 0x2c, 0xc3, 0xfc,
+  0xc4, 0x8c, 0x1c, 0x4a, 0xc5, 0x6e, 0x9b, 0xee, 0xf1, 0xf6, 0x71, 0x07, 0x47, 0x63, 0x98, 0xae,
+  0x6b, 0x1e, 0x57, 0xba, 0xf5, 0x3a, 0x84, 0x75, 0x62, 0xa4, 0x2d, 0xcb, 0xf3, 0xcc, 0x3d, 0x1a,
+  0xab, 0x75, 0x20, 0x46, 0x8b, 0xfa, 0xc6, 0x3a, 0xc8, 0xe1, 0x1e, 0x0a, 0xb3, 0x41, 0xe2, 0xf0,
+  0xad, 0x41, 0xa7, 0xce, 0x2e, 0x61, 0xeb, 0xcb, 0xd4, 0x1a, 0xa7, 0xdb, 0x11, 0x09, 0xf1, 0x97,
+  0xc0, 0x03, 0xc4, 0x59, 0xc7, 0x14, 0x12, 0xdc, 0xff, 0x95, 0x4d, 0x33, 0x40, 0x84, 0xd4, 0x51,
+  0xd2, 0xa7, 0x6b, 0x41, 0x3f, 0xff, 0xb4, 0xb5, 0xfe, 0x68, 0xae, 0x83, 0x2f, 0x09, 0x2b, 0x48,
+  0x61, 0x97, 0x72, 0x3e, 0x09, 0x1c, 0x9e, 0x6c, 0x18, 0xa8, 0xdf, 0xda, 0x35, 0xe4, 0xa8, 0x38,
+  0xb5, 0x4c, 0xb7, 0x00, 0x8c, 0x6c, 0x49, 0x08, 0x16, 0x96, 0x11, 0xc0, 0x3a, 0x6d, 0xa1, 0x92,
+  0x90, 0x98, 0x16, 0x1f, 0xbd, 0x26, 0xa7, 0xba, 0xce, 0xaa, 0xb6, 0x6a, 0xd2, 0xa3, 0x95, 0x8b,
+  0x81, 0x0b, 0xaf, 0x5c, 0x67, 0xf2, 0xdb, 0xc3, 0x6c, 0xaa, 0x54, 0x9a, 0x28, 0x81, 0x9c, 0x16,
+  0x74, 0xee, 0x03, 0xd3, 0xd3, 0x02, 0x24, 0xcb, 0x3a, 0x96, 0x8b, 0x2f, 0x40, 0x21, 0x83, 0x72,
+  0x6d, 0xe7, 0x30, 0x9d, 0xe1, 0xc2, 0x8c, 0xfd, 0x49, 0x20, 0x94, 0x73, 0x86, 0x2b, 0x00, 0x3b,
+  0xd6, 0xec, 0x61, 0xdd, 0xf2, 0xab, 0x8d, 0xb4, 0x31, 0x0e, 0xc5, 0x17, 0x91, 0x09, 0x0b, 0x08,
+  0x63, 0xb5, 0xab, 0xe0, 0x0f, 0x3f, 0xb6, 0x79, 0x15, 0xa8, 0xed, 0x38, 0x6d, 0x8c, 0xd3, 0xb0,
+  0x59, 0x26, 0x07, 0x8b, 0x07, 0xa0, 0xc1, 0x73, 0xc6, 0x19, 0xd2, 0xdd, 0x6a, 0x28, 0xca, 0x08,
+  0xb7, 0x19, 0xd5, 0x45, 0x93, 0x4e, 0xb6, 0x42, 0x1a, 0xa4, 0x49, 0xc7, 0x58, 0x5c, 0x81, 0x28,
+  0x8e, 0x44, 0x18, 0xa6, 0xec, 0x90, 0x9f, 0x27, 0x0e, 0xc8, 0xc1, 0x82, 0xc8, 0x02, 0xab, 0xed,
+  0x9a, 0x98, 0x21, 0xac, 0x05, 0xa6, 0x83, 0xd2, 0xb2, 0xea, 0x20, 0xdd, 0xb5, 0xc0, 0x08, 0x05,
+  0x4d, 0x6a, 0x30, 0x61, 0xbe, 0xa5, 0xb7, 0x6a, 0xe5, 0x5c, 0x52, 0x31, 0xc6, 0xfa, 0x0f, 0x0c,
+  0xd9, 0x93, 0x8a, 0x0a, 0xaa, 0x9c, 0x0c, 0x40, 0xf4, 0x34, 0x1d, 0xe3, 0xce, 0x19, 0x59, 0x86,
+  0x6d, 0xf1, 0xaf, 0x9b, 0x20, 0x41, 0xae, 0x8f, 0x0b, 0x2c, 0xc6, 0x77, 0x08, 0x87, 0x7d, 0xa5,
+  0x20, 0x2b, 0x0e, 0xbe, 0xd6, 0xb5, 0x00, 0x18, 0xcc, 0xaa, 0x0f, 0x61, 0x33, 0xe6, 0x5d, 0xca,
+  0x3a, 0xe0, 0x06, 0xd4, 0xac, 0x99, 0x7e, 0x03, 0xa3, 0xe8, 0x74, 0x3e, 0x0b, 0x56, 0x1e, 0x50,
+  0x8e, 0xf1, 0x46, 0x18, 0x64, 0x17, 0x33, 0x30, 0x11, 0xf4, 0x04, 0xfc, 0x93, 0xec, 0x94, 0x5f,
+  0xa4, 0xa6, 0xbc, 0x48, 0x88, 0xe6, 0x64, 0xf9, 0xf7, 0x70, 0xff, 0x09, 0xb5, 0x1c, 0x14, 0xe2,
+  0xf7, 0x22, 0x35, 0xe5, 0x6c, 0x57, 0x7d, 0xf1, 0x92, 0x2c, 0x02, 0x65, 0x06, 0xa8, 0x05, 0x71,
+  0x8a, 0x19, 0xd6, 0x28, 0xd0, 0x26, 0xe7, 0x3b, 0x2b, 0xf6, 0x91, 0x55, 0x4b, 0x17, 0x86, 0xb7,
+  0xc6, 0xd3, 0xcd, 0x18, 0x02, 0x28, 0x3c, 0x0f, 0x0e, 0x3c, 0xfb, 0x8c, 0xe1, 0x80, 0xc2, 0x91,
+  0x71, 0xe0, 0x41, 0x67, 0x18, 0x01, 0x70, 0x7a, 0xe4, 0xd6, 0x78, 0xf4, 0x19, 0x6e, 0x4d, 0x73,
+  0x12, 0x6a, 0x2f, 0x85, 0x62, 0x7b, 0x79, 0x75, 0xf9, 0xc9, 0x8d, 0xe5, 0xcd, 0xab, 0xeb, 0x4b,
+  0x4f, 0xae, 0x6d, 0x01, 0x68, 0x51, 0xcd, 0x37, 0x55, 0x2d, 0x2d, 0x5f, 0x5a, 0xfa, 0xef, 0xeb,
+  0x8f, 0x2e, 0xe3, 0x22, 0xc8, 0xe5, 0x67, 0x34, 0xef, 0x9d, 0xab, 0xb0, 0x21, 0xce, 0xbb, 0x78,
+  0xf1, 0x27, 0xd8, 0xd2, 0x12, 0x6f, 0xee, 0x0c, 0xdc, 0xd3, 0x92, 0x6f, 0xf7, 0x84, 0x5a, 0xfd,
+  0xc0, 0x3a, 0x96, 0x46, 0x72, 0x0b, 0x96, 0x16, 0x59, 0x6d, 0xb2, 0xdb, 0xa7, 0x2f, 0xdd, 0xfa,
+  0xfa, 0xcb, 0xdb, 0x77, 0xdf, 0xfe, 0x29, 0xcf, 0xe8, 0xbd, 0xf7, 0xda, 0x47, 0xf7, 0xef, 0xdc,
+  0xec, 0xdd, 0xfe, 0xb8, 0xf7, 0xca, 0x4b, 0x60, 0xc2, 0xa1, 0xb6, 0x77, 0xeb, 0xe5, 0xb3, 0xaf,
+  0x7e, 0x01, 0x22, 0xc6, 0xf3, 0xd7, 0xef, 0xdf, 0xb9, 0xa5, 0xa1, 0x05, 0xef, 0xd2, 0x17, 0x68,
+  0x49, 0x49, 0xa7, 0xa7, 0x26, 0x79, 0x4c, 0x8e, 0x6e, 0xe5, 0x77, 0xd9, 0xd4, 0x04, 0x3a, 0x04,
+  0x3b, 0xf0, 0x90, 0x0d, 0xb9, 0x05, 0xbb, 0xa4, 0x1f, 0x10, 0xc1, 0x7a, 0x3b, 0xec, 0x79, 0x61,
+  0x19, 0x9a, 0x16, 0x37, 0xa4, 0x49, 0x78, 0x57, 0xcf, 0x70, 0x55, 0xa2, 0xc0, 0x8e, 0xc2, 0xcf,
+  0xa0, 0x50, 0xbc, 0x70, 0xc9, 0x26, 0x2d, 0xd9, 0x30, 0x9a, 0x47, 0x9c, 0x66, 0x2d, 0x0c, 0xb5,
+  0x0a, 0x81, 0xe9, 0x36, 0x77, 0x34, 0xb5, 0xd2, 0x7f, 0xb2, 0x7d, 0x9f, 0xa8, 0xc8, 0x73, 0x56,
+  0xc9, 0xff, 0x60, 0x6c, 0x7c, 0x24, 0xf7, 0xde, 0xfc, 0xe3, 0xbd, 0xb7, 0x5f, 0x3b, 0x7d, 0xe1,
+  0x8d, 0xde, 0x0b, 0x1f, 0x00, 0xcb, 0x4e, 0x3f, 0xb9, 0x7d, 0xf6, 0xfe, 0xcd, 0xde, 0x5b, 0x1f,
+  0xf4, 0x3e, 0x7a, 0x1b, 0x07, 0xf9, 0xd6, 0x07, 0xc8, 0x29, 0xa5, 0xf6, 0x6a, 0x2e, 0x38, 0x09,
+  0xba, 0x09, 0x78, 0x88, 0x8f, 0x3e, 0x13, 0x33, 0x11, 0x21, 0xfb, 0x41, 0xe3, 0x3a, 0xb2, 0xbd,
+  0xf4, 0x81, 0xe6, 0x38, 0xd1, 0xba, 0x36, 0x2b, 0x54, 0x38, 0x1f, 0x91, 0xb3, 0x8b, 0x2c, 0x0f,
+  0xca, 0xe1, 0x20, 0x86, 0x84, 0xbc, 0xfb, 0x74, 0xa0, 0x6e, 0xc9, 0x43, 0x45, 0x7d, 0x86, 0xe6,
+  0xf0, 0x2a, 0x68, 0x7b, 0xdd, 0xab, 0x25, 0xdf, 0x31, 0xb4, 0x8f, 0xaa, 0x43, 0x6a, 0x4e, 0x69,
+  0x18, 0xb0, 0x63, 0xd6, 0x48, 0xc6, 0xcc, 0x03, 0x7b, 0xcf, 0xf4, 0x1d, 0x17, 0x45, 0xf3, 0xfb,
+  0xe0, 0x70, 0x51, 0xf9, 0xc5, 0xe4, 0x72, 0x20, 0x69, 0x8e, 0xed, 0xec, 0xe2, 0x7b, 0xb7, 0x2e,
+  0x4b, 0x2b, 0x3c, 0x0c, 0xac, 0x3e, 0x56, 0x2b, 0x6e, 0x61, 0xd9, 0x8f, 0x7f, 0xcc, 0xf0, 0x13,
+  0xdf, 0xa1, 0x6d, 0x93, 0xca, 0xce, 0xd0, 0x65, 0x1e, 0x76, 0xbb, 0x6b, 0x49, 0x12, 0x6a, 0xe0,
+  0x41, 0xa2, 0x47, 0x81, 0x60, 0x62, 0x2f, 0x77, 0x67, 0x72, 0x17, 0xdd, 0xcb, 0x70, 0x49, 0xae,
+  0xe3, 0x82, 0xfb, 0x81, 0x18, 0x00, 0x69, 0x08, 0xba, 0x14, 0x83, 0x2e, 0x05, 0xd0, 0xdc, 0xac,
+  0x3c, 0x84, 0xbd, 0x64, 0x58, 0x05, 0xdc, 0xd5, 0x7d, 0xd9, 0x31, 0x29, 0x5c, 0x6c, 0x65, 0x1e,
+  0x59, 0x9e, 0x8c, 0x97, 0x16, 0x59, 0x11, 0x91, 0xa9, 0x49, 0x94, 0xf5, 0x3b, 0xc5, 0xdd, 0x0c,
+  0x19, 0xa6, 0x3c, 0xb0, 0x45, 0x2b, 0x04, 0x56, 0xa8, 0xa7, 0xfc, 0xae, 0x34, 0x41, 0xec, 0x3a,
+  0x58, 0x67, 0x7c, 0xd3, 0xb9, 0x6b, 0x81, 0x0a, 0xc7, 0xd3, 0x92, 0xb1, 0x38, 0xc6, 0xc2, 0x2e,
+  0x6e, 0xc5, 0xd2, 0x24, 0x66, 0x99, 0x89, 0x27, 0x1a, 0x0a, 0xc6, 0x3c, 0xc2, 0x2a, 0xc4, 0x94,
+  0x65, 0x9e, 0x5b, 0x9d, 0x63, 0x06, 0xbe, 0x84, 0xca, 0x4e, 0x02, 0x2d, 0x56, 0x3f, 0x44, 0xa6,
+  0x49, 0x35, 0x91, 0x6b, 0x98, 0x5e, 0xda, 0x80, 0xe5, 0xec, 0x1c, 0x3e, 0x06, 0xba, 0x07, 0x39,
+  0x94, 0x1c, 0x47, 0xa1, 0x65, 0x5d, 0x31, 0x94, 0x4e, 0x33, 0x69, 0x09, 0x25, 0x60, 0x59, 0x72,
+  0x0e, 0xdb, 0xc3, 0xf0, 0x5c, 0x56, 0x78, 0x30, 0xa7, 0x29, 0x19, 0xcf, 0x2a, 0xd4, 0x84, 0xf0,
+  0x44, 0xe2, 0x33, 0xc4, 0xb3, 0xaa, 0xf0, 0xd0, 0x1e, 0x73, 0x32, 0xa2, 0x4d, 0xac, 0x1a, 0x86,
+  0x69, 0x33, 0xa0, 0xc8, 0xa6, 0xf0, 0x00, 0xb9, 0x74, 0x51, 0x2c, 0x9c, 0x39, 0x8c, 0x83, 0xc7,
+  0x58, 0x9a, 0x06, 0xad, 0x17, 0x2a, 0x79, 0xa0, 0x20, 0x29, 0xcd, 0x89, 0xb8, 0xc8, 0xd7, 0x90,
+  0x6c, 0x44, 0x23, 0xd4, 0xca, 0x22, 0x13, 0x8d, 0xfd, 0x00, 0x65, 0x84, 0x1a, 0x3e, 0x09, 0x1a,
+  0x3e, 0xc5, 0x9e, 0x39, 0x09, 0x00, 0xfc, 0x11, 0xb3, 0x0c, 0x7f, 0xe4, 0xac, 0xee, 0xc3, 0x20,
+  0xc5, 0xb4, 0x86, 0x96, 0x3e, 0xee, 0x00, 0xa4, 0xad, 0x76, 0x56, 0xb5, 0x52, 0x8b, 0x2a, 0x70,
+  0x43, 0x05, 0x01, 0x42, 0x11, 0x07, 0xea, 0x36, 0x2d, 0xbf, 0x82, 0x2f, 0x9a, 0x01, 0x85, 0x9e,
+  0x3f, 0x5a, 0x81, 0xff, 0xe4, 0x20, 0xc1, 0x01, 0x4a, 0x72, 0x89, 0x94, 0x44, 0x08, 0xcb, 0xa0,
+  0xfc, 0x73, 0x65, 0x26, 0xb8, 0x2f, 0x9f, 0x2e, 0x14, 0xd1, 0x83, 0xac, 0xa0, 0x67, 0xfb, 0x98,
+  0xdd, 0xf6, 0x67, 0xd0, 0x29, 0x9a, 0x99, 0x94, 0x11, 0xe5, 0x3f, 0x6e, 0xff, 0xa3, 0x5e, 0x57,
+  0xc8, 0x02, 0x77, 0x80, 0x6d, 0x05, 0xc1, 0x33, 0x55, 0x55, 0x98, 0x4a, 0x17, 0xb3, 0xd2, 0x44,
+  0x64, 0x69, 0x9d, 0xc8, 0xea, 0xab, 0x54, 0x3b, 0x99, 0xe5, 0x2a, 0x93, 0x07, 0xbd, 0xca, 0x2b,
+  0x1a, 0xc3, 0xf7, 0xbe, 0x84, 0x93, 0x64, 0xb7, 0xd3, 0xf4, 0x04, 0x2c, 0xca, 0xf0, 0x33, 0x8d,
+  0x4c, 0x12, 0xa6, 0xa9, 0xd1, 0x31, 0x21, 0x9f, 0x13, 0x31, 0x21, 0xc9, 0x13, 0xc5, 0xf4, 0x4c,
+  0x08, 0x15, 0xf0, 0x2d, 0xc3, 0x16, 0x17, 0x17, 0x59, 0x5e, 0x01, 0x4b, 0xf3, 0xba, 0x23, 0xa7,
+  0x00, 0xcd, 0xe9, 0x2e, 0xb0, 0x74, 0x47, 0x0d, 0x15, 0x5a, 0xed, 0x06, 0x6e, 0x7f, 0x25, 0xc7,
+  0x03, 0x2c, 0xd1, 0x76, 0xfb, 0xe8, 0xc2, 0x05, 0x25, 0x59, 0x88, 0x33, 0x26, 0x18, 0xdb, 0xb4,
+  0x85, 0xae, 0x4c, 0x42, 0xdf, 0xd9, 0x24, 0x07, 0x5c, 0x33, 0x94, 0x41, 0x93, 0x9a, 0xf4, 0x32,
+  0xd1, 0x1a, 0x61, 0xfb, 0xb1, 0xb0, 0x45, 0x1d, 0x8b, 0x38, 0x48, 0x82, 0x34, 0x61, 0x5b, 0x2f,
+  0x80, 0x7c, 0xd5, 0x44, 0x13, 0x5e, 0x84, 0x5e, 0x70, 0x61, 0x0a, 0x09, 0x8d, 0x18, 0x66, 0xc0,
+  0x2d, 0xa5, 0xaa, 0x2a, 0xd6, 0xb4, 0xb0, 0x68, 0x9c, 0xbc, 0x6a, 0xce, 0x02, 0x53, 0x9a, 0x78,
+  0x88, 0x50, 0x0e, 0xcc, 0x2d, 0xad, 0x04, 0x04, 0xcd, 0xb2, 0x6a, 0x8e, 0x56, 0x43, 0x35, 0xc7,
+  0xe7, 0xe9, 0x7a, 0x4a, 0xba, 0x4d, 0xe1, 0x70, 0x5a, 0xbe, 0xed, 0xac, 0x36, 0x16, 0x98, 0x88,
+  0xaf, 0x61, 0xe9, 0x93, 0xaf, 0x8f, 0x67, 0x0e, 0x1e, 0x7f, 0x43, 0x85, 0xf9, 0x3c, 0x24, 0xc6,
+  0xd0, 0x3b, 0x08, 0x1e, 0x24, 0xf3, 0xc0, 0x5b, 0x79, 0x18, 0x84, 0x41, 0xee, 0xa1, 0x0d, 0xeb,
+  0x10, 0x63, 0x32, 0x22, 0x15, 0x24, 0xbe, 0x9a, 0x83, 0x05, 0x1e, 0x44, 0x73, 0x48, 0xb9, 0x72,
+  0x46, 0xf3, 0x18, 0x33, 0x18, 0xe3, 0xbc, 0x02, 0xc6, 0xa2, 0x57, 0x00, 0x16, 0x4c, 0x9c, 0x02,
+  0x45, 0x77, 0x21, 0x65, 0xb0, 0x1f, 0x53, 0x04, 0x43, 0x78, 0x95, 0x6f, 0x14, 0x04, 0x15, 0xc6,
+  0x98, 0xc1, 0xe6, 0xa4, 0xd3, 0xa4, 0xb9, 0xba, 0x84, 0x9e, 0xf2, 0xff, 0x1a, 0xe8, 0x38, 0x61,
+  0x73, 0xe9, 0x45, 0x29, 0xa8, 0x22, 0xef, 0x00, 0x81, 0x50, 0x67, 0xa9, 0x2e, 0x60, 0xc8, 0x17,
+  0x75, 0x21, 0x87, 0x75, 0x81, 0x86, 0x48, 0xba, 0x6a, 0xe3, 0xc2, 0x8b, 0xcb, 0x70, 0xc5, 0x88,
+  0x5b, 0x55, 0x20, 0xfc, 0x47, 0xec, 0x69, 0x2e, 0x1d, 0xb2, 0x2b, 0x2e, 0x19, 0x1a, 0x49, 0x82,
+  0x22, 0x83, 0xc7, 0x9e, 0x5a, 0x60, 0x19, 0xec, 0x0a, 0x1c, 0x48, 0x15, 0x77, 0x90, 0xab, 0x1c,
+  0xfb, 0xd6, 0x2a, 0x37, 0xc7, 0x68, 0x71, 0x0b, 0x45, 0xd4, 0xa5, 0x07, 0xe8, 0x82, 0x08, 0x95,
+  0xc3, 0x2d, 0xf1, 0x54, 0x29, 0x08, 0x29, 0xf5, 0x8d, 0x51, 0x05, 0x29, 0xb4, 0x8c, 0xab, 0xf9,
+  0x3b, 0x1e, 0x77, 0x7e, 0xd5, 0x42, 0x95, 0x3e, 0xef, 0xae, 0x10, 0x39, 0xaa, 0x87, 0xde, 0xf0,
+  0x13, 0xec, 0x39, 0xf5, 0x83, 0xdb, 0xa3, 0x91, 0x8e, 0xfa, 0x07, 0x96, 0xd4, 0xb0, 0xb0, 0xcb,
+  0x17, 0x0d, 0x77, 0x66, 0x13, 0xa6, 0x0e, 0xdb, 0xab, 0xa9, 0xa3, 0x20, 0x70, 0x16, 0x37, 0x82,
+  0xc5, 0xf7, 0x02, 0x6f, 0x2d, 0xdc, 0x5e, 0x35, 0x1c, 0xae, 0x81, 0x68, 0x38, 0x2a, 0x4e, 0x95,
+  0x33, 0x83, 0x7a, 0xe3, 0x24, 0xa5, 0xc2, 0x8f, 0x84, 0xad, 0x63, 0xe5, 0xb9, 0x0b, 0x2f, 0x36,
+  0xd0, 0x11, 0xe8, 0xd1, 0x5e, 0x4f, 0x29, 0xf7, 0x3c, 0xec, 0x97, 0x47, 0x7d, 0xf2, 0xb8, 0xf7,
+  0xad, 0xbb, 0xff, 0x5c, 0xeb, 0x5a, 0x2e, 0x38, 0x99, 0x69, 0xa9, 0xae, 0xb2, 0x71, 0x85, 0x12,
+  0xd0, 0x19, 0x3f, 0x4b, 0x10, 0xf1, 0x93, 0x0e, 0x94, 0xb8, 0xc1, 0x3f, 0x5d, 0xaf, 0xcc, 0xd0,
+  0xb6, 0x97, 0xda, 0x24, 0xa1, 0xad, 0xae, 0x48, 0xf7, 0x2d, 0xa5, 0x5b, 0x49, 0x91, 0x90, 0xb1,
+  0xcc, 0xa2, 0xc6, 0xce, 0x4b, 0x93, 0x85, 0xc9, 0xbc, 0xaf, 0xfc, 0xcb, 0xd7, 0x9f, 0xdf, 0xe8,
+  0x7d, 0xfe, 0xfe, 0xfd, 0x3b, 0x6f, 0xf3, 0xb7, 0x81, 0xfb, 0x53, 0xa8, 0x5d, 0xd8, 0x30, 0x9c,
+  0x46, 0x7e, 0xd3, 0x83, 0x51, 0x1e, 0xa2, 0x38, 0x40, 0x3f, 0x19, 0xd1, 0xc3, 0x55, 0xe2, 0x3b,
+  0xfc, 0x6f, 0x7a, 0xfc, 0x50, 0x55, 0xb9, 0x44, 0x6a, 0x43, 0x2f, 0x14, 0x91, 0x48, 0xf1, 0xd4,
+  0xf6, 0xd4, 0x13, 0xf6, 0xc9, 0xfb, 0xec, 0xad, 0x0f, 0xdc, 0x3a, 0x3f, 0x49, 0x1d, 0xda, 0xed,
+  0x9a, 0x73, 0x98, 0x33, 0x6b, 0xb5, 0xe5, 0x03, 0x00, 0x5b, 0xb5, 0x3d, 0xdf, 0x82, 0x51, 0x40,
+  0xb4, 0xdb, 0xec, 0xba, 0x46, 0x56, 0x27, 0x55, 0x0f, 0xd3, 0xe3, 0xf0, 0x2d, 0xa7, 0xeb, 0x59,
+  0xdd, 0x0e, 0x34, 0x11, 0x42, 0xc9, 0x74, 0x11, 0x0c, 0x8d, 0xb8, 0xcc, 0x4e, 0x70, 0x77, 0xac,
+  0x5f, 0xcf, 0x7b, 0x3c, 0x14, 0x51, 0x51, 0x05, 0xa2, 0xb4, 0x32, 0xd1, 0xed, 0x2e, 0x09, 0x86,
+  0xdb, 0x44, 0x56, 0x4e, 0x3c, 0xe0, 0x56, 0x53, 0x46, 0x63, 0xb4, 0x59, 0xc3, 0x34, 0x2a, 0xba,
+  0x1e, 0x27, 0x5d, 0xb3, 0x9a, 0xbe, 0x89, 0xdc, 0xa6, 0x03, 0xe2, 0xc1, 0xa1, 0x16, 0xac, 0x57,
+  0x02, 0x2f, 0xa7, 0x0e, 0x22, 0x7b, 0x44, 0x61, 0xa7, 0xe2, 0x00, 0x7b, 0x8b, 0x35, 0xc7, 0x75,
+  0x5d, 0x4e, 0x3e, 0x73, 0x38, 0x18, 0x72, 0x02, 0x10, 0x4e, 0x93, 0x40, 0x0e, 0xaa, 0x49, 0x87,
+  0xc0, 0x25, 0x69, 0x8a, 0x71, 0x44, 0x22, 0x98, 0x4d, 0x12, 0x80, 0x0b, 0x40, 0x63, 0x44, 0x31,
+  0x73, 0xa6, 0xa0, 0x40, 0x0c, 0xe0, 0x49, 0x2c, 0xa8, 0x3c, 0x17, 0x4b, 0xa2, 0xad, 0x39, 0x47,
+  0x92, 0xce, 0x46, 0x86, 0x31, 0x24, 0x94, 0x12, 0xc2, 0xf9, 0x21, 0x25, 0x3f, 0x60, 0x48, 0x48,
+  0xb8, 0x63, 0x0c, 0x09, 0x8b, 0x7e, 0xc0, 0x10, 0x11, 0x4f, 0xe6, 0x56, 0x70, 0xf3, 0x1b, 0xa5,
+  0x17, 0x93, 0x04, 0xf5, 0xf3, 0xb8, 0x3e, 0xde, 0x4b, 0xb0, 0x0a, 0xb9, 0x17, 0xd7, 0x67, 0xe1,
+  0x51, 0x28, 0xd6, 0x7f, 0x9d, 0x26, 0x2f, 0x48, 0x4e, 0x38, 0x34, 0xc5, 0x93, 0xbb, 0x84, 0x1d,
+  0x00, 0x3c, 0xc7, 0x13, 0x64, 0x5f, 0xfe, 0x86, 0xc8, 0xbe, 0xfc, 0xe0, 0x64, 0x5f, 0x1e, 0x81,
+  0xec, 0xd5, 0xf3, 0x92, 0x1d, 0x50, 0x12, 0xa2, 0x3b, 0x4a, 0x08, 0x45, 0x9a, 0xf1, 0x53, 0xc7,
+  0x81, 0x27, 0x8e, 0x82, 0xec, 0x55, 0x72, 0x6d, 0xe2, 0xbb, 0x28, 0x1a, 0xd5, 0x9b, 0xdf, 0x14,
+  0xd5, 0x9b, 0x0f, 0x4c, 0xf5, 0xe6, 0x70, 0xaa, 0xb7, 0x1e, 0x58, 0x44, 0x04, 0x1d, 0xa3, 0x9b,
+  0x19, 0x4e, 0xda, 0x28, 0x42, 0xb2, 0x65, 0x84, 0x89, 0x54, 0xcb, 0xaf, 0xdb, 0x61, 0x0b, 0x71,
+  0xe9, 0x0e, 0x95, 0xae, 0x26, 0x96, 0x6e, 0xea, 0xa5, 0x6a, 0x90, 0xff, 0xb9, 0xa3, 0x19, 0x60,
+  0x19, 0xf7, 0xad, 0x63, 0xe4, 0x7f, 0x60, 0xc6, 0xc4, 0xb9, 0x5a, 0xce, 0xb5, 0x3a, 0x96, 0xe9,
+  0x6b, 0xf6, 0x9d, 0x4a, 0x01, 0x3c, 0x47, 0xb7, 0xc7, 0x7a, 0x4f, 0xd8, 0x7e, 0x43, 0xec, 0x90,
+  0x18, 0x99, 0x4c, 0xb0, 0x71, 0x02, 0x5d, 0x70, 0x38, 0x34, 0x3e, 0x87, 0xb6, 0x5f, 0x6d, 0x88,
+  0x76, 0x14, 0x08, 0xe2, 0x8d, 0x72, 0x6a, 0xb7, 0x68, 0xee, 0x5b, 0xa9, 0xc5, 0xe4, 0x4e, 0x5d,
+  0x40, 0x2a, 0x6d, 0x49, 0xcd, 0x7d, 0x2b, 0x75, 0x57, 0x9c, 0x58, 0xda, 0xf7, 0x9a, 0xfb, 0x36,
+  0x6a, 0xac, 0x38, 0xad, 0x7c, 0x6b, 0x6d, 0xee, 0xdb, 0xa8, 0xa8, 0x42, 0xc4, 0x3e, 0x83, 0x34,
+  0xd2, 0xb7, 0x1f, 0xc2, 0x37, 0xdd, 0x6f, 0x1b, 0x2b, 0x45, 0x61, 0x0f, 0x15, 0xec, 0x13, 0x11,
+  0xd8, 0x0b, 0x31, 0x58, 0x53, 0xc1, 0x5e, 0x52, 0xb0, 0xe4, 0xfa, 0xc4, 0xd1, 0x7a, 0x0a, 0x74,
+  0x2b, 0x0c, 0xaa, 0x63, 0x05, 0xc7, 0x21, 0x33, 0x6c, 0xb5, 0x73, 0x2f, 0xd8, 0xd2, 0x62, 0x33,
+  0x5a, 0xb6, 0xe2, 0x3c, 0x54, 0xae, 0x5c, 0x5c, 0xed, 0x3b, 0x6a, 0xa1, 0x66, 0xf5, 0x85, 0x90,
+  0xd5, 0x05, 0x2d, 0x1b, 0x9a, 0xc9, 0x5d, 0xf0, 0x9e, 0xaa, 0xcd, 0x6e, 0xcd, 0xf2, 0x04, 0xa2,
+  0xcc, 0x7f, 0xb2, 0xaa, 0xa3, 0xf1, 0x47, 0x92, 0x9a, 0x31, 0xe1, 0x10, 0x37, 0x15, 0x29, 0x98,
+  0x91, 0xc7, 0xd9, 0x07, 0xa2, 0xd0, 0xc8, 0xa4, 0x72, 0x7e, 0xc3, 0x6a, 0xa7, 0x5d, 0xcb, 0xeb,
+  0x80, 0xba, 0xb6, 0x90, 0x2d, 0xf2, 0x7b, 0xee, 0x69, 0x0f, 0x13, 0x67, 0x24, 0x08, 0x25, 0x1a,
+  0x0c, 0xce, 0xb3, 0x50, 0x57, 0x33, 0x84, 0x8f, 0x04, 0xc9, 0x71, 0x5d, 0x69, 0x3a, 0xa6, 0x4f,
+  0x48, 0x72, 0x47, 0x99, 0xd1, 0xce, 0x17, 0xd5, 0xbd, 0x0d, 0x83, 0xd1, 0x1d, 0x9f, 0x03, 0x9d,
+  0xba, 0xd7, 0x61, 0x30, 0x4a, 0x13, 0xc1, 0xc2, 0x68, 0x51, 0x24, 0xa8, 0x4e, 0xde, 0x77, 0x80,
+  0x3e, 0x2e, 0x15, 0x88, 0x97, 0xf0, 0x33, 0x83, 0x38, 0x13, 0xdc, 0xa2, 0x10, 0xee, 0x38, 0x84,
+  0x31, 0x77, 0x84, 0x3b, 0x20, 0xf9, 0xf2, 0x70, 0x34, 0xd7, 0x06, 0xa2, 0x39, 0x1e, 0x86, 0x46,
+  0x5d, 0x2b, 0x90, 0x80, 0x45, 0xd4, 0x0d, 0xa7, 0x45, 0xdd, 0x3d, 0x30, 0x00, 0x89, 0xa4, 0xe4,
+  0x24, 0xc2, 0x3e, 0x79, 0x33, 0x41, 0x88, 0x87, 0xb2, 0x70, 0x38, 0x23, 0xf9, 0xf5, 0x05, 0xfd,
+  0x58, 0x20, 0xf1, 0x8c, 0xc8, 0x4e, 0x7e, 0xd5, 0xc1, 0x50, 0x64, 0x23, 0x31, 0xb5, 0x2f, 0x61,
+  0xfa, 0xf8, 0x46, 0x63, 0x6d, 0x5f, 0xb2, 0x42, 0xa8, 0x12, 0x18, 0xec, 0xd1, 0x4d, 0x0c, 0xc3,
+  0x99, 0x28, 0x6e, 0x6c, 0x48, 0xe8, 0x81, 0x63, 0xe0, 0xe3, 0x1f, 0x42, 0xe5, 0x50, 0x24, 0x08,
+  0xc4, 0x35, 0x53, 0xaa, 0x7f, 0x7a, 0x0c, 0xa5, 0x35, 0x53, 0x33, 0x46, 0xef, 0x37, 0xd2, 0xbe,
+  0x81, 0x4c, 0x99, 0x11, 0x87, 0xcc, 0x2b, 0xae, 0xd9, 0xb2, 0xbc, 0x48, 0x82, 0x4c, 0x3c, 0xfb,
+  0x88, 0x2b, 0x75, 0x0e, 0x8c, 0x7b, 0x73, 0x62, 0xdb, 0xd0, 0x1c, 0x9c, 0xe7, 0x2c, 0xef, 0x47,
+  0x90, 0xeb, 0x5c, 0x99, 0x10, 0xba, 0x45, 0x59, 0x80, 0xd2, 0x9e, 0x24, 0x62, 0xca, 0xd0, 0x5f,
+  0x15, 0x3d, 0xb7, 0x72, 0x8d, 0x67, 0xcb, 0xe7, 0x56, 0x8a, 0xad, 0xdc, 0xd1, 0x5f, 0xa5, 0x05,
+  0x5b, 0xb9, 0xe3, 0xbf, 0x5a, 0xed, 0xb5, 0x72, 0xe6, 0x68, 0x38, 0xfa, 0xa9, 0xaf, 0x16, 0x08,
+  0x09, 0x9d, 0xbe, 0x9e, 0x5b, 0x63, 0x51, 0xcb, 0xc2, 0xee, 0xf9, 0x95, 0x54, 0x2b, 0x57, 0x19,
+  0xd2, 0x65, 0x1f, 0xc5, 0x44, 0x0d, 0x0b, 0xbb, 0xe5, 0x07, 0xd0, 0x2d, 0x40, 0x6c, 0x7d, 0x84,
+  0x61, 0x26, 0x2d, 0x59, 0x6a, 0x3a, 0x74, 0x9c, 0xc9, 0x9d, 0x56, 0xea, 0xc3, 0x07, 0x9a, 0xdc,
+  0x67, 0xa5, 0x3e, 0xc2, 0x48, 0x13, 0xd7, 0x6e, 0x0b, 0x16, 0xee, 0xf0, 0x5e, 0xfb, 0x37, 0x1d,
+  0xd8, 0x2d, 0xbf, 0x0d, 0x23, 0xda, 0xea, 0xa0, 0x39, 0x72, 0xba, 0xd1, 0xe3, 0x9b, 0xf1, 0xd6,
+  0xee, 0xc8, 0xad, 0xb7, 0xe3, 0x7d, 0xfb, 0xa3, 0xf7, 0xbd, 0x1d, 0xef, 0xdb, 0x1f, 0xbd, 0xef,
+  0x8d, 0x78, 0xdf, 0x9d, 0xe6, 0x90, 0x26, 0xf1, 0x0e, 0x3b, 0xae, 0xd4, 0x68, 0xe4, 0x02, 0xae,
+  0x57, 0x30, 0x1d, 0x0f, 0x5d, 0x4d, 0x2f, 0xdd, 0xca, 0xb5, 0x32, 0xb9, 0x3a, 0xd9, 0x85, 0xf4,
+  0x3e, 0x2a, 0x58, 0x28, 0xd8, 0xd9, 0xdf, 0x1d, 0x42, 0x16, 0xbf, 0xc2, 0x23, 0xdc, 0x8d, 0xd3,
+  0x96, 0x39, 0x19, 0x17, 0xf1, 0xfb, 0xd3, 0x8e, 0xdd, 0x4e, 0x1b, 0xcc, 0x08, 0xce, 0xc8, 0x50,
+  0x2b, 0xeb, 0x07, 0x0e, 0x43, 0xf3, 0x6f, 0xf9, 0x25, 0x18, 0xe1, 0x5e, 0x94, 0x96, 0x2e, 0xa7,
+  0x22, 0xda, 0x3d, 0x72, 0xdc, 0x1e, 0x75, 0x63, 0xc5, 0xf1, 0x41, 0x70, 0xca, 0x78, 0xfa, 0xc6,
+  0x87, 0xbd, 0x3b, 0x37, 0x4e, 0xdf, 0xfc, 0xf4, 0xeb, 0x2f, 0x5e, 0x3e, 0x7d, 0xe9, 0x16, 0x2b,
+  0xb0, 0xbb, 0xef, 0xff, 0xfc, 0xec, 0xcb, 0x8f, 0xce, 0x3e, 0xfe, 0xcd, 0xb0, 0xd3, 0x5a, 0x2d,
+  0x91, 0x66, 0x07, 0xb3, 0x19, 0xfd, 0xfc, 0x2e, 0x66, 0xd3, 0xa8, 0x3c, 0xc9, 0x0c, 0x6d, 0x94,
+  0x8b, 0xc3, 0xda, 0x3c, 0x5b, 0xc4, 0x9f, 0x28, 0xc9, 0x67, 0x58, 0x2c, 0x8f, 0x92, 0xb2, 0x28,
+  0x4f, 0xb2, 0x74, 0x36, 0x34, 0x2c, 0xdf, 0x8e, 0x27, 0x13, 0x3b, 0xed, 0x6a, 0x03, 0xaf, 0x4b,
+  0x8f, 0x65, 0xc3, 0xeb, 0x89, 0xfb, 0x1b, 0x97, 0x36, 0x2f, 0xad, 0xcd, 0x1d, 0x7a, 0xca, 0xc0,
+  0x3d, 0xf2, 0x2c, 0x25, 0xa0, 0x06, 0x49, 0xeb, 0x32, 0x85, 0x58, 0x65, 0x78, 0x4b, 0xf9, 0x78,
+  0xe4, 0xea, 0xd6, 0xf6, 0x93, 0x3f, 0x58, 0x5e, 0xde, 0x80, 0x0e, 0xf0, 0x0d, 0x61, 0xce, 0xb4,
+  0x42, 0x9e, 0x79, 0x64, 0x50, 0xe9, 0xca, 0x0e, 0x9e, 0x24, 0x96, 0x65, 0xe2, 0x7e, 0x0e, 0x2f,
+  0x78, 0xc2, 0x93, 0xf3, 0xdd, 0x58, 0x28, 0xf1, 0x08, 0xd4, 0x38, 0x60, 0x65, 0xf5, 0x48, 0xa2,
+  0xc1, 0xcb, 0x2e, 0x7a, 0x10, 0xfa, 0x58, 0x44, 0x9c, 0x40, 0xfd, 0x40, 0x91, 0x85, 0x72, 0x62,
+  0xf6, 0xcc, 0x0e, 0xfa, 0x86, 0x12, 0x97, 0x22, 0x11, 0x4d, 0x7a, 0xe0, 0xe9, 0xc0, 0x00, 0xe6,
+  0xc3, 0x30, 0x9c, 0x70, 0x71, 0xc0, 0xf4, 0xcb, 0xaf, 0x7a, 0x1f, 0xbe, 0x72, 0xef, 0xf9, 0x97,
+  0x7b, 0xaf, 0x7c, 0x7c, 0xf6, 0xd5, 0xf3, 0xa9, 0x60, 0xcc, 0xb2, 0x75, 0x39, 0x25, 0xda, 0xe0,
+  0x07, 0xa6, 0x4a, 0x55, 0x65, 0x00, 0xe0, 0x65, 0xf0, 0x97, 0x6f, 0xaa, 0x56, 0x7a, 0x4c, 0x31,
+  0x12, 0xe7, 0xd5, 0x35, 0x0f, 0x15, 0x13, 0xca, 0x43, 0x7c, 0x1a, 0xc1, 0x99, 0x04, 0x8f, 0x46,
+  0x4b, 0x74, 0xd3, 0xf0, 0xa9, 0x44, 0x81, 0xea, 0x20, 0x4f, 0x45, 0x5d, 0x10, 0xa3, 0x66, 0x1a,
+  0xc3, 0xc8, 0x2a, 0xc2, 0xe1, 0x4f, 0x15, 0xc0, 0xda, 0x4a, 0x1b, 0x45, 0x7a, 0x47, 0x4f, 0xa4,
+  0xa0, 0x6f, 0xa2, 0x58, 0xe4, 0xe9, 0xe8, 0xad, 0x9a, 0x13, 0xbf, 0xdc, 0x54, 0xcd, 0xf1, 0x5b,
+  0x03, 0x06, 0x89, 0xaa, 0xbc, 0xb4, 0x25, 0xbc, 0x6a, 0xe5, 0x3c, 0xf0, 0x59, 0x20, 0xb6, 0x09,
+  0x5d, 0x31, 0x8f, 0x29, 0xb9, 0xe1, 0xc3, 0x5a, 0x4a, 0x53, 0x46, 0x18, 0x30, 0x28, 0x60, 0x18,
+  0x60, 0x79, 0x15, 0x64, 0x81, 0xde, 0x72, 0x8c, 0x15, 0x76, 0x07, 0xdb, 0x0d, 0x75, 0xc1, 0x4c,
+  0x98, 0x98, 0x74, 0x1a, 0x10, 0xe2, 0xc2, 0x94, 0xc7, 0xb2, 0xe1, 0x88, 0x8d, 0xd2, 0xaa, 0x6d,
+  0x4c, 0x66, 0x2f, 0xe4, 0xc3, 0x39, 0x73, 0xb8, 0xc6, 0x11, 0x67, 0x86, 0x51, 0x29, 0x02, 0xe2,
+  0x99, 0x6a, 0xa9, 0x0c, 0x1f, 0xf3, 0x6c, 0x16, 0x3e, 0x2e, 0x5c, 0xc8, 0x88, 0xb6, 0x41, 0x62,
+  0xb0, 0xdd, 0xca, 0x06, 0x09, 0x1c, 0x1d, 0xd4, 0xad, 0x41, 0x36, 0x1f, 0x9d, 0xdf, 0xa2, 0x08,
+  0xa4, 0x7d, 0x45, 0x91, 0x6a, 0x59, 0xa0, 0x91, 0xf3, 0xe2, 0xef, 0x61, 0xa6, 0x02, 0x4d, 0x03,
+  0x14, 0x4c, 0xe2, 0xc9, 0x4d, 0x51, 0x21, 0x39, 0xa6, 0x33, 0x17, 0x94, 0x23, 0x31, 0x3f, 0x98,
+  0xe7, 0x0c, 0x60, 0x07, 0xf0, 0x89, 0xc4, 0x50, 0xdb, 0x50, 0xcd, 0x24, 0xcd, 0xb3, 0xe7, 0xbb,
+  0xce, 0xbe, 0xb5, 0x85, 0x07, 0xa1, 0x74, 0xfa, 0x59, 0xab, 0xd5, 0x0c, 0x2c, 0xaf, 0x58, 0x7b,
+  0x76, 0x7b, 0x03, 0xa8, 0x40, 0xa5, 0xb9, 0x97, 0x6b, 0x39, 0x07, 0xd6, 0xb6, 0x93, 0xce, 0x67,
+  0x43, 0xf8, 0xa9, 0x0a, 0xb3, 0x34, 0xa0, 0x2a, 0x26, 0x20, 0x0a, 0x80, 0x77, 0x81, 0x42, 0xbf,
+  0xb3, 0x53, 0xca, 0xe2, 0xcb, 0x0f, 0xa5, 0xe9, 0x89, 0xe9, 0x09, 0x90, 0xea, 0x9d, 0x5d, 0x98,
+  0xd8, 0x9d, 0x29, 0x2c, 0x9b, 0x9a, 0xac, 0x94, 0xea, 0x53, 0xaa, 0x6c, 0x3a, 0x0c, 0x37, 0x99,
+  0x65, 0x13, 0x54, 0x3e, 0x13, 0x86, 0xe5, 0xe5, 0xbb, 0x39, 0x98, 0x8a, 0x65, 0x13, 0xd6, 0x52,
+  0x7a, 0x67, 0x3f, 0xcb, 0x6f, 0x1e, 0xc8, 0xc2, 0x42, 0xf5, 0x1a, 0xbb, 0xc2, 0xba, 0x44, 0xc7,
+  0x49, 0x20, 0x34, 0x7c, 0xcb, 0x5f, 0x05, 0xfa, 0x97, 0x00, 0x36, 0x8d, 0x0d, 0x32, 0xd1, 0xb1,
+  0xd3, 0x2a, 0x0f, 0xf0, 0x77, 0xb2, 0xcc, 0x26, 0x9c, 0x36, 0x18, 0x38, 0x35, 0xf6, 0xce, 0x11,
+  0xcc, 0x69, 0x61, 0x37, 0x93, 0x85, 0x79, 0x10, 0xb3, 0x0b, 0x06, 0x4f, 0x71, 0x2d, 0xa1, 0x5a,
+  0xe3, 0x3d, 0xd7, 0x06, 0x51, 0x62, 0x76, 0x76, 0x33, 0x51, 0x53, 0x19, 0x52, 0xa4, 0x59, 0xd4,
+  0xcc, 0x42, 0x50, 0xe9, 0xbe, 0x8b, 0x25, 0x52, 0x84, 0x5a, 0x12, 0xae, 0xb8, 0xa0, 0xa4, 0xd9,
+  0x54, 0xa5, 0xc1, 0xdb, 0x12, 0x0d, 0xe7, 0x70, 0x4b, 0x5d, 0x05, 0x94, 0x46, 0x61, 0x1e, 0x60,
+  0x81, 0xb5, 0x4b, 0x83, 0xc2, 0x6b, 0x08, 0x18, 0xe3, 0xd1, 0x4b, 0x44, 0x17, 0x58, 0x5a, 0x7d,
+  0xe7, 0xef, 0x6c, 0xb8, 0x2d, 0xab, 0x66, 0x60, 0xba, 0x0b, 0x4b, 0xd3, 0xfe, 0xab, 0x8f, 0xaf,
+  0xba, 0xed, 0xe1, 0x99, 0x60, 0x06, 0xf3, 0x5f, 0x0c, 0xbe, 0xe5, 0x34, 0xf0, 0x7d, 0x4a, 0x79,
+  0x01, 0x4a, 0xa6, 0xef, 0x2b, 0x75, 0xa8, 0x8e, 0x77, 0x0c, 0xba, 0x4b, 0x07, 0xc4, 0x82, 0xdf,
+  0x21, 0x03, 0x5f, 0xf0, 0xbe, 0x17, 0xfc, 0xc0, 0xbb, 0x59, 0x76, 0x61, 0x11, 0x75, 0xb8, 0x4f,
+  0xb3, 0x0f, 0x0b, 0x7c, 0xd5, 0x39, 0xb4, 0xdc, 0x2b, 0xfc, 0x78, 0x1e, 0x68, 0x41, 0x9b, 0x93,
+  0x4a, 0x78, 0x23, 0x63, 0x30, 0x2b, 0x70, 0x40, 0xfb, 0x19, 0x61, 0x43, 0x33, 0xc2, 0xc7, 0xf9,
+  0x2e, 0x8e, 0x48, 0x1a, 0x36, 0x7e, 0x43, 0x09, 0x30, 0xe1, 0x22, 0xc2, 0x06, 0xe6, 0x8c, 0xec,
+  0x58, 0xce, 0xc1, 0x4c, 0x46, 0x57, 0xd8, 0x31, 0x60, 0x06, 0x38, 0x82, 0xa8, 0x7a, 0x33, 0x1c,
+  0xc8, 0xe7, 0x87, 0xec, 0x7e, 0xc3, 0x05, 0xcf, 0x01, 0x13, 0xf9, 0x96, 0xd1, 0x06, 0xa4, 0x7d,
+  0x3a, 0x5d, 0x97, 0x98, 0x3c, 0x0e, 0x95, 0x8a, 0x4f, 0x64, 0x39, 0x92, 0x51, 0xa1, 0xa4, 0x00,
+  0xcf, 0x14, 0x34, 0x89, 0xd0, 0x05, 0xab, 0x03, 0x45, 0x84, 0x45, 0x0a, 0x55, 0xcc, 0x38, 0x9d,
+  0x5f, 0x36, 0xa0, 0x61, 0x4e, 0xbc, 0x79, 0xc4, 0xfd, 0x0c, 0x25, 0x7c, 0xaa, 0xb7, 0x90, 0x2f,
+  0xc0, 0x39, 0x7b, 0x0e, 0xc3, 0x3f, 0x88, 0x05, 0xf4, 0x3a, 0x65, 0x92, 0x40, 0x62, 0x92, 0x50,
+  0xa8, 0xdc, 0xe7, 0xaf, 0xb4, 0xe3, 0x9b, 0xe9, 0x81, 0x01, 0x1a, 0x89, 0x81, 0x7c, 0x49, 0xc5,
+  0x7b, 0xaa, 0x81, 0x08, 0x01, 0x32, 0xbc, 0x30, 0x44, 0x8c, 0x72, 0x98, 0xb1, 0x27, 0xac, 0x83,
+  0x4c, 0xbd, 0x86, 0x2b, 0xca, 0x31, 0x7e, 0x0d, 0xce, 0x40, 0xb6, 0x99, 0x5a, 0x22, 0xa8, 0xe2,
+  0x5e, 0xa5, 0x5b, 0x17, 0xec, 0xd3, 0x74, 0x07, 0xed, 0x64, 0xf2, 0x8e, 0xa0, 0x5e, 0xf8, 0x2c,
+  0xe7, 0x1a, 0x44, 0x9f, 0x6d, 0x98, 0x60, 0xee, 0xc3, 0x3d, 0x04, 0x97, 0x63, 0x44, 0x33, 0x58,
+  0x79, 0xff, 0xc8, 0x5d, 0xf8, 0xa6, 0xe7, 0x96, 0x81, 0xab, 0x90, 0x0f, 0x65, 0x96, 0x4d, 0x14,
+  0xd3, 0x32, 0x97, 0x93, 0xa7, 0x7a, 0x1f, 0x4d, 0x14, 0x4a, 0xf9, 0xc9, 0x89, 0xd2, 0x84, 0xca,
+  0xb6, 0xa5, 0xa9, 0xe2, 0x7e, 0x9d, 0xb1, 0x75, 0x65, 0xa3, 0x60, 0xc8, 0xbc, 0x32, 0xfb, 0x59,
+  0x4b, 0xcf, 0xd5, 0x9a, 0x49, 0x4f, 0x2a, 0xab, 0x5c, 0x75, 0xba, 0x94, 0x74, 0xa6, 0xe7, 0xa5,
+  0x4d, 0x45, 0xf2, 0xd2, 0x30, 0x5f, 0xe8, 0x3a, 0xeb, 0xb8, 0xd6, 0x5c, 0x08, 0x4c, 0xe6, 0x7b,
+  0xd1, 0xcb, 0x63, 0xb6, 0x53, 0x0b, 0xd7, 0x16, 0xf2, 0xaa, 0xda, 0xc3, 0x8c, 0x7c, 0x4c, 0x24,
+  0x0e, 0x79, 0x12, 0x79, 0xee, 0x49, 0x70, 0x02, 0xc0, 0x8f, 0x85, 0xf1, 0x82, 0x7e, 0xdd, 0xe7,
+  0x99, 0xc1, 0xdf, 0xe3, 0x44, 0xcf, 0x2f, 0xb0, 0x30, 0x5f, 0x84, 0xdb, 0x21, 0xf9, 0xe9, 0xd0,
+  0x1b, 0x32, 0xa8, 0xa7, 0x44, 0x0b, 0x49, 0x72, 0x1d, 0x73, 0x8c, 0x70, 0xf2, 0x88, 0x24, 0x9e,
+  0x6c, 0xeb, 0x00, 0xdc, 0x24, 0x3a, 0x13, 0x00, 0x6b, 0xab, 0x21, 0xd6, 0x72, 0x5e, 0xae, 0xd3,
+  0x05, 0x4b, 0x74, 0x9d, 0xe1, 0x4d, 0x44, 0xfa, 0x10, 0x1c, 0x35, 0x02, 0xbc, 0xb6, 0x6a, 0x4e,
+  0x67, 0x20, 0xe2, 0x2a, 0x66, 0xb2, 0x29, 0xbf, 0x39, 0xc7, 0xea, 0x69, 0xe1, 0x5c, 0x65, 0xd9,
+  0x01, 0x3d, 0x16, 0xe4, 0xa3, 0x45, 0x8f, 0x45, 0xf9, 0x68, 0xd3, 0xe3, 0x04, 0x32, 0x8c, 0xbe,
+  0x4d, 0x22, 0x02, 0x17, 0xbf, 0x95, 0x14, 0x02, 0x7a, 0x9c, 0x52, 0x08, 0xe8, 0x71, 0x5a, 0x21,
+  0xa0, 0xc7, 0x19, 0x44, 0x40, 0xdf, 0x66, 0x33, 0x94, 0x89, 0x74, 0x22, 0xb3, 0x72, 0x6b, 0x41,
+  0x0a, 0xfe, 0xd6, 0x95, 0xf5, 0x8d, 0xe5, 0x27, 0x1f, 0xbf, 0xba, 0xfc, 0xc4, 0x16, 0x5d, 0x3e,
+  0xe3, 0xf1, 0x9f, 0xd8, 0xda, 0xd9, 0x31, 0x0e, 0xc8, 0x78, 0x44, 0x9d, 0x13, 0xe3, 0xc0, 0x35,
+  0x12, 0xfc, 0x13, 0xc3, 0x8f, 0x42, 0x2b, 0x17, 0x05, 0x74, 0x8a, 0x91, 0xe8, 0xa5, 0x64, 0x53,
+  0x7c, 0x65, 0x60, 0x67, 0x56, 0x72, 0x67, 0x56, 0xbc, 0x33, 0x68, 0xd6, 0x39, 0x6c, 0x51, 0xa3,
+  0x4e, 0x72, 0xa3, 0x4e, 0x32, 0x85, 0x76, 0x7f, 0x0a, 0xed, 0xbe, 0x14, 0xea, 0x8a, 0x5a, 0x5b,
+  0xfd, 0xa3, 0xc5, 0x17, 0xc1, 0x2d, 0x63, 0x7f, 0xa3, 0x00, 0x83, 0x67, 0x77, 0x2a, 0x0d, 0x85,
+  0xda, 0x5b, 0x3e, 0xe4, 0xbc, 0x50, 0xf0, 0x30, 0xcc, 0x7d, 0xe1, 0x2f, 0x6a, 0x85, 0xbd, 0x17,
+  0x85, 0x17, 0xdc, 0x14, 0xab, 0xd5, 0xf1, 0x8f, 0xc9, 0x33, 0x19, 0x33, 0xe2, 0xaf, 0x24, 0x7a,
+  0x3a, 0x78, 0xce, 0x0b, 0xf2, 0x52, 0x5d, 0x9b, 0x36, 0x1e, 0x34, 0xa1, 0xda, 0x19, 0x4c, 0x07,
+  0x5d, 0x9f, 0x28, 0x7c, 0x87, 0xdd, 0x50, 0x98, 0x11, 0x8f, 0x32, 0x3c, 0x11, 0x62, 0x88, 0x3d,
+  0x86, 0x7d, 0xda, 0x5e, 0xe0, 0x7d, 0x9e, 0x3f, 0xc0, 0xb0, 0xb9, 0xd3, 0x8a, 0x37, 0x0c, 0x69,
+  0xb1, 0xd3, 0x7f, 0x81, 0x98, 0x22, 0xe2, 0x36, 0x17, 0x50, 0x92, 0x13, 0xa9, 0x30, 0x4d, 0x4c,
+  0x3c, 0x55, 0xaa, 0xd6, 0x26, 0xa6, 0xc3, 0xc7, 0x3c, 0x93, 0x1c, 0x81, 0x27, 0xae, 0x44, 0xc9,
+  0xaa, 0xef, 0xd8, 0xbb, 0xf4, 0x93, 0x88, 0x3c, 0x9d, 0x78, 0xc7, 0xa6, 0x58, 0x93, 0x4a, 0x00,
+  0x84, 0xf5, 0x1b, 0x0d, 0xf8, 0xfa, 0x76, 0x86, 0x67, 0xaa, 0xea, 0xe1, 0x01, 0x96, 0x05, 0x82,
+  0xad, 0x0f, 0x80, 0x7e, 0x6c, 0x30, 0xc1, 0xf7, 0x8f, 0x0f, 0x60, 0x62, 0x62, 0x62, 0x00, 0x1b,
+  0xa1, 0x93, 0x40, 0x44, 0xc1, 0x26, 0x25, 0x10, 0x11, 0xad, 0x4f, 0x26, 0x28, 0xc5, 0x45, 0xec,
+  0x9b, 0x8c, 0xa9, 0xbc, 0x11, 0x02, 0x2a, 0x7b, 0x40, 0x34, 0x65, 0x9f, 0x3f, 0x94, 0x12, 0xef,
+  0x49, 0x5b, 0xe2, 0x10, 0x68, 0xb8, 0x14, 0xa0, 0x0c, 0xa4, 0x85, 0x14, 0x78, 0x98, 0x23, 0xae,
+  0x24, 0xc0, 0x0b, 0x5e, 0xd0, 0xc9, 0xb0, 0x45, 0x4d, 0x31, 0x70, 0x73, 0x8f, 0xef, 0xa2, 0xe4,
+  0xc0, 0x70, 0x61, 0x6f, 0xb8, 0xe5, 0x74, 0x7e, 0xc5, 0x24, 0x17, 0x28, 0xe6, 0xdf, 0xdf, 0xfd,
+  0xc9, 0x9f, 0xb2, 0x98, 0xa2, 0x9f, 0x4a, 0xc7, 0x16, 0x6e, 0xac, 0xe3, 0xe8, 0x46, 0x46, 0x91,
+  0xa7, 0xf0, 0x7b, 0x59, 0x76, 0xf6, 0xfe, 0x7b, 0xbd, 0xdb, 0xaf, 0xe2, 0x55, 0x99, 0x14, 0x8d,
+  0xe9, 0x72, 0x80, 0x20, 0x59, 0xf6, 0x6f, 0xff, 0x8a, 0x7d, 0xc0, 0xa2, 0x8e, 0xe4, 0xff, 0x67,
+  0xd9, 0xe9, 0x9d, 0xdb, 0xbd, 0x57, 0x3f, 0x38, 0x7d, 0xe7, 0x57, 0xd4, 0x14, 0x07, 0x35, 0x30,
+  0x72, 0xd3, 0xb5, 0x9c, 0xb6, 0x4f, 0xa9, 0x6c, 0x49, 0x39, 0xea, 0xf1, 0x0f, 0x77, 0xf8, 0x1f,
+  0xc4, 0xdf, 0x4f, 0xf2, 0xc2, 0xd5, 0xd5, 0x02, 0x0a, 0x94, 0xde, 0x59, 0x17, 0xaf, 0x6e, 0x9c,
+  0x23, 0x38, 0x3a, 0xb7, 0x2f, 0x3f, 0x28, 0xce, 0x55, 0xbf, 0x8e, 0xd3, 0x3f, 0xce, 0xf5, 0xec,
+  0xda, 0xc0, 0x13, 0x48, 0xf9, 0x9b, 0x44, 0xc2, 0xae, 0xa8, 0x83, 0xcb, 0x2e, 0x5d, 0xb0, 0x37,
+  0xa8, 0x19, 0xfd, 0x84, 0x90, 0x6a, 0x16, 0xda, 0x3f, 0xbe, 0x72, 0x69, 0x95, 0xdf, 0x16, 0xc3,
+  0x6f, 0x9b, 0x41, 0x12, 0x50, 0x1e, 0xe8, 0xee, 0x1b, 0x68, 0x15, 0xc9, 0x8e, 0xeb, 0x37, 0x30,
+  0x7c, 0xa9, 0x7a, 0xf0, 0x05, 0x33, 0xbc, 0x1f, 0x7e, 0xc1, 0x4c, 0x64, 0xcf, 0x98, 0x7e, 0x0c,
+  0x28, 0x14, 0xf3, 0x54, 0xb1, 0xe4, 0xc1, 0x12, 0x4f, 0x68, 0x4b, 0xc4, 0x17, 0x67, 0xb9, 0x94,
+  0xa7, 0xc1, 0x7f, 0xe5, 0xf6, 0x22, 0x4b, 0x1b, 0x30, 0x20, 0xca, 0xa9, 0xa1, 0x37, 0x6a, 0xa8,
+  0x12, 0x4a, 0xb8, 0xc3, 0x2d, 0x5f, 0xfa, 0x91, 0xa5, 0x1e, 0x5f, 0x52, 0x16, 0x07, 0x16, 0x9b,
+  0xc1, 0x7b, 0xfa, 0xf9, 0x06, 0x7f, 0x73, 0x55, 0xeb, 0x41, 0xe6, 0x29, 0x90, 0x54, 0x64, 0x04,
+  0x11, 0x17, 0x16, 0xe4, 0xde, 0x48, 0x50, 0xc7, 0xb7, 0x47, 0x06, 0x70, 0x55, 0xfd, 0x26, 0x50,
+  0x74, 0x1f, 0x86, 0x56, 0xa5, 0xda, 0xdb, 0x86, 0xe9, 0xb4, 0x07, 0x67, 0x42, 0x04, 0xbf, 0x00,
+  0x34, 0x38, 0x97, 0x85, 0xff, 0x74, 0xd0, 0x88, 0x39, 0x32, 0xea, 0xe7, 0x82, 0x86, 0xe4, 0xc7,
+  0x20, 0xcc, 0xe8, 0x28, 0xf9, 0xaf, 0x19, 0x25, 0x24, 0x09, 0x34, 0xac, 0x66, 0x6d, 0xbd, 0x8b,
+  0x2f, 0x78, 0x1a, 0xf7, 0xef, 0xdc, 0xbc, 0xfb, 0xfa, 0x5b, 0xbd, 0xe7, 0xff, 0xdc, 0x7b, 0xe7,
+  0xe6, 0xfd, 0x3b, 0xb7, 0xc8, 0x8f, 0xc3, 0x57, 0xc5, 0x5f, 0xfc, 0x55, 0xef, 0x15, 0xfc, 0xe1,
+  0xac, 0xd3, 0x97, 0x3f, 0xc2, 0xe2, 0x81, 0x8a, 0x8b, 0xff, 0x7a, 0xd1, 0x60, 0xd2, 0x6b, 0xab,
+  0xba, 0x72, 0x1d, 0x4c, 0xf7, 0xd2, 0xe6, 0x30, 0x64, 0x9b, 0xa3, 0x23, 0xbb, 0x3c, 0x6c, 0x9e,
+  0x46, 0xe4, 0x27, 0xff, 0xb1, 0xa4, 0xc1, 0xb8, 0x10, 0x46, 0x4f, 0xb3, 0xca, 0x0f, 0x43, 0x78,
+  0x6d, 0x14, 0x84, 0xc7, 0xe7, 0x40, 0xb8, 0xdd, 0x18, 0x05, 0x23, 0xac, 0x6f, 0xdf, 0x0c, 0x8f,
+  0x7b, 0xf0, 0x16, 0x05, 0x29, 0x8f, 0x84, 0xdd, 0x89, 0xf8, 0x1e, 0x2b, 0x29, 0x1e, 0x75, 0x22,
+  0x27, 0x5f, 0x96, 0x57, 0xd7, 0xe0, 0x0e, 0x52, 0xaa, 0xfa, 0x6d, 0xb9, 0xe1, 0xb6, 0x74, 0x25,
+  0xed, 0xd0, 0xa6, 0xfc, 0xe2, 0xda, 0x70, 0x4b, 0x7e, 0x3f, 0xed, 0xd0, 0xa6, 0xe2, 0x1a, 0xdb,
+  0x84, 0xb6, 0xdb, 0xb6, 0xdf, 0xa4, 0x40, 0xe5, 0x3a, 0x7b, 0x02, 0x96, 0x46, 0xef, 0xb3, 0x77,
+  0x7b, 0xbf, 0x79, 0x8b, 0xdf, 0xfa, 0x0b, 0x8c, 0x58, 0x83, 0xa2, 0xd3, 0x5b, 0x2f, 0xf6, 0x5e,
+  0xf8, 0xe0, 0xec, 0xfd, 0x9f, 0xf6, 0x6e, 0xfe, 0x5c, 0x55, 0x6c, 0x40, 0xc5, 0xdd, 0xd7, 0x3e,
+  0x39, 0x7d, 0xe7, 0xcf, 0x6c, 0xe3, 0xea, 0x12, 0xb8, 0x17, 0xe0, 0x40, 0xdc, 0x7b, 0xef, 0x26,
+  0xd4, 0x6c, 0x43, 0xcd, 0xb6, 0xb3, 0xc2, 0x4e, 0x7f, 0xfd, 0x6e, 0xef, 0xf9, 0x9f, 0x41, 0xc1,
+  0xa3, 0x08, 0xfa, 0xe5, 0xab, 0xf7, 0xde, 0xfd, 0xe4, 0xde, 0x73, 0xff, 0xeb, 0xf4, 0x93, 0x17,
+  0xa1, 0xe8, 0x71, 0x28, 0xa2, 0xdc, 0x9c, 0xd3, 0x5f, 0x3f, 0xdf, 0xfb, 0xe8, 0x6d, 0x7a, 0x63,
+  0x1a, 0x95, 0x30, 0x91, 0xe5, 0xad, 0x82, 0x65, 0xd6, 0xaf, 0xb9, 0x8b, 0xa4, 0xe5, 0x6c, 0x10,
+  0x10, 0x84, 0x35, 0x7c, 0x6f, 0x5a, 0x1b, 0x1f, 0x17, 0x8c, 0x47, 0xb6, 0xd7, 0x56, 0xd1, 0x29,
+  0x0e, 0xde, 0x8a, 0x77, 0x8e, 0xf8, 0x08, 0x4f, 0xe2, 0x81, 0x94, 0xc4, 0x42, 0x9a, 0x99, 0x00,
+  0x77, 0x3a, 0xb9, 0xbd, 0xdd, 0x20, 0xaa, 0x85, 0x32, 0x9d, 0xbb, 0x55, 0xd7, 0x02, 0x21, 0x10,
+  0x0c, 0x4e, 0x1b, 0x35, 0xfb, 0xc0, 0xe0, 0x3f, 0x78, 0xce, 0x5f, 0x18, 0xc3, 0x7e, 0xc3, 0x17,
+  0x32, 0xf3, 0x0b, 0x8d, 0xd5, 0x8f, 0x7d, 0xe4, 0x47, 0xbb, 0x2b, 0x9b, 0x7e, 0xff, 0x87, 0xe3,
+  0xd5, 0xc7, 0xf4, 0xd4, 0x7c, 0x63, 0x72, 0xe8, 0x8f, 0x4f, 0xd0, 0x2f, 0x8e, 0x88, 0x4b, 0x9d,
+  0xf3, 0xf8, 0xbb, 0xee, 0xfc, 0x97, 0xcf, 0x8d, 0xc5, 0x7f, 0xb8, 0x1e, 0x9d, 0x76, 0x1a, 0x2b,
+  0xc6, 0xce, 0xf0, 0x79, 0x32, 0x3f, 0xde, 0x98, 0x5c, 0x7c, 0xaa, 0x1c, 0x62, 0xa8, 0xd9, 0xe9,
+  0xa0, 0x41, 0x6e, 0xd8, 0xcd, 0x5a, 0x1a, 0x88, 0xe1, 0x43, 0x95, 0xed, 0xf0, 0x52, 0x96, 0xa3,
+  0x20, 0x12, 0xc6, 0x7b, 0x93, 0x87, 0x72, 0x0a, 0x3e, 0x72, 0x74, 0xc7, 0xf6, 0xa3, 0x78, 0x0b,
+  0x18, 0x70, 0x2b, 0x74, 0xd3, 0x36, 0xaf, 0xe7, 0xaf, 0xde, 0xf1, 0x11, 0x5c, 0x26, 0x2e, 0x22,
+  0x20, 0x0e, 0x43, 0x00, 0x84, 0x58, 0x22, 0x7e, 0x20, 0x11, 0x47, 0x97, 0x6b, 0x9f, 0x88, 0x5f,
+  0x04, 0xa1, 0xa7, 0x83, 0x93, 0x51, 0x7e, 0x56, 0x9c, 0x6e, 0x65, 0x47, 0x70, 0xf8, 0x72, 0x22,
+  0x2e, 0x67, 0xa7, 0x47, 0xf3, 0xe8, 0x44, 0x5e, 0x32, 0x8f, 0xcf, 0xf8, 0xed, 0x44, 0x5d, 0xe8,
+  0xce, 0xf1, 0x1b, 0x8b, 0xa9, 0xa7, 0x74, 0x96, 0x84, 0xf8, 0x05, 0x94, 0x06, 0xaf, 0xa9, 0xaa,
+  0x3b, 0x97, 0x81, 0xfc, 0x67, 0xba, 0x96, 0x7b, 0xbc, 0x45, 0x77, 0xe0, 0x3b, 0x6e, 0xda, 0xb0,
+  0xc3, 0x77, 0x59, 0x42, 0x07, 0xab, 0x66, 0x25, 0x19, 0xd4, 0xa3, 0xc3, 0x4a, 0x75, 0xd3, 0x6f,
+  0x9f, 0xfb, 0xe8, 0x38, 0x86, 0x3e, 0xd7, 0xd1, 0x0d, 0xbb, 0x88, 0x2e, 0x21, 0x51, 0x00, 0x3d,
+  0x11, 0xe0, 0xad, 0x3c, 0x15, 0x89, 0xa5, 0x09, 0x0c, 0xbe, 0xe5, 0x38, 0xf2, 0x26, 0x1a, 0xba,
+  0xdd, 0x62, 0x05, 0xeb, 0xde, 0x1b, 0x5f, 0xf9, 0x46, 0xe4, 0x38, 0xa4, 0x9f, 0xc3, 0x16, 0x52,
+  0x04, 0xa4, 0xf6, 0x79, 0xfb, 0x8c, 0x90, 0xde, 0x40, 0x85, 0x50, 0x65, 0xd5, 0x69, 0x75, 0x30,
+  0x9f, 0x82, 0x2d, 0xd0, 0x66, 0x8a, 0xb8, 0xcc, 0x44, 0x83, 0xa3, 0xdb, 0x46, 0xa4, 0x86, 0x15,
+  0xf2, 0x27, 0x2e, 0x06, 0xe7, 0x81, 0x40, 0x9b, 0xc7, 0x0c, 0xda, 0x9d, 0x6b, 0xc1, 0x38, 0x94,
+  0x31, 0x18, 0x6c, 0x62, 0x78, 0x87, 0x09, 0x36, 0x46, 0x33, 0x0b, 0x09, 0x6e, 0x3e, 0x12, 0xdb,
+  0x97, 0xb6, 0x05, 0x8d, 0x36, 0xa1, 0x09, 0x13, 0xc1, 0x98, 0x41, 0x3f, 0x25, 0x6e, 0x94, 0x43,
+  0x9d, 0x85, 0xde, 0x5d, 0x3d, 0x7d, 0xed, 0xd3, 0xb3, 0x4f, 0x3e, 0x33, 0x12, 0xb8, 0x93, 0x09,
+  0xcd, 0x99, 0xf6, 0x7e, 0xee, 0xa0, 0xfe, 0x88, 0xa8, 0x01, 0xdd, 0xf1, 0x9b, 0xda, 0xe5, 0x5b,
+  0xb2, 0xb0, 0x4e, 0xc5, 0x15, 0xe7, 0xf3, 0xe3, 0x15, 0xa7, 0x76, 0x8c, 0x9f, 0x0d, 0xbf, 0x05,
+  0x2b, 0xf6, 0xff, 0x02, 0x31, 0x06, 0xf2, 0x6b, 0x7f, 0x8a, 0x00, 0x00,
+};
+
+#endif // GAGAC_WEB_GZ_H
@@ -171,6 +171,14 @@ const char webpage[] PROGMEM = R"rawliteral(
       </button>
     </div>
 
+    <!-- 连续遥控：50 Hz 二进制帧，手柄左摇杆前后 + 右摇杆左右，按住 LB/RB 才走；没有手柄时按住方向键/按钮 -->
+    <div class="mode-btn-group" style="margin-top:10px;">
+      <button class="mode-btn" id="btnTeleop" style="background:#b5d5c5;">
+        Stream Teleop
+      </button>
+    </div>
+    <small id="teleInfo" style="color:#777; display:block; margin-top:6px;">teleop: off</small>
+
     <!-- 手动规划控制 -->
     <div class="mode-btn-group" style="margin-top:10px;">
       <button class="mode-btn" id="btnMp" style="background:#9fc5e8;">
@@ -204,6 +212,25 @@ const char webpage[] PROGMEM = R"rawliteral(
       </div>
     </div>
 
+    <!-- 里程计标定（UMBmark：顺/逆时针正方形，VIVE 作真值） -->
+    <div class="slider-group" style="margin-top: 20px; padding-top: 20px; border-top: 1px solid #f0f0f0;">
+      <h3 style="font-size: 0.9em; color: #888; margin-bottom: 10px; font-weight:500;">Odometry Calibration (UMBmark)</h3>
+      <div style="display:flex; gap:10px; font-size:0.85em; color:#666;">
+        <label style="flex:1;">边长 mm <input id="calSide" type="number" value="1000" min="200" step="100" style="width:100%;"></label>
+        <label style="flex:1;">每方向圈数 <input id="calRuns" type="number" value="1" min="1" max="3" style="width:100%;"></label>
+      </div>
+      <div class="mode-btn-group" style="margin-top:10px;">
+        <button class="mode-btn" id="btnCalStart" style="background:#a4d7a7;">Start Calibration</button>
+        <button class="mode-btn" id="btnCalStop" style="background:#f08080;">Stop</button>
+      </div>
+      <div style="text-align:left; font-size:0.85em; color:#666; background:#f8f9fa; padding:12px; border-radius:10px; margin-top:10px;">
+        <div>状态: <span id="calState">idle</span></div>
+        <div>闭合误差<span id="calBasis"></span>: before=<span id="calBefore">-</span> mm, after=<span id="calAfter">-</span> mm</div>
+        <div>D_L=<span id="calDL">-</span> mm, D_R=<span id="calDR">-</span> mm, b=<span id="calB">-</span> mm</div>
+        <div>里程计: X=<span id="odomX">0</span>, Y=<span id="odomY">0</span>, θ=<span id="odomTh">0</span>°</div>
+      </div>
+    </div>
+
     <div class="slider-group" style="margin-top: 20px; padding-top: 20px; border-top: 1px solid #f0f0f0;">
       <h3 style="font-size: 0.9em; color: #888; margin-bottom: 10px; font-weight:500;">VIVE Tracking Data</h3>
       <div style="text-align: left; font-size: 0.85em; color: #666; display:flex; flex-direction: column; gap:10px; background:#f8f9fa; padding:12px; border-radius:10px;">
@@ -229,129 +256,57 @@ const char webpage[] PROGMEM = R"rawliteral(
       </div>
     </div>
 
-    <!-- 参数调整面板 -->
+    <!-- 实时遥测（WebSocket 推送）与命令延迟 -->
+    <div class="slider-group" style="margin-top: 20px; padding-top: 20px; border-top: 1px solid #f0f0f0;">
+      <div style="display: flex; justify-content: space-between; align-items: center; margin-bottom: 10px;">
+        <h3 style="font-size: 0.9em; color: #888; margin: 0; font-weight:500;">Telemetry <span id="wsState" style="color:#ef9a9a;">(offline)</span></h3>
+        <select id="telRate" style="border-radius:8px; border:1px solid #ddd; font-size:0.8em;">
+          <option value="10">10 Hz</option><option value="20" selected>20 Hz</option>
+          <option value="30">30 Hz</option><option value="50">50 Hz</option>
+        </select>
+      </div>
+      <div style="text-align:left; font-size:0.85em; color:#666; background:#f8f9fa; padding:12px; border-radius:10px;">
+        <div>轮速 L: <span id="telVL">0</span> / <span id="telTL">0</span> rpm, PWM <span id="telPL">0</span></div>
+        <div>轮速 R: <span id="telVR">0</span> / <span id="telTR">0</span> rpm, PWM <span id="telPR">0</span></div>
+        <div>模式: <span id="telModes">-</span></div>
+        <div>命令→执行: <span id="telLat">-</span> ms (平均 <span id="telLatAvg">-</span>, 最大 <span id="telLatMax">-</span>)</div>
+        <div style="font-size:0.85em; color:#999;">往返 <span id="telRtt">-</span> ms, 板上等待 <span id="telAct">-</span> ms, <span id="telHz">0</span> 帧/s</div>
+      </div>
+      <!-- 轮速曲线：/history 取回每个控制周期的样本（实线 = 实际，虚线 = 目标；红 = L，蓝 = R） -->
+      <canvas id="histPlot" width="360" height="120" style="width:100%; margin-top:8px; background:#f8f9fa; border-radius:10px;"></canvas>
+      <div style="font-size:0.75em; color:#999;">最近 <span id="histSpan">0</span> s, <span id="histGap">0</span> 次丢样</div>
+    </div>
+
+    <!-- 示波器：布防后板上每个控制周期记一条，触发后冻结，下载二进制数据画图（竖线 = 触发点，虚线 = 目标/积分项） -->
+    <div class="slider-group" style="margin-top: 20px; padding-top: 20px; border-top: 1px solid #f0f0f0;">
+      <div style="display: flex; justify-content: space-between; align-items: center; margin-bottom: 10px;">
+        <h3 style="font-size: 0.9em; color: #888; margin: 0; font-weight:500;">Scope <span id="scopeState" style="color:#999;">idle</span></h3>
+        <select id="scopeView" style="border-radius:8px; border:1px solid #ddd; font-size:0.8em;">
+          <option value="speed">转速</option><option value="error">误差</option><option value="pwm">PWM / 积分</option>
+        </select>
+      </div>
+      <div style="display:flex; gap:6px; flex-wrap:wrap; align-items:center; font-size:0.8em; color:#666;">
+        <select id="scopeTrig" style="border-radius:8px; border:1px solid #ddd;">
+          <option value="setpoint">目标跳变</option><option value="error">误差超限</option>
+          <option value="mode">模式切换</option><option value="now">立即</option>
+        </select>
+        门限 <input type="number" id="scopeLevel" value="5" min="0" step="1" style="width:50px;"> rpm
+        前 <input type="number" id="scopePre" value="100" min="0" max="1023" style="width:55px;">
+        后 <input type="number" id="scopePost" value="400" min="1" max="1024" style="width:55px;">
+        <button class="mode-btn" id="btnScopeArm" style="flex:1; background:#a4d7a7;">Arm</button>
+      </div>
+      <canvas id="scopePlot" width="360" height="160" style="width:100%; margin-top:8px; background:#f8f9fa; border-radius:10px;"></canvas>
+      <div style="font-size:0.75em; color:#999;"><span id="scopeInfo">-</span> <a href="/scope/data" download="scope.bin">scope.bin</a></div>
+    </div>
+
+    <!-- 参数调整面板：滑块由 /params（两块板的参数表）生成 -->
     <div class="slider-group" style="margin-top: 20px; padding-top: 20px; border-top: 1px solid #f0f0f0;">
       <div style="display: flex; justify-content: space-between; align-items: center; margin-bottom: 15px;">
-        <h3 style="font-size: 0.9em; color: #888; margin: 0; font-weight:500;">巡墙参数调整</h3>
+        <h3 style="font-size: 0.9em; color: #888; margin: 0; font-weight:500;">参数调整</h3>
         <button id="paramToggle" style="background: #92C08E; border: none; color: white; padding: 5px 15px; border-radius: 8px; cursor: pointer; font-size: 0.8em;">展开</button>
       </div>
       <div id="paramPanel" style="display: none;">
-        <!-- 前方避障参数 -->
-        <div style="margin-bottom: 15px; padding: 10px; background: #f8f9fa; border-radius: 8px;">
-          <h4 style="font-size: 0.85em; color: #666; margin: 0 0 10px 0;">前方避障</h4>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>前方避障距离: <span id="frontTurnThVal">250</span>mm</label>
-            <input type="range" id="frontTurnTh" min="100" max="500" value="250" step="10">
-          </div>
-          <div class="slider-group">
-            <label>紧急倒车距离: <span id="frontBackupThVal">50</span>mm</label>
-            <input type="range" id="frontBackupTh" min="20" max="150" value="50" step="5">
-          </div>
-        </div>
-
-        <!-- 巡墙距离参数 -->
-        <div style="margin-bottom: 15px; padding: 10px; background: #f8f9fa; border-radius: 8px;">
-          <h4 style="font-size: 0.85em; color: #666; margin: 0 0 10px 0;">巡墙距离</h4>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>太近阈值: <span id="wallTooCloseVal">50</span>mm</label>
-            <input type="range" id="wallTooClose" min="20" max="100" value="50" step="5">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>理想距离: <span id="wallIdealVal">80</span>mm</label>
-            <input type="range" id="wallIdeal" min="50" max="150" value="80" step="5">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>太远阈值: <span id="wallTooFarVal">120</span>mm</label>
-            <input type="range" id="wallTooFar" min="80" max="200" value="120" step="5">
-          </div>
-          <div class="slider-group">
-            <label>丢墙阈值: <span id="rightLostWallVal">200</span>mm</label>
-            <input type="range" id="rightLostWall" min="150" max="300" value="200" step="10">
-          </div>
-        </div>
-
-        <!-- 速度参数 -->
-        <div style="margin-bottom: 15px; padding: 10px; background: #f8f9fa; border-radius: 8px;">
-          <h4 style="font-size: 0.85em; color: #666; margin: 0 0 10px 0;">速度参数</h4>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>前进速度: <span id="speedFwdVal">50</span></label>
-            <input type="range" id="speedFwd" min="20" max="100" value="50" step="5">
-          </div>
-          <div class="slider-group">
-            <label>倒车速度: <span id="speedBackVal">25</span></label>
-            <input type="range" id="speedBack" min="10" max="50" value="25" step="5">
-          </div>
-        </div>
-
-        <!-- 转向力度参数 -->
-        <div style="margin-bottom: 15px; padding: 10px; background: #f8f9fa; border-radius: 8px;">
-          <h4 style="font-size: 0.85em; color: #666; margin: 0 0 10px 0;">转向力度</h4>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>原地旋转: <span id="turnSpinVal">120</span></label>
-            <input type="range" id="turnSpin" min="50" max="200" value="102" step="2">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>左转修正: <span id="turnCorrectVal">12</span></label>
-            <input type="range" id="turnCorrect" min="5" max="50" value="12" step="1">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>右转找墙: <span id="turnGentleVal">12</span></label>
-            <input type="range" id="turnGentle" min="5" max="50" value="12" step="1">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>强力找墙: <span id="turnHardFindVal">100</span></label>
-            <input type="range" id="turnHardFind" min="50" max="200" value="100" step="5">
-          </div>
-          <div class="slider-group">
-            <label>微调力度: <span id="turnTinyVal">10</span></label>
-            <input type="range" id="turnTiny" min="5" max="30" value="10" step="1">
-          </div>
-        </div>
-
-        <!-- 时间参数 -->
-        <div style="margin-bottom: 15px; padding: 10px; background: #f8f9fa; border-radius: 8px;">
-          <h4 style="font-size: 0.85em; color: #666; margin: 0 0 10px 0;">时间参数 (ms)</h4>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>卡死检测周期: <span id="stallCheckTimeVal">2000</span>ms</label>
-            <input type="range" id="stallCheckTime" min="500" max="4000" value="2000" step="100">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>出胡同直行: <span id="seqExitStraightVal">700</span>ms</label>
-            <input type="range" id="seqExitStraight" min="100" max="2000" value="700" step="50">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>出胡同转弯: <span id="seqExitTurnVal">200</span>ms</label>
-            <input type="range" id="seqExitTurn" min="50" max="1500" value="200" step="50">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>出胡同停车: <span id="seqExitStopVal">100</span>ms</label>
-            <input type="range" id="seqExitStop" min="50" max="1000" value="100" step="50">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>前方避障倒车: <span id="seqFrontBackVal">300</span>ms</label>
-            <input type="range" id="seqFrontBack" min="50" max="1500" value="300" step="50">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>前方避障预停: <span id="seqFrontPreStopVal">100</span>ms</label>
-            <input type="range" id="seqFrontPreStop" min="50" max="1000" value="100" step="50">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>前方避障转向: <span id="seqFrontTurnVal">500</span>ms</label>
-            <input type="range" id="seqFrontTurn" min="100" max="2000" value="500" step="50">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>前方避障后停: <span id="seqFrontPostStopVal">100</span>ms</label>
-            <input type="range" id="seqFrontPostStop" min="50" max="1000" value="100" step="50">
-          </div>
-          <div class="slider-group" style="margin-bottom: 10px;">
-            <label>卡死倒车: <span id="seqStuckBackVal">800</span>ms</label>
-            <input type="range" id="seqStuckBack" min="100" max="2000" value="800" step="50">
-          </div>
-          <div class="slider-group">
-            <label>卡死旋转: <span id="seqStuckTurnVal">100</span>ms</label>
-            <input type="range" id="seqStuckTurn" min="50" max="1000" value="100" step="50">
-          </div>
-        </div>
+        <div id="paramGroups"><small style="color:#777;">loading...</small></div>
       </div>
     </div>
 
@@ -453,11 +408,6 @@ const char webpage[] PROGMEM = R"rawliteral(
     sendCommand("MP_ROUTE:" + routeStr);
   };
 
-  // Manual planner param update helper
-  function sendMpParam(key, val) {
-    sendCommand("MP_PARAM:" + key + "=" + val);
-  }
-
   // Sequence control (local timed straight/turn)
   btnSendSeq.onclick = () => {
     const seq = seqInput.value.trim();
@@ -483,9 +433,198 @@ const char webpage[] PROGMEM = R"rawliteral(
     updateSliderBackground(this);
   };
 
+  // WebSocket（端口 81）：命令上行为 "编号 命令"，板子在命令生效的控制周期回 ack；
+  // 连接断开时退回 HTTP /cmd 与 /viveData 轮询，每 2 秒重连
+  let ws = null;
+  let wsCmdId = 0;
+  const wsPending = new Map();   // 编号 -> 发送时刻
+
+  function wsOpen() {
+    return ws !== null && ws.readyState === WebSocket.OPEN;
+  }
+
+  function wsConnect() {
+    ws = new WebSocket("ws://" + location.hostname + ":81/");
+    ws.onopen = () => {
+      document.getElementById("wsState").innerText = "(live)";
+      document.getElementById("wsState").style.color = "#92C08E";
+    };
+    ws.onclose = () => {
+      document.getElementById("wsState").innerText = "(offline)";
+      document.getElementById("wsState").style.color = "#ef9a9a";
+      ws = null;
+      wsPending.clear();
+      setTimeout(wsConnect, 2000);
+    };
+    ws.binaryType = "arraybuffer";
+    ws.onmessage = (ev) => {
+      if (ev.data instanceof ArrayBuffer) {
+        onTeleopAck(new DataView(ev.data));
+        return;
+      }
+      const m = JSON.parse(ev.data);
+      if (m.t === "tel") renderTelemetry(m);
+      else if (m.t === "ack") onCommandAck(m);
+    };
+  }
+
   function sendCommand(cmd) {
-    fetch("/cmd?data=" + encodeURIComponent(cmd)).catch(err => console.log(err));
+    if (wsOpen()) {
+      wsCmdId = wsCmdId % 65535 + 1;
+      wsPending.set(wsCmdId, performance.now());
+      ws.send(wsCmdId + " " + cmd);
+    } else {
+      fetch("/cmd?data=" + encodeURIComponent(cmd)).catch(err => console.log(err));
+    }
+  }
+
+  // 命令到执行 = 单程网络时间 (往返 - 板上等待) / 2 + 板上从收到到输出 PWM 的时间
+  let latAvg = null;
+  let latMax = 0;
+  function onCommandAck(m) {
+    const t0 = wsPending.get(m.id);
+    if (t0 === undefined) return;
+    wsPending.delete(m.id);
+    if (m.r !== "OK") {
+      console.log("command rejected:", m.id, m.r);
+      return;
+    }
+    const rtt = performance.now() - t0;
+    const board = m.act / 1000;
+    const lat = Math.max(0, (rtt - board) / 2) + board;
+    latAvg = latAvg === null ? lat : latAvg * 0.8 + lat * 0.2;
+    latMax = Math.max(latMax, lat);
+    document.getElementById("telLat").innerText = lat.toFixed(1);
+    document.getElementById("telLatAvg").innerText = latAvg.toFixed(1);
+    document.getElementById("telLatMax").innerText = latMax.toFixed(1);
+    document.getElementById("telRtt").innerText = rtt.toFixed(1);
+    document.getElementById("telAct").innerText = board.toFixed(1);
+  }
+
+  // 连续遥控：开启后每 20 ms 发一个 12 字节二进制帧（'T', flags, seq, 线速度, 角速度 ×10, 发送时刻 ms），
+  // 按钮/方向键不再发 F/B/L/R/S 文本命令；板子只执行最新一帧，松开死人开关或 teleopTimeoutMs 收不到帧即停车
+  const TELE_PERIOD_MS = 20;
+  const TELE_DEADZONE = 0.08;
+  const btnTeleop = document.getElementById("btnTeleop");
+  const teleInfo = document.getElementById("teleInfo");
+  const teleKeys = new Set();     // 按住的方向键（可同时按前进 + 转向）
+  const teleSent = new Array(64); // seq & 63 -> [seq, 发送时刻]
+  let teleOn = false;
+  let teleTimer = null;
+  let teleSeq = 0;
+  let teleTx = 0;
+  let teleAcks = 0;
+  let teleRtt = null;
+  let teleHold = 0;
+  let teleLastTick = 0;
+  let teleJitter = 0;             // 发送间隔抖动（浏览器定时器）
+
+  function drive(cmd) {
+    if (!teleOn) sendCommand(cmd);
+  }
+
+  function teleAxis(v) {
+    return Math.abs(v) < TELE_DEADZONE ? 0 : v;
+  }
+
+  // 当前输入 -> {en, lin, ang, src}；手柄按住肩键时优先，否则用方向键/按钮
+  function teleInput() {
+    const speed = parseInt(speedSlider.value);
+    const turn = parseInt(turnSlider.value);
+    const pads = navigator.getGamepads ? navigator.getGamepads() : [];
+    for (const pad of pads) {
+      if (!pad || !pad.connected) continue;
+      const dead = (pad.buttons[4] && pad.buttons[4].pressed) || (pad.buttons[5] && pad.buttons[5].pressed);
+      if (!dead) break;
+      const ax = pad.axes.length > 2 && teleAxis(pad.axes[2]) !== 0 ? pad.axes[2] : pad.axes[0];
+      return { en: true, lin: -teleAxis(pad.axes[1]) * speed, ang: teleAxis(ax) * turn, src: "pad" };
+    }
+    const fwd = teleKeys.has("ArrowUp") || currentMoveDirection === "F";
+    const back = teleKeys.has("ArrowDown") || currentMoveDirection === "B";
+    const left = teleKeys.has("ArrowLeft") || currentTurnDirection === "L";
+    const right = teleKeys.has("ArrowRight") || currentTurnDirection === "R";
+    const lin = (fwd ? speed : 0) - (back ? speed : 0);
+    const ang = (right ? turn : 0) - (left ? turn : 0);
+    return { en: fwd || back || left || right, lin: lin, ang: ang, src: "keys" };
+  }
+
+  function teleSend(en, lin, ang) {
+    if (!wsOpen()) return false;
+    teleSeq = (teleSeq + 1) & 0xFFFF;
+    const now = performance.now();
+    const b = new DataView(new ArrayBuffer(12));
+    b.setUint8(0, 84);   // 'T'
+    b.setUint8(1, en ? 1 : 0);
+    b.setUint16(2, teleSeq, true);
+    b.setInt16(4, Math.round(Math.max(-100, Math.min(100, lin)) * 10), true);
+    b.setInt16(6, Math.round(Math.max(-100, Math.min(100, ang)) * 10), true);
+    b.setUint32(8, Math.round(now) >>> 0, true);
+    teleSent[teleSeq & 63] = [teleSeq, now];
+    ws.send(b.buffer);
+    teleTx++;
+    return true;
+  }
+
+  function teleTick() {
+    const now = performance.now();
+    if (teleLastTick) {
+      const d = Math.abs(now - teleLastTick - TELE_PERIOD_MS);
+      teleJitter += (d - teleJitter) / 16;
+    }
+    teleLastTick = now;
+    const c = teleInput();
+    if (c.en) checkManualOverride();
+    if (!teleSend(c.en, c.lin, c.ang)) {
+      teleInfo.innerText = "teleop: WebSocket offline (board stops after timeout)";
+      return;
+    }
+    if (teleTx % 10 === 0) {
+      teleInfo.innerText = "teleop: " + (c.en ? c.src + " " + c.lin.toFixed(0) + "/" + c.ang.toFixed(0) : "idle") +
+        " | rtt " + (teleRtt === null ? "-" : teleRtt.toFixed(1)) + " ms, hold " + teleHold.toFixed(2) +
+        " ms, ack " + (teleTx ? Math.round(100 * teleAcks / teleTx) : 0) + "%, tx jitter " + teleJitter.toFixed(1) + " ms";
+    }
+  }
+
+  // 回执：'A', flags, seq, 回显的发送时刻, 板上从收到到执行的微秒数
+  function onTeleopAck(v) {
+    if (v.byteLength !== 12 || v.getUint8(0) !== 65) return;
+    const seq = v.getUint16(2, true);
+    const sent = teleSent[seq & 63];
+    if (!sent || sent[0] !== seq) return;
+    const rtt = performance.now() - sent[1];
+    teleRtt = teleRtt === null ? rtt : teleRtt * 0.9 + rtt * 0.1;
+    teleHold = v.getUint32(8, true) / 1000;
+    teleAcks++;
+  }
+
+  btnTeleop.onclick = () => {
+    teleOn = !teleOn;
+    if (teleOn) {
+      teleTx = teleAcks = 0;
+      teleRtt = null;
+      teleLastTick = 0;
+      teleTimer = setInterval(teleTick, TELE_PERIOD_MS);
+      btnTeleop.innerText = "Stop Teleop";
+      btnTeleop.style.background = "#7fb89a";
+    } else {
+      clearInterval(teleTimer);
+      teleSend(false, 0, 0);   // 最后一帧：停车
+      btnTeleop.innerText = "Stream Teleop";
+      btnTeleop.style.background = "#b5d5c5";
+      teleInfo.innerText = "teleop: off";
+    }
+  };
+
+  // 窗口失焦、在按钮外松开鼠标时收不到 keyup/mouseup：清掉按住状态，免得死人开关一直算按下
+  function teleRelease() {
+    teleKeys.clear();
+    if (!teleOn) return;
+    isMoving = isTurning = false;
+    currentMoveDirection = currentTurnDirection = null;
   }
+  window.addEventListener("blur", teleRelease);
+  document.addEventListener("mouseup", () => { if (teleOn) teleRelease(); });
+  window.addEventListener("gamepadconnected", (e) => console.log("gamepad:", e.gamepad.id));
 
   // Adjust Speed slider (Q/W)
   function adjustSpeed(delta) {
@@ -496,7 +635,7 @@ const char webpage[] PROGMEM = R"rawliteral(
     updateSliderBackground(speedSlider);
 
     if (isMoving && currentMoveDirection) {
-      sendCommand(currentMoveDirection + v);
+      drive(currentMoveDirection + v);
     }
   }
 
@@ -509,7 +648,7 @@ const char webpage[] PROGMEM = R"rawliteral(
     updateSliderBackground(turnSlider);
 
     if (isTurning && currentTurnDirection) {
-      sendCommand(currentTurnDirection + v);
+      drive(currentTurnDirection + v);
     }
   }
 
@@ -520,7 +659,7 @@ const char webpage[] PROGMEM = R"rawliteral(
     currentMoveDirection = "F";
     isTurning = false;
     currentTurnDirection = null;
-    sendCommand("F" + speedSlider.value);
+    drive("F" + speedSlider.value);
   };
   buttons.B.onmousedown = () => {
     checkManualOverride();
@@ -528,7 +667,7 @@ const char webpage[] PROGMEM = R"rawliteral(
     currentMoveDirection = "B";
     isTurning = false;
     currentTurnDirection = null;
-    sendCommand("B" + speedSlider.value);
+    drive("B" + speedSlider.value);
   };
   buttons.L.onmousedown = () => {
     checkManualOverride();
@@ -536,7 +675,7 @@ const char webpage[] PROGMEM = R"rawliteral(
     currentTurnDirection = "L";
     isMoving = false;
     currentMoveDirection = null;
-    sendCommand("L" + turnSlider.value);
+    drive("L" + turnSlider.value);
   };
   buttons.R.onmousedown = () => {
     checkManualOverride();
@@ -544,7 +683,7 @@ const char webpage[] PROGMEM = R"rawliteral(
     currentTurnDirection = "R";
     isMoving = false;
     currentMoveDirection = null;
-    sendCommand("R" + turnSlider.value);
+    drive("R" + turnSlider.value);
   };
   buttons.S.onmousedown = () => {
     checkManualOverride();
@@ -552,7 +691,7 @@ const char webpage[] PROGMEM = R"rawliteral(
     isTurning = false;
     currentMoveDirection = null;
     currentTurnDirection = null;
-    sendCommand("S");
+    drive("S");
   };
 
   buttons.F.onmouseup =
@@ -563,12 +702,13 @@ const char webpage[] PROGMEM = R"rawliteral(
     isTurning = false;
     currentMoveDirection = null;
     currentTurnDirection = null;
-    sendCommand("S");
+    drive("S");
   };
 
   // Keyboard Control
   document.addEventListener("keydown", (e) => {
     if (e.repeat) return;
+    if (e.key.startsWith("Arrow")) teleKeys.add(e.key);
 
     switch (e.key) {
       case "ArrowUp":
@@ -577,7 +717,7 @@ const char webpage[] PROGMEM = R"rawliteral(
         currentMoveDirection = "F";
         isTurning = false;
         currentTurnDirection = null;
-        sendCommand("F" + speedSlider.value);
+        drive("F" + speedSlider.value);
         break;
       case "ArrowDown":
         checkManualOverride();
@@ -585,7 +725,7 @@ const char webpage[] PROGMEM = R"rawliteral(
         currentMoveDirection = "B";
         isTurning = false;
         currentTurnDirection = null;
-        sendCommand("B" + speedSlider.value);
+        drive("B" + speedSlider.value);
         break;
       case "ArrowLeft":
         checkManualOverride();
@@ -593,7 +733,7 @@ const char webpage[] PROGMEM = R"rawliteral(
         currentTurnDirection = "L";
         isMoving = false;
         currentMoveDirection = null;
-        sendCommand("L" + turnSlider.value);
+        drive("L" + turnSlider.value);
         break;
       case "ArrowRight":
         checkManualOverride();
@@ -601,7 +741,7 @@ const char webpage[] PROGMEM = R"rawliteral(
         currentTurnDirection = "R";
         isMoving = false;
         currentMoveDirection = null;
-        sendCommand("R" + turnSlider.value);
+        drive("R" + turnSlider.value);
         break;
       case "q":
       case "Q":
@@ -623,12 +763,13 @@ const char webpage[] PROGMEM = R"rawliteral(
   });
 
   document.addEventListener("keyup", (e) => {
+    teleKeys.delete(e.key);
     if (["ArrowUp", "ArrowDown", "ArrowLeft", "ArrowRight"].includes(e.key)) {
       isMoving = false;
       isTurning = false;
       currentMoveDirection = null;
       currentTurnDirection = null;
-      sendCommand("S");
+      drive("S");
     }
   });
 
@@ -660,149 +801,295 @@ const char webpage[] PROGMEM = R"rawliteral(
       .catch(err => console.log("VIVE data error:", err));
   }
 
-  setInterval(updateViveData, 1000);
+  // 遥测帧（WebSocket 推送）
+  let telFrames = 0;
+  function renderTelemetry(m) {
+    telFrames++;
+    const rate = document.getElementById("telRate");
+    if (document.activeElement !== rate) rate.value = m.hz;
+    document.getElementById("viveXVal").innerText = m.x.toFixed(1);
+    document.getElementById("viveYVal").innerText = m.y.toFixed(1);
+    document.getElementById("viveAngleVal").innerText = m.a.toFixed(1);
+    document.getElementById("frontRawX").innerText = m.fr[0];
+    document.getElementById("frontRawY").innerText = m.fr[1];
+    document.getElementById("backRawX").innerText = m.br[0];
+    document.getElementById("backRawY").innerText = m.br[1];
+    document.getElementById("frontFiltX").innerText = m.ff[0];
+    document.getElementById("frontFiltY").innerText = m.ff[1];
+    document.getElementById("backFiltX").innerText = m.bf[0];
+    document.getElementById("backFiltY").innerText = m.bf[1];
+    document.getElementById("frontStatus").innerText = m.st[0];
+    document.getElementById("backStatus").innerText = m.st[1];
+    document.getElementById("telVL").innerText = m.vl.toFixed(1);
+    document.getElementById("telVR").innerText = m.vr.toFixed(1);
+    document.getElementById("telTL").innerText = m.tl.toFixed(1);
+    document.getElementById("telTR").innerText = m.tr.toFixed(1);
+    document.getElementById("telPL").innerText = m.pl;
+    document.getElementById("telPR").innerText = m.pr;
+    const on = Object.keys(m.m).filter(k => m.m[k]);
+    document.getElementById("telModes").innerText = on.length ? on.join(" ") : "idle";
+  }
 
-  // 参数调整面板切换
-  const paramToggle = document.getElementById("paramToggle");
-  const paramPanel = document.getElementById("paramPanel");
-  // 手动规划参数面板
-  const mpParamToggle = document.createElement("button");
-  mpParamToggle.id = "mpParamToggle";
-  mpParamToggle.innerText = "展开";
-  mpParamToggle.style = "background:#92C08E;border:none;color:white;padding:5px 15px;border-radius:8px;cursor:pointer;font-size:0.8em;";
-
-  const mpParamPanel = document.createElement("div");
-  mpParamPanel.id = "mpParamPanel";
-  mpParamPanel.style.display = "none";
-  mpParamPanel.innerHTML = `
-    <div style="margin-top:15px; padding:10px; background:#f8f9fa; border-radius:8px;">
-      <h4 style="font-size:0.85em; color:#666; margin:0 0 10px 0;">手动规划参数</h4>
-      <div id="mpParamSliders"></div>
-    </div>
-  `;
+  setInterval(() => {
+    document.getElementById("telHz").innerText = telFrames;
+    telFrames = 0;
+    if (!wsOpen()) updateViveData();   // WebSocket 断开时仍按 1 秒轮询
+    const now = performance.now();
+    for (const [id, t0] of wsPending) if (now - t0 > 5000) wsPending.delete(id);
+  }, 1000);
 
-  paramToggle.onclick = () => {
-    if (paramPanel.style.display === "none") {
-      paramPanel.style.display = "block";
-      paramToggle.innerText = "收起";
-    } else {
-      paramPanel.style.display = "none";
-      paramToggle.innerText = "展开";
-    }
+  document.getElementById("telRate").onchange = function() {
+    sendCommand("PARAM:wsTelemetryHz=" + this.value);
   };
 
-  // 参数滑块初始化
-  const paramSliders = {
-    "FRONT_TURN_TH": { slider: document.getElementById("frontTurnTh"), val: document.getElementById("frontTurnThVal") },
-    "FRONT_BACKUP_TH": { slider: document.getElementById("frontBackupTh"), val: document.getElementById("frontBackupThVal") },
-    "WALL_TOO_CLOSE": { slider: document.getElementById("wallTooClose"), val: document.getElementById("wallTooCloseVal") },
-    "WALL_IDEAL": { slider: document.getElementById("wallIdeal"), val: document.getElementById("wallIdealVal") },
-    "WALL_TOO_FAR": { slider: document.getElementById("wallTooFar"), val: document.getElementById("wallTooFarVal") },
-    "RIGHT_LOST_WALL": { slider: document.getElementById("rightLostWall"), val: document.getElementById("rightLostWallVal") },
-    "SPEED_FWD": { slider: document.getElementById("speedFwd"), val: document.getElementById("speedFwdVal") },
-    "SPEED_BACK": { slider: document.getElementById("speedBack"), val: document.getElementById("speedBackVal") },
-    "TURN_SPIN": { slider: document.getElementById("turnSpin"), val: document.getElementById("turnSpinVal") },
-    "TURN_CORRECT": { slider: document.getElementById("turnCorrect"), val: document.getElementById("turnCorrectVal") },
-    "TURN_GENTLE": { slider: document.getElementById("turnGentle"), val: document.getElementById("turnGentleVal") },
-    "TURN_HARD_FIND": { slider: document.getElementById("turnHardFind"), val: document.getElementById("turnHardFindVal") },
-    "TURN_TINY": { slider: document.getElementById("turnTiny"), val: document.getElementById("turnTinyVal") },
-    "STALL_CHECK_TIME": { slider: document.getElementById("stallCheckTime"), val: document.getElementById("stallCheckTimeVal") },
-    "SEQ_EXIT_STRAIGHT_MS": { slider: document.getElementById("seqExitStraight"), val: document.getElementById("seqExitStraightVal") },
-    "SEQ_EXIT_TURN_MS": { slider: document.getElementById("seqExitTurn"), val: document.getElementById("seqExitTurnVal") },
-    "SEQ_EXIT_STOP_MS": { slider: document.getElementById("seqExitStop"), val: document.getElementById("seqExitStopVal") },
-    "SEQ_FRONT_BACK_MS": { slider: document.getElementById("seqFrontBack"), val: document.getElementById("seqFrontBackVal") },
-    "SEQ_FRONT_PRE_STOP_MS": { slider: document.getElementById("seqFrontPreStop"), val: document.getElementById("seqFrontPreStopVal") },
-    "SEQ_FRONT_TURN_MS": { slider: document.getElementById("seqFrontTurn"), val: document.getElementById("seqFrontTurnVal") },
-    "SEQ_FRONT_POST_STOP_MS": { slider: document.getElementById("seqFrontPostStop"), val: document.getElementById("seqFrontPostStopVal") },
-    "SEQ_STUCK_BACK_MS": { slider: document.getElementById("seqStuckBack"), val: document.getElementById("seqStuckBackVal") },
-    "SEQ_STUCK_TURN_MS": { slider: document.getElementById("seqStuckTurn"), val: document.getElementById("seqStuckTurnVal") }
-  };
+  wsConnect();
+
+  // 轮速历史：每 0.5 秒取一次 since 之后的全部样本（板上每 20 ms 一条），曲线不会因轮询而混叠
+  const HIST_KEEP = 500;   // 10 s
+  let histSeq = 0, histGaps = 0, hist = [];
+  function updateHistory() {
+    fetch("/history?since=" + histSeq)
+      .then(response => response.json())
+      .then(data => {
+        if (data.gap && histSeq) histGaps++;
+        if (data.seq < histSeq) hist = [];   // 板子重启过
+        histSeq = data.seq;
+        hist = hist.concat(data.s).slice(-HIST_KEEP);
+        drawHistory();
+      })
+      .catch(err => console.log("history error:", err));
+  }
+  function drawHistory() {
+    const c = document.getElementById("histPlot");
+    const g = c.getContext("2d");
+    g.clearRect(0, 0, c.width, c.height);
+    document.getElementById("histGap").innerText = histGaps;
+    if (hist.length < 2) return;
+    const t0 = hist[0][1], t1 = hist[hist.length - 1][1];
+    document.getElementById("histSpan").innerText = ((t1 - t0) / 1000).toFixed(1);
+    let lim = 10;
+    for (const p of hist) for (let k = 5; k < 9; k++) lim = Math.max(lim, Math.abs(p[k]));
+    const px = t => (t - t0) / Math.max(1, t1 - t0) * (c.width - 4) + 2;
+    const py = v => c.height / 2 - v / lim * (c.height / 2 - 4);
+    g.strokeStyle = "#ddd";
+    g.beginPath(); g.moveTo(0, c.height / 2); g.lineTo(c.width, c.height / 2); g.stroke();
+    [[5, "#e57373", []], [6, "#64b5f6", []], [7, "#e57373", [4, 3]], [8, "#64b5f6", [4, 3]]].forEach(([k, color, dash]) => {
+      g.strokeStyle = color;
+      g.setLineDash(dash);
+      g.beginPath();
+      hist.forEach((p, i) => i ? g.lineTo(px(p[1]), py(p[k])) : g.moveTo(px(p[1]), py(p[k])));
+      g.stroke();
+    });
+    g.setLineDash([]);
+  }
+  setInterval(updateHistory, 500);
+
+  // 示波器：布防后每 0.5 秒查一次状态，冻结后下载 /scope/data（20 字节头 + 每周期 24 字节，小端）
+  let scopeData = null;
+  let scopePoll = null;
 
-  // Manual planner sliders (VIVE 点对点)
-  const mpSliders = {
-    "MP_DIST_TOL": { id: "mpDistTol", label: "mpDistTolVal", min: 20, max: 150, step: 5, def: 50 },
-    "MP_ANGLE_TOL": { id: "mpAngleTol", label: "mpAngleTolVal", min: 5, max: 45, step: 1, def: 15 },
-    "MP_SPEED_FAR": { id: "mpSpeedFar", label: "mpSpeedFarVal", min: 20, max: 100, step: 5, def: 70 },
-    "MP_SPEED_NEAR": { id: "mpSpeedNear", label: "mpSpeedNearVal", min: 10, max: 80, step: 5, def: 40 },
-    "MP_TURN_RATE": { id: "mpTurnRate", label: "mpTurnRateVal", min: 30, max: 150, step: 5, def: 80 },
-    "MP_BUMP_FWD_MS": { id: "mpBumpFwd", label: "mpBumpFwdVal", min: 100, max: 1500, step: 50, def: 500 },
-    "MP_BUMP_STOP_MS": { id: "mpBumpStop", label: "mpBumpStopVal", min: 50, max: 1000, step: 50, def: 300 }
+  function showScopeState(st) {
+    document.getElementById("scopeState").innerText = st.state + (st.state === "armed" ? " (" + st.trig + ")" : "");
+  }
+
+  document.getElementById("btnScopeArm").onclick = () => {
+    const q = ["Trig", "Level", "Pre", "Post"].map(k => k.toLowerCase() + "=" +
+      encodeURIComponent(document.getElementById("scope" + k).value)).join("&");
+    fetch("/scope/arm?" + q)
+      .then(r => r.ok ? r.json() : r.text().then(t => { throw new Error(t); }))
+      .then(st => {
+        showScopeState(st);
+        clearInterval(scopePoll);
+        scopePoll = setInterval(pollScope, 500);
+      })
+      .catch(err => document.getElementById("scopeState").innerText = err.message);
   };
 
-  // 初始化所有参数滑块
-  for (const [paramName, obj] of Object.entries(paramSliders)) {
-    if (obj.slider && obj.val) {
-      updateSliderBackground(obj.slider);
-      obj.slider.oninput = function() {
-        const value = parseFloat(this.value);
-        obj.val.innerText = value;
-        updateSliderBackground(this);
-        // 实时发送参数更新
-        sendCommand("PARAM:" + paramName + "=" + value);
-      };
-    }
+  function pollScope() {
+    fetch("/scope")
+      .then(response => response.json())
+      .then(st => {
+        showScopeState(st);
+        if (st.state === "armed" || st.state === "triggered") return;
+        clearInterval(scopePoll);
+        scopePoll = null;
+        if (st.state === "done") loadScope();
+      })
+      .catch(err => console.log("scope error:", err));
+  }
+
+  function loadScope() {
+    fetch("/scope/data")
+      .then(response => response.arrayBuffer())
+      .then(buf => {
+        scopeData = parseScope(buf);
+        drawScope();
+      })
+      .catch(err => console.log("scope data error:", err));
   }
 
-  // 在页面末尾追加 MP 参数面板
-  (function mountMpPanel() {
-    const modeGroup = document.querySelector(".mode-btn-group");
-    const card = document.querySelector(".control-card");
-    if (card) {
-      const wrapper = document.createElement("div");
-      wrapper.style.marginTop = "10px";
-      wrapper.style.paddingTop = "10px";
-      wrapper.style.borderTop = "1px solid #f0f0f0";
-      const titleRow = document.createElement("div");
-      titleRow.style.display = "flex";
-      titleRow.style.justifyContent = "space-between";
-      titleRow.style.alignItems = "center";
-      titleRow.style.marginBottom = "10px";
-      const h3 = document.createElement("h3");
-      h3.style = "font-size:0.9em;color:#888;margin:0;font-weight:500;";
-      h3.innerText = "手动规划参数";
-      titleRow.appendChild(h3);
-      titleRow.appendChild(mpParamToggle);
-      wrapper.appendChild(titleRow);
-      wrapper.appendChild(mpParamPanel);
-      card.appendChild(wrapper);
+  function parseScope(buf) {
+    const v = new DataView(buf);
+    if (buf.byteLength < 20 || v.getUint32(0, true) !== 0x31504353) return null;   // "SCP1"
+    const size = v.getUint8(4);
+    const count = v.getUint16(6, true);
+    const d = { pre: v.getUint16(8, true), period: v.getUint16(10, true), s: [] };
+    for (let k = 0; k < count && 20 + (k + 1) * size <= buf.byteLength; k++) {
+      const o = 20 + k * size;
+      const f = i => v.getInt16(o + 4 + 2 * i, true);
+      d.s.push({ ms: v.getUint16(o, true), mode: v.getUint8(o + 2),
+                 tl: f(0) / 10, vl: f(1) / 10, el: f(2) / 10, il: f(3), pl: f(4),
+                 tr: f(5) / 10, vr: f(6) / 10, er: f(7) / 10, ir: f(8), pr: f(9) });
     }
-  })();
+    return d;
+  }
 
-  mpParamToggle.onclick = () => {
-    if (mpParamPanel.style.display === "none") {
-      mpParamPanel.style.display = "block";
-      mpParamToggle.innerText = "收起";
-    } else {
-      mpParamPanel.style.display = "none";
-      mpParamToggle.innerText = "展开";
+  // 红 = L，蓝 = R；实线 = 实测/误差/PWM，虚线 = 目标/积分项
+  const SCOPE_VIEWS = {
+    speed: [["vl", "#e57373", []], ["vr", "#64b5f6", []], ["tl", "#e57373", [4, 3]], ["tr", "#64b5f6", [4, 3]]],
+    error: [["el", "#e57373", []], ["er", "#64b5f6", []]],
+    pwm: [["pl", "#e57373", []], ["pr", "#64b5f6", []], ["il", "#e57373", [4, 3]], ["ir", "#64b5f6", [4, 3]]],
+  };
+
+  function drawScope() {
+    const c = document.getElementById("scopePlot");
+    const g = c.getContext("2d");
+    g.clearRect(0, 0, c.width, c.height);
+    if (!scopeData || scopeData.s.length < 2) {
+      document.getElementById("scopeInfo").innerText = scopeData ? "empty" : "-";
+      return;
+    }
+    const s = scopeData.s;
+    const series = SCOPE_VIEWS[document.getElementById("scopeView").value];
+    let lim = 1;
+    for (const p of s) for (const [k] of series) lim = Math.max(lim, Math.abs(p[k]));
+    const px = i => i / (s.length - 1) * (c.width - 4) + 2;
+    const py = v => c.height / 2 - v / lim * (c.height / 2 - 4);
+    g.strokeStyle = "#ddd";
+    g.beginPath(); g.moveTo(0, c.height / 2); g.lineTo(c.width, c.height / 2); g.stroke();
+    // 模式切换（灰色点线）与触发点（黑线）
+    g.setLineDash([1, 3]);
+    g.strokeStyle = "#aaa";
+    for (let i = 1; i < s.length; i++) {
+      if (s[i].mode !== s[i - 1].mode) { g.beginPath(); g.moveTo(px(i), 0); g.lineTo(px(i), c.height); g.stroke(); }
     }
+    g.setLineDash([]);
+    g.strokeStyle = "#333";
+    g.beginPath(); g.moveTo(px(scopeData.pre), 0); g.lineTo(px(scopeData.pre), c.height); g.stroke();
+    series.forEach(([k, color, dash]) => {
+      g.strokeStyle = color;
+      g.setLineDash(dash);
+      g.beginPath();
+      s.forEach((p, i) => i ? g.lineTo(px(i), py(p[k])) : g.moveTo(px(i), py(p[k])));
+      g.stroke();
+    });
+    g.setLineDash([]);
+    // 相邻样本间隔超过 1.5 个控制周期 = 主循环没赶上，少了控制周期
+    let late = 0;
+    for (let i = 1; i < s.length; i++) if (((s[i].ms - s[i - 1].ms) & 0xFFFF) > scopeData.period * 1.5) late++;
+    document.getElementById("scopeInfo").innerText = s.length + " 点, " +
+      ((s.length - 1) * scopeData.period / 1000).toFixed(2) + " s, 触发前 " + scopeData.pre + ", ±" +
+      lim.toFixed(1) + ", 漏周期 " + late;
+  }
+
+  document.getElementById("scopeView").onchange = drawScope;
+  fetch("/scope").then(response => response.json()).then(st => {
+    showScopeState(st);
+    if (st.state === "done") loadScope();
+    else if (st.state !== "idle") scopePoll = setInterval(pollScope, 500);
+  }).catch(err => console.log("scope error:", err));
+
+  // Odometry calibration
+  document.getElementById("btnCalStart").onclick = () => {
+    const side = document.getElementById("calSide").value;
+    const runs = document.getElementById("calRuns").value;
+    sendCommand("CAL_START:" + side + "," + runs);
   };
+  document.getElementById("btnCalStop").onclick = () => sendCommand("CAL_STOP");
+
+  function updateCalib() {
+    fetch("/calib")
+      .then(response => response.json())
+      .then(data => {
+        let state = data.active ? ("running " + (data.run + 1) + "/" + data.runs + " seg " + data.seg) : "idle";
+        if (!data.active && data.error) state += " (" + data.error + ")";
+        document.getElementById("calState").innerText = state;
+        if (data.valid) {
+          document.getElementById("calBefore").innerText = parseFloat(data.before).toFixed(1);
+          document.getElementById("calAfter").innerText = parseFloat(data.after).toFixed(1);
+          document.getElementById("calBasis").innerText = data.heldOut ? "（留出圈）" : "（拟合数据）";
+        }
+        document.getElementById("calDL").innerText = parseFloat(data.dL).toFixed(2);
+        document.getElementById("calDR").innerText = parseFloat(data.dR).toFixed(2);
+        document.getElementById("calB").innerText = parseFloat(data.b).toFixed(1);
+        document.getElementById("odomX").innerText = parseFloat(data.odom.x).toFixed(0);
+        document.getElementById("odomY").innerText = parseFloat(data.odom.y).toFixed(0);
+        document.getElementById("odomTh").innerText = parseFloat(data.odom.theta).toFixed(1);
+      })
+      .catch(err => console.log("calib error:", err));
+  }
+
+  setInterval(updateCalib, 1000);
+
+  // 参数调整面板：按分组渲染 /params 返回的参数表，拖动即发送 PARAM:名字=值
+  const paramToggle = document.getElementById("paramToggle");
+  const paramPanel = document.getElementById("paramPanel");
+  const paramGroups = document.getElementById("paramGroups");
+  const paramGroupTitles = { W: "巡墙参数", M: "手动规划参数", P: "电机 PID / 前馈", T: "ToF 校准", N: "网页遥测", V: "VIVE 标定" };
+  let paramsLoaded = false;
 
-  // 渲染 MP 参数滑块
-  (function renderMpSliders() {
-    const container = document.getElementById("mpParamSliders");
-    if (!container) return;
-    for (const [k, cfg] of Object.entries(mpSliders)) {
+  function renderParams(list) {
+    paramGroups.innerHTML = "";
+    const boxes = {};
+    for (const p of list) {
+      if (!boxes[p.g]) {
+        const box = document.createElement("div");
+        box.style = "margin-bottom:15px; padding:10px; background:#f8f9fa; border-radius:8px;";
+        box.innerHTML = `<h4 style="font-size:0.85em; color:#666; margin:0 0 10px 0;">${paramGroupTitles[p.g] || p.g}</h4>`;
+        paramGroups.appendChild(box);
+        boxes[p.g] = box;
+      }
       const div = document.createElement("div");
       div.className = "slider-group";
       div.style.marginBottom = "10px";
       div.innerHTML = `
-        <label>${k}: <span id="${cfg.label}">${cfg.def}</span></label>
-        <input type="range" id="${cfg.id}" min="${cfg.min}" max="${cfg.max}" step="${cfg.step}" value="${cfg.def}">
+        <label>${p.n}: <span>${p.v}</span></label>
+        <input type="range" min="${p.min}" max="${p.max}" step="${p.step}" value="${p.v}">
       `;
-      container.appendChild(div);
-      const slider = document.getElementById(cfg.id);
-      const valLab = document.getElementById(cfg.label);
-      if (slider && valLab) {
-        slider.oninput = function() {
-          valLab.innerText = this.value;
-          updateSliderBackground(this);
-          sendMpParam(k, this.value);
-        };
-        updateSliderBackground(slider);
-      }
+      boxes[p.g].appendChild(div);
+      const slider = div.querySelector("input");
+      const valLab = div.querySelector("span");
+      slider.oninput = function() {
+        valLab.innerText = this.value;
+        updateSliderBackground(this);
+        sendCommand("PARAM:" + p.n + "=" + this.value);
+      };
+      updateSliderBackground(slider);
     }
-  })();
+  }
+
+  // Owner 的参数经 UART 逐项传来，未收齐时稍后再取
+  function loadParams() {
+    fetch("/params")
+      .then(r => r.json())
+      .then(data => {
+        renderParams(data.params);
+        paramsLoaded = data.complete == 1;
+        if (!paramsLoaded && paramPanel.style.display !== "none") setTimeout(loadParams, 1000);
+      })
+      .catch(err => console.log("params error:", err));
+  }
+
+  paramToggle.onclick = () => {
+    if (paramPanel.style.display === "none") {
+      paramPanel.style.display = "block";
+      paramToggle.innerText = "收起";
+      if (!paramsLoaded) loadParams();
+    } else {
+      paramPanel.style.display = "none";
+      paramToggle.innerText = "展开";
+    }
+  };
 </script>
 </body>
 </html>
@@ -0,0 +1,128 @@
+/* 定长缓冲区 JSON 写入器实现 */
+
+#include "json_writer.h"
+#include <stdarg.h>
+
+JsonWriter::JsonWriter(char* buf, size_t cap)
+    : m_buf(buf), m_cap(cap), m_len(0), m_overflow(cap == 0), m_depth(0), m_hasItems(0), m_afterKey(false) {
+    if (cap) m_buf[0] = '\0';
+}
+
+void JsonWriter::put(char c) {
+    if (m_overflow) return;
+    if (m_len + 1 >= m_cap) {
+        m_overflow = true;
+        return;
+    }
+    m_buf[m_len++] = c;
+    m_buf[m_len] = '\0';
+}
+
+void JsonWriter::put(const char* s, size_t n) {
+    if (m_overflow) return;
+    if (m_len + n >= m_cap) {
+        m_overflow = true;
+        return;
+    }
+    memcpy(m_buf + m_len, s, n);
+    m_len += n;
+    m_buf[m_len] = '\0';
+}
+
+void JsonWriter::putf(const char* fmt, ...) {
+    if (m_overflow) return;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(m_buf + m_len, m_cap - m_len, fmt, ap);
+    va_end(ap);
+    if (n < 0 || m_len + (size_t)n >= m_cap) {
+        m_overflow = true;
+        m_buf[m_len] = '\0';   // 丢掉被截断的半个数
+        return;
+    }
+    m_len += n;
+}
+
+// 值或键之前：同层已有元素则补逗号；紧跟在键后面的值不加
+void JsonWriter::separator() {
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+    if (m_depth == 0) return;
+    uint16_t bit = 1u << (m_depth - 1);
+    if (m_hasItems & bit) put(',');
+    m_hasItems |= bit;
+}
+
+void JsonWriter::open(char c) {
+    separator();
+    put(c);
+    if (m_depth >= JSON_MAX_DEPTH) {
+        m_overflow = true;
+        return;
+    }
+    m_depth++;
+    m_hasItems &= ~(1u << (m_depth - 1));
+}
+
+void JsonWriter::close(char c) {
+    if (m_depth == 0) return;
+    m_depth--;
+    put(c);
+}
+
+JsonWriter& JsonWriter::key(const char* k) {
+    value(k);
+    put(':');
+    m_afterKey = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(int v) { separator(); putf("%d", v); return *this; }
+JsonWriter& JsonWriter::value(unsigned v) { separator(); putf("%u", v); return *this; }
+JsonWriter& JsonWriter::value(long v) { separator(); putf("%ld", v); return *this; }
+JsonWriter& JsonWriter::value(unsigned long v) { separator(); putf("%lu", v); return *this; }
+
+JsonWriter& JsonWriter::value(double v, uint8_t decimals) {
+    separator();
+    if (isnan(v) || isinf(v)) put("null", 4);
+    else putf("%.*f", (int)decimals, v);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool v) {
+    separator();
+    if (v) put("true", 4);
+    else put("false", 5);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(char c) {
+    char s[2] = {c, '\0'};
+    return value((const char*)s);
+}
+
+JsonWriter& JsonWriter::value(const char* s) {
+    separator();
+    if (s == nullptr) {
+        put("null", 4);
+        return *this;
+    }
+    put('"');
+    for (; *s; s++) {
+        char c = *s;
+        switch (c) {
+            case '"':  put("\\\"", 2); break;
+            case '\\': put("\\\\", 2); break;
+            case '\n': put("\\n", 2); break;
+            case '\r': put("\\r", 2); break;
+            case '\t': put("\\t", 2); break;
+            default:
+                if ((uint8_t)c < 0x20) putf("\\u%04x", (unsigned)(uint8_t)c);
+                else put(c);
+        }
+    }
+    put('"');
+    return *this;
+}
@@ -0,0 +1,60 @@
+/*
+ * 定长缓冲区 JSON 写入器：直接往调用方给的 char 数组里写，不用 String、不分配堆内存
+ * - 自动处理逗号与嵌套（最多 JSON_MAX_DEPTH 层）；字符串做 JSON 转义；NaN/Inf 写成 null
+ * - 写满后停止写入并置溢出标志，已写部分保持为合法前缀；调用方用 ok() 判断是否完整
+ *   w.beginObject().field("x", 1.5f, 1).key("a").beginArray().value(1).value(2).endArray().endObject();
+ */
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+#define JSON_MAX_DEPTH  16
+
+class JsonWriter {
+private:
+    char* m_buf;
+    size_t m_cap;
+    size_t m_len;
+    bool m_overflow;
+    uint8_t m_depth;
+    uint16_t m_hasItems;   // 按层：该层已写过元素（下一个元素前要逗号）
+    bool m_afterKey;
+
+    void put(char c);
+    void put(const char* s, size_t n);
+    void putf(const char* fmt, ...);
+    void separator();
+    void open(char c);
+    void close(char c);
+
+public:
+    JsonWriter(char* buf, size_t cap);
+
+    JsonWriter& beginObject() { open('{'); return *this; }
+    JsonWriter& endObject() { close('}'); return *this; }
+    JsonWriter& beginArray() { open('['); return *this; }
+    JsonWriter& endArray() { close(']'); return *this; }
+    JsonWriter& key(const char* k);
+
+    JsonWriter& value(int v);
+    JsonWriter& value(unsigned v);
+    JsonWriter& value(long v);
+    JsonWriter& value(unsigned long v);
+    JsonWriter& value(double v, uint8_t decimals = 2);
+    JsonWriter& value(bool v);
+    JsonWriter& value(char c);            // 单字符字符串（参数分组等）
+    JsonWriter& value(const char* s);     // nullptr 写成 null
+
+    template <typename T>
+    JsonWriter& field(const char* k, T v) { key(k); return value(v); }
+    JsonWriter& field(const char* k, double v, uint8_t decimals) { key(k); return value(v, decimals); }
+
+    // 以 \0 结尾（溢出时也是）
+    const char* c_str() const { return m_buf; }
+    size_t length() const { return m_len; }
+    bool ok() const { return !m_overflow && m_depth == 0; }
+};
+
+#endif // JSON_WRITER_H
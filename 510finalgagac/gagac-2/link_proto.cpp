@@ -0,0 +1,671 @@
+/* Owner <-> Servant UART 二进制消息层实现（COBS + CRC16 + 分类型序号） */
+
+#include "link_proto.h"
+
+uint16_t linkCrc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+size_t cobsEncode(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t codeIdx = 0;
+    size_t o = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < len; i++) {
+        if (in[i] == 0) {
+            out[codeIdx] = code;
+            codeIdx = o++;
+            code = 1;
+        } else {
+            out[o++] = in[i];
+            code++;
+            if (code == 0xFF) {
+                out[codeIdx] = code;
+                codeIdx = o++;
+                code = 1;
+            }
+        }
+    }
+    out[codeIdx] = code;
+    return o;
+}
+
+size_t cobsDecode(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t i = 0, o = 0;
+    while (i < len) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > len) return 0;
+        for (uint8_t k = 1; k < code; k++) out[o++] = in[i++];
+        if (code != 0xFF && i < len) out[o++] = 0;
+    }
+    return o;
+}
+
+// ---- 负载序列化（两端都是 ESP32 小端，浮点直接按字节拷贝） ----
+
+static size_t putFloat(uint8_t* p, float v) {
+    memcpy(p, &v, sizeof(float));
+    return sizeof(float);
+}
+
+static float getFloat(const uint8_t* p) {
+    float v;
+    memcpy(&v, p, sizeof(float));
+    return v;
+}
+
+static size_t packPayload(const LinkMessage& msg, uint8_t* p) {
+    size_t n = 0;
+    switch (msg.type) {
+        case LINK_POSE:
+            n += putFloat(p + n, msg.pose.x);
+            n += putFloat(p + n, msg.pose.y);
+            n += putFloat(p + n, msg.pose.angle);
+            memcpy(p + n, &msg.pose.stampUs, 4);
+            n += 4;
+            break;
+        case LINK_MOTION:
+            p[n++] = (uint8_t)msg.motion.mode;
+            n += putFloat(p + n, msg.motion.value);
+            memcpy(p + n, &msg.motion.stampUs, 4);
+            n += 4;
+            break;
+        case LINK_PARAM: {
+            uint8_t len = (uint8_t)strnlen(msg.param.name, LINK_PARAM_NAME_LEN - 1);
+            p[n++] = (uint8_t)msg.param.target;
+            p[n++] = len;
+            memcpy(p + n, msg.param.name, len);
+            n += len;
+            n += putFloat(p + n, msg.param.value);
+            break;
+        }
+        case LINK_MODE:
+            p[n++] = msg.mode.mode;
+            break;
+        case LINK_ACK:
+            p[n++] = msg.ack.type;
+            p[n++] = msg.ack.seq;
+            p[n++] = msg.ack.status;
+            break;
+        case LINK_HEARTBEAT:
+            memcpy(p + n, &msg.heartbeat.txUs, 4);
+            memcpy(p + n + 4, &msg.heartbeat.echoUs, 4);
+            memcpy(p + n + 8, &msg.heartbeat.echoRxUs, 4);
+            n += 12;
+            break;
+        case LINK_PARAM_DESC: {
+            uint8_t len = (uint8_t)strnlen(msg.paramDesc.name, LINK_PARAM_NAME_LEN - 1);
+            p[n++] = msg.paramDesc.index;
+            p[n++] = msg.paramDesc.count;
+            p[n++] = msg.paramDesc.type;
+            p[n++] = (uint8_t)msg.paramDesc.group;
+            n += putFloat(p + n, msg.paramDesc.value);
+            n += putFloat(p + n, msg.paramDesc.minVal);
+            n += putFloat(p + n, msg.paramDesc.maxVal);
+            n += putFloat(p + n, msg.paramDesc.step);
+            p[n++] = len;
+            memcpy(p + n, msg.paramDesc.name, len);
+            n += len;
+            break;
+        }
+    }
+    return n;
+}
+
+static bool unpackPayload(LinkMessage& msg, const uint8_t* p, size_t n) {
+    switch (msg.type) {
+        case LINK_POSE:
+            if (n != 16) return false;
+            msg.pose.x = getFloat(p);
+            msg.pose.y = getFloat(p + 4);
+            msg.pose.angle = getFloat(p + 8);
+            memcpy(&msg.pose.stampUs, p + 12, 4);
+            return true;
+        case LINK_MOTION:
+            if (n != 9) return false;
+            msg.motion.mode = (char)p[0];
+            msg.motion.value = getFloat(p + 1);
+            memcpy(&msg.motion.stampUs, p + 5, 4);
+            return true;
+        case LINK_PARAM: {
+            if (n < 2) return false;
+            uint8_t len = p[1];
+            if (len >= LINK_PARAM_NAME_LEN || n != (size_t)(2 + len + 4)) return false;
+            msg.param.target = (char)p[0];
+            memcpy(msg.param.name, p + 2, len);
+            msg.param.name[len] = '\0';
+            msg.param.value = getFloat(p + 2 + len);
+            return true;
+        }
+        case LINK_MODE:
+            if (n != 1) return false;
+            msg.mode.mode = p[0];
+            return true;
+        case LINK_ACK:
+            if (n != 3) return false;
+            msg.ack.type = p[0];
+            msg.ack.seq = p[1];
+            msg.ack.status = p[2];
+            return true;
+        case LINK_HEARTBEAT:
+            if (n != 12) return false;
+            memcpy(&msg.heartbeat.txUs, p, 4);
+            memcpy(&msg.heartbeat.echoUs, p + 4, 4);
+            memcpy(&msg.heartbeat.echoRxUs, p + 8, 4);
+            return true;
+        case LINK_PARAM_DESC: {
+            if (n < 21) return false;
+            uint8_t len = p[20];
+            if (len >= LINK_PARAM_NAME_LEN || n != (size_t)(21 + len)) return false;
+            msg.paramDesc.index = p[0];
+            msg.paramDesc.count = p[1];
+            msg.paramDesc.type = p[2];
+            msg.paramDesc.group = (char)p[3];
+            msg.paramDesc.value = getFloat(p + 4);
+            msg.paramDesc.minVal = getFloat(p + 8);
+            msg.paramDesc.maxVal = getFloat(p + 12);
+            msg.paramDesc.step = getFloat(p + 16);
+            memcpy(msg.paramDesc.name, p + 21, len);
+            msg.paramDesc.name[len] = '\0';
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---- LinkPort ----
+
+LinkPort::LinkPort() {
+    reset();
+}
+
+void LinkPort::reset() {
+    memset(m_txSeq, 0, sizeof(m_txSeq));
+    memset(m_rxSeq, 0, sizeof(m_rxSeq));
+    memset(m_rxSeen, 0, sizeof(m_rxSeen));
+    m_frameLen = 0;
+    m_inFrame = false;
+    m_skipLine = false;
+    m_line[0] = '\0';
+    m_lineLen = 0;
+    m_lineOverrun = false;
+    memset(&m_msg, 0, sizeof(m_msg));
+    m_txFrames = m_rxFrames = m_rxLines = 0;
+    m_crcErrors = m_frameErrors = m_overruns = 0;
+    m_seqGaps = m_seqDups = 0;
+}
+
+size_t LinkPort::encode(LinkMessage& msg, uint8_t* out) {
+    uint8_t raw[LINK_MAX_RAW];
+    msg.seq = m_txSeq[msg.type]++;
+    raw[0] = msg.type;
+    raw[1] = msg.seq;
+    size_t n = 2 + packPayload(msg, raw + 2);
+    uint16_t crc = linkCrc16(raw, n);
+    raw[n++] = (uint8_t)(crc & 0xFF);
+    raw[n++] = (uint8_t)(crc >> 8);
+
+    out[0] = 0x00;
+    size_t w = 1 + cobsEncode(raw, n, out + 1);
+    out[w++] = 0x00;
+    return w;
+}
+
+size_t LinkPort::send(Print& out, LinkMessage& msg) {
+    if (msg.type == 0 || msg.type >= LINK_TYPE_COUNT) return 0;
+    uint8_t wire[LINK_MAX_WIRE];
+    size_t n = encode(msg, wire);
+    m_txFrames++;
+    return out.write(wire, n);
+}
+
+size_t LinkPort::sendPose(Print& out, float x, float y, float angle, uint32_t stampUs) {
+    LinkMessage m;
+    m.type = LINK_POSE;
+    m.pose = LinkPose{x, y, angle, stampUs};
+    return send(out, m);
+}
+
+size_t LinkPort::sendMotion(Print& out, char mode, float value, uint32_t stampUs) {
+    LinkMessage m;
+    m.type = LINK_MOTION;
+    m.motion = LinkMotion{mode, value, stampUs};
+    return send(out, m);
+}
+
+size_t LinkPort::sendParam(Print& out, char target, const char* name, float value) {
+    LinkMessage m;
+    m.type = LINK_PARAM;
+    m.param.target = target;
+    strncpy(m.param.name, name, LINK_PARAM_NAME_LEN - 1);
+    m.param.name[LINK_PARAM_NAME_LEN - 1] = '\0';
+    m.param.value = value;
+    return send(out, m);
+}
+
+size_t LinkPort::sendMode(Print& out, uint8_t mode) {
+    LinkMessage m;
+    m.type = LINK_MODE;
+    m.mode.mode = mode;
+    return send(out, m);
+}
+
+size_t LinkPort::sendAck(Print& out, uint8_t type, uint8_t seq, uint8_t status) {
+    LinkMessage m;
+    m.type = LINK_ACK;
+    m.ack = LinkAck{type, seq, status};
+    return send(out, m);
+}
+
+size_t LinkPort::sendHeartbeat(Print& out, uint32_t txUs, uint32_t echoUs, uint32_t echoRxUs) {
+    LinkMessage m;
+    m.type = LINK_HEARTBEAT;
+    m.heartbeat = LinkHeartbeat{txUs, echoUs, echoRxUs};
+    return send(out, m);
+}
+
+size_t LinkPort::sendParamDesc(Print& out, const LinkParamDesc& desc) {
+    LinkMessage m;
+    m.type = LINK_PARAM_DESC;
+    m.paramDesc = desc;
+    return send(out, m);
+}
+
+// 一帧收齐（遇到结尾 0x00）：COBS 解码 -> CRC -> 类型/长度 -> 序号
+LinkRxResult LinkPort::finishFrame() {
+    uint8_t raw[LINK_MAX_WIRE];
+    size_t n = cobsDecode(m_frame, m_frameLen, raw);
+    if (n < 4) {
+        m_frameErrors++;
+        return LINK_RX_NONE;
+    }
+    uint16_t crc = (uint16_t)raw[n - 2] | ((uint16_t)raw[n - 1] << 8);
+    if (linkCrc16(raw, n - 2) != crc) {
+        m_crcErrors++;
+        return LINK_RX_NONE;
+    }
+    LinkMessage msg;
+    msg.type = raw[0];
+    msg.seq = raw[1];
+    if (msg.type == 0 || msg.type >= LINK_TYPE_COUNT || !unpackPayload(msg, raw + 2, n - 4)) {
+        m_frameErrors++;
+        return LINK_RX_NONE;
+    }
+
+    if (m_rxSeen[msg.type]) {
+        uint8_t gap = (uint8_t)(msg.seq - m_rxSeq[msg.type]);
+        if (gap == 0) {
+            m_seqDups++;
+            return LINK_RX_NONE;
+        }
+        m_seqGaps += gap - 1;
+    }
+    m_rxSeen[msg.type] = true;
+    m_rxSeq[msg.type] = msg.seq;
+    m_rxFrames++;
+    m_msg = msg;
+    return LINK_RX_MESSAGE;
+}
+
+LinkRxResult LinkPort::feed(uint8_t c) {
+    if (c == 0x00) {
+        // 0x00 只会是帧分隔符：行缓冲里还没等到换行的内容是帧残片（丢了起始 0x00），一并丢掉
+        m_lineLen = 0;
+        m_lineOverrun = false;
+        m_skipLine = false;
+        if (!m_inFrame || m_frameLen == 0) {
+            // 帧起始；失步时两帧之间的 "00 00" 也落在这里，第二个 0x00 重新开始一帧
+            m_inFrame = true;
+            m_frameLen = 0;
+            return LINK_RX_NONE;
+        }
+        // 帧结束：不论校验成败都回到文本模式，坏帧后面紧跟的 ASCII 行照常收
+        LinkRxResult r = finishFrame();
+        m_frameLen = 0;
+        m_inFrame = false;
+        return r;
+    }
+
+    if (m_inFrame) {
+        if (m_frameLen < sizeof(m_frame)) {
+            m_frame[m_frameLen++] = c;
+        } else {
+            // 超长：不是合法帧，多半是丢了结尾 0x00 后把文本当成了帧。回到文本模式，
+            // 开头已被吞掉的这一行丢弃到换行为止，下一行照常收
+            m_inFrame = false;
+            m_frameLen = 0;
+            m_skipLine = true;
+            m_overruns++;
+        }
+        return LINK_RX_NONE;
+    }
+
+    if (m_skipLine) {
+        if (c == '\n') m_skipLine = false;
+        return LINK_RX_NONE;
+    }
+
+    // ASCII 行
+    if (c == '\n') {
+        bool overrun = m_lineOverrun;
+        m_line[m_lineLen] = '\0';
+        if (m_lineLen > 0 && m_line[m_lineLen - 1] == '\r') m_line[--m_lineLen] = '\0';
+        uint16_t len = m_lineLen;
+        m_lineLen = 0;
+        m_lineOverrun = false;
+        if (overrun) {
+            m_overruns++;
+            return LINK_RX_NONE;
+        }
+        if (len == 0) return LINK_RX_NONE;
+        m_rxLines++;
+        return LINK_RX_TEXT;
+    }
+    if (m_lineLen < LINK_MAX_LINE - 1) {
+        m_line[m_lineLen++] = (char)c;
+    } else {
+        m_lineOverrun = true;
+    }
+    return LINK_RX_NONE;
+}
+
+void LinkPort::printStats(Print& out) const {
+    out.printf("link: tx=%lu rx=%lu lines=%lu crc_err=%lu frame_err=%lu overrun=%lu gap=%lu dup=%lu\n",
+               (unsigned long)m_txFrames, (unsigned long)m_rxFrames, (unsigned long)m_rxLines,
+               (unsigned long)m_crcErrors, (unsigned long)m_frameErrors, (unsigned long)m_overruns,
+               (unsigned long)m_seqGaps, (unsigned long)m_seqDups);
+}
+
+// ---- LinkReceiver ----
+
+LinkReceiver::LinkReceiver(HardwareSerial& serial, LinkPort& port)
+    : m_serial(serial), m_port(port), m_queue(NULL), m_queueDrops(0) {
+}
+
+bool LinkReceiver::begin(uint8_t depth) {
+    m_queue = xQueueCreate(depth, sizeof(LinkRxItem));
+    if (m_queue == NULL) return false;
+    // FIFO 满或线路空闲（一帧结束）时回调，不必等到超时
+    m_serial.onReceive([this]() { onData(); }, false);
+    return true;
+}
+
+// 运行在 UART 事件任务中：把驱动缓冲里的字节全部拼完
+void LinkReceiver::onData() {
+    while (m_serial.available()) {
+        LinkRxResult r = m_port.feed((uint8_t)m_serial.read());
+        if (r == LINK_RX_NONE) continue;
+
+        m_item.kind = (uint8_t)r;
+        m_item.rxUs = micros();
+        if (r == LINK_RX_MESSAGE) {
+            m_item.msg = m_port.message();
+        } else {
+            strncpy(m_item.text, m_port.text(), LINK_MAX_LINE - 1);
+            m_item.text[LINK_MAX_LINE - 1] = '\0';
+        }
+        if (xQueueSend(m_queue, &m_item, 0) != pdTRUE) m_queueDrops++;
+    }
+}
+
+bool LinkReceiver::poll(LinkRxItem& out) {
+    if (m_queue == NULL) return false;
+    return xQueueReceive(m_queue, &out, 0) == pdTRUE;
+}
+
+void LinkReceiver::printStats(Print& out) const {
+    m_port.printStats(out);
+    out.printf("link rx queue: waiting=%u drops=%lu\n",
+               m_queue ? (unsigned)uxQueueMessagesWaiting(m_queue) : 0u,
+               (unsigned long)m_queueDrops);
+}
+
+// ---- LinkClock ----
+
+LinkClock::LinkClock() {
+    reset();
+}
+
+void LinkClock::reset() {
+    m_head = 0;
+    m_count = 0;
+    m_haveBest = false;
+    m_bucketStartMs = 0;
+    m_valid = false;
+    m_refUs = 0;
+    m_offsetUs = 0;
+    m_driftPpm = 0.0f;
+    m_uncertaintyUs = 0.0f;
+}
+
+void LinkClock::addSample(uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4, uint32_t nowMs) {
+    Sample smp;
+    smp.localUs = t4;
+    // 无符号差值转有符号：两板开机时间差在 ±35 分钟内都正确
+    smp.offsetUs = (int32_t)(((int64_t)(int32_t)(t2 - t1) + (int64_t)(int32_t)(t3 - t4)) / 2);
+    smp.rttUs = (t4 - t1) - (t3 - t2);
+
+    if (!m_haveBest) {
+        m_best = smp;
+        m_haveBest = true;
+        m_bucketStartMs = nowMs;
+    } else if (smp.rttUs < m_best.rttUs) {
+        m_best = smp;
+    }
+
+    // 首个样本立即可用；之后每个桶结束时提交桶内最优样本
+    if (m_count > 0 && nowMs - m_bucketStartMs < LINK_CLOCK_BUCKET_MS) return;
+    m_samples[m_head] = m_best;
+    m_head = (m_head + 1) % LINK_CLOCK_SAMPLES;
+    if (m_count < LINK_CLOCK_SAMPLES) m_count++;
+    m_haveBest = false;
+    solve();
+}
+
+// 加权最小二乘：offset(t) = a + b * (t - ref)，权重 1/RTT²；样本不足或时间跨度太短时只估 offset
+void LinkClock::solve() {
+    const Sample& newest = m_samples[(m_head + LINK_CLOCK_SAMPLES - 1) % LINK_CLOCK_SAMPLES];
+    m_refUs = newest.localUs;
+
+    double sw = 0, st = 0, so = 0, stt = 0, sto = 0;
+    uint32_t minRtt = 0xFFFFFFFF;
+    float span = 0.0f;
+    for (uint8_t i = 0; i < m_count; i++) {
+        const Sample& smp = m_samples[i];
+        double t = (double)(int32_t)(smp.localUs - m_refUs);        // <= 0
+        double o = (double)(int32_t)(smp.offsetUs - newest.offsetUs);
+        double r = (double)smp.rttUs + 1.0;
+        double w = 1.0 / (r * r);
+        sw += w; st += w * t; so += w * o; stt += w * t * t; sto += w * t * o;
+        if (smp.rttUs < minRtt) minRtt = smp.rttUs;
+        if ((float)-t > span) span = (float)-t;
+    }
+
+    double a, b = 0.0;
+    double det = sw * stt - st * st;
+    if (m_count >= 4 && span >= 2.0e6f && det > 0.0) {
+        b = (sw * sto - st * so) / det;
+        a = (so - b * st) / sw;
+    } else {
+        a = so / sw;
+    }
+
+    // 残差 RMS（加权）
+    double res = 0.0;
+    for (uint8_t i = 0; i < m_count; i++) {
+        const Sample& smp = m_samples[i];
+        double t = (double)(int32_t)(smp.localUs - m_refUs);
+        double o = (double)(int32_t)(smp.offsetUs - newest.offsetUs);
+        double r = (double)smp.rttUs + 1.0;
+        double e = o - (a + b * t);
+        res += e * e / (r * r);
+    }
+    double rms = sqrt(res / sw);
+
+    m_offsetUs = newest.offsetUs + (int32_t)lround(a);
+    m_driftPpm = (float)(b * 1.0e6);
+    float bound = (float)minRtt / 2.0f;
+    m_uncertaintyUs = sqrtf(bound * bound + (float)(rms * rms));
+    m_valid = true;
+}
+
+int32_t LinkClock::offsetAt(uint32_t localUs) const {
+    float dt = (float)(int32_t)(localUs - m_refUs);
+    return m_offsetUs + (int32_t)(dt * m_driftPpm * 1.0e-6f);
+}
+
+uint32_t LinkClock::remoteToLocal(uint32_t remoteUs) const {
+    // offset 随时间变化极慢，用“对端时刻减去当前 offset”得到的近似本端时刻再求一次 offset
+    uint32_t guess = remoteUs - (uint32_t)m_offsetUs;
+    return remoteUs - (uint32_t)offsetAt(guess);
+}
+
+uint32_t LinkClock::localToRemote(uint32_t localUs) const {
+    return localUs + (uint32_t)offsetAt(localUs);
+}
+
+void LinkClock::printStatus(Print& out) const {
+    if (!m_valid) {
+        out.println("clock sync: not yet (no heartbeat)");
+        return;
+    }
+    out.printf("clock sync: offset=%+.3f ms ±%.3f ms, drift=%+.1f ppm, samples=%u\n",
+               m_offsetUs / 1000.0f, m_uncertaintyUs / 1000.0f, m_driftPpm, m_count);
+}
+
+// ---- LinkSupervisor ----
+
+LinkSupervisor::LinkSupervisor() {
+    m_periodMs = LINK_HB_PERIOD_MS;
+    m_timeoutMs = LINK_HB_TIMEOUT_MS;
+    m_lastTxMs = 0;
+    m_lastRxMs = 0;
+    m_alive = false;
+    m_havePeer = false;
+    m_peerTxUs = 0;
+    m_peerRxUs = 0;
+    m_peerSeq = 0;
+    m_rttUs = m_rttAvgUs = m_rttMinUs = m_rttMaxUs = 0.0f;
+    m_hbTx = m_hbRx = m_hbMissed = m_timeouts = 0;
+}
+
+void LinkSupervisor::setTimeout(uint32_t ms) {
+    m_timeoutMs = (ms < LINK_HB_TIMEOUT_MIN_MS) ? LINK_HB_TIMEOUT_MIN_MS : ms;
+}
+
+void LinkSupervisor::service(LinkPort& port, Print& out, uint32_t nowMs) {
+    if (nowMs - m_lastTxMs < m_periodMs) return;
+    m_lastTxMs = nowMs;
+    uint32_t nowUs = micros();
+    // 还没收到过对端心跳时回显 0，对端据此跳过 RTT 计算
+    port.sendHeartbeat(out, nowUs, m_havePeer ? m_peerTxUs : 0, m_havePeer ? m_peerRxUs : 0);
+    m_hbTx++;
+}
+
+void LinkSupervisor::onHeartbeat(const LinkMessage& msg, uint32_t rxUs, uint32_t nowMs) {
+    const LinkHeartbeat& hb = msg.heartbeat;
+    if (m_alive) m_hbMissed += (uint8_t)(msg.seq - m_peerSeq - 1);  // 掉线/对端重启后不累计
+    m_peerSeq = msg.seq;
+    m_hbRx++;
+    m_lastRxMs = nowMs;
+    m_alive = true;
+    m_havePeer = true;
+    m_peerTxUs = hb.txUs;
+    m_peerRxUs = rxUs;
+
+    if (hb.echoUs == 0) return;
+    uint32_t total = rxUs - hb.echoUs;           // t4 - t1
+    uint32_t hold = hb.txUs - hb.echoRxUs;       // t3 - t2（对端处理/排队时间）
+    if (hold > total) return;                     // 对端重启等情况，时间戳不成对
+    m_clock.addSample(hb.echoUs, hb.echoRxUs, hb.txUs, rxUs, nowMs);
+    m_rttUs = (float)(total - hold);
+    if (m_rttAvgUs == 0.0f) {
+        m_rttAvgUs = m_rttMinUs = m_rttMaxUs = m_rttUs;
+    } else {
+        m_rttAvgUs += 0.1f * (m_rttUs - m_rttAvgUs);
+        if (m_rttUs < m_rttMinUs) m_rttMinUs = m_rttUs;
+        if (m_rttUs > m_rttMaxUs) m_rttMaxUs = m_rttUs;
+    }
+}
+
+bool LinkSupervisor::checkLost(uint32_t nowMs) {
+    if (!m_alive || nowMs - m_lastRxMs <= m_timeoutMs) return false;
+    m_alive = false;
+    m_havePeer = false;
+    m_timeouts++;
+    m_clock.reset();   // 对端可能已重启，旧的 offset 作废
+    return true;
+}
+
+void LinkSupervisor::printStats(Print& out, uint32_t nowMs) const {
+    out.printf("link hb: %s last=%lu ms ago timeout=%lu ms | rtt=%.2f avg=%.2f min=%.2f max=%.2f ms | tx=%lu rx=%lu missed=%lu timeouts=%lu\n",
+               m_alive ? "ALIVE" : "LOST", (unsigned long)(nowMs - m_lastRxMs), (unsigned long)m_timeoutMs,
+               m_rttUs / 1000.0f, m_rttAvgUs / 1000.0f, m_rttMinUs / 1000.0f, m_rttMaxUs / 1000.0f,
+               (unsigned long)m_hbTx, (unsigned long)m_hbRx, (unsigned long)m_hbMissed,
+               (unsigned long)m_timeouts);
+}
+
+bool linkMotionFromString(const char* s, LinkMotion& m) {
+    char c = (char)toupper((unsigned char)s[0]);
+    if (c != 'F' && c != 'B' && c != 'L' && c != 'R' && c != 'S') return false;
+    if (c == 'S' && s[1] != '\0') return false;  // "SV1" 等不是运动命令
+    m.mode = c;
+    m.value = (c == 'S') ? 0.0f : (float)atof(s + 1);
+    return true;
+}
+
+void linkBenchmark(Print& out, uint32_t iterations) {
+    if (iterations == 0) iterations = 1;
+    float x = 4123.57f, y = 2987.12f, a = -123.45f;
+    volatile float sink = 0.0f;
+
+    // 原格式：printf 生成 + indexOf/substring/toFloat 解析（与 owner 端一致）
+    size_t asciiBytes = 0;
+    uint32_t t0 = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        char buf[48];
+        int n = snprintf(buf, sizeof(buf), "VIVE:%.2f,%.2f,%.2f\n", x, y, a);
+        asciiBytes = (size_t)n;
+        String line(buf);
+        line.trim();
+        int c1 = line.indexOf(',');
+        int c2 = line.indexOf(',', c1 + 1);
+        sink = sink + line.substring(5, c1).toFloat() + line.substring(c1 + 1, c2).toFloat() +
+               line.substring(c2 + 1).toFloat();
+    }
+    uint32_t asciiUs = micros() - t0;
+
+    // 二进制：编码 + 逐字节喂给另一端解析
+    static LinkPort txPort, rxPort;
+    txPort.reset();
+    rxPort.reset();
+    size_t binBytes = 0;
+    uint32_t t1 = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint8_t wire[LINK_MAX_WIRE];
+        LinkMessage m;
+        m.type = LINK_POSE;
+        m.pose = LinkPose{x, y, a, i};
+        binBytes = txPort.encode(m, wire);
+        for (size_t k = 0; k < binBytes; k++) {
+            if (rxPort.feed(wire[k]) == LINK_RX_MESSAGE) {
+                const LinkPose& p = rxPort.message().pose;
+                sink = sink + p.x + p.y + p.angle;
+            }
+        }
+    }
+    uint32_t binUs = micros() - t1;
+    (void)sink;
+
+    out.printf("LINK_BENCH pose x%lu\n", (unsigned long)iterations);
+    out.printf("  ascii : %u bytes/msg, %.2f us/msg (printf + indexOf/substring/toFloat)\n",
+               (unsigned)asciiBytes, (float)asciiUs / iterations);
+    out.printf("  binary: %u bytes/msg, %.2f us/msg (COBS + CRC16 encode + feed), decoded=%lu\n",
+               (unsigned)binBytes, (float)binUs / iterations, (unsigned long)rxPort.getRxFrames());
+}
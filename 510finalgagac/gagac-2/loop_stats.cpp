@@ -0,0 +1,99 @@
+/* 主循环周期直方图实现 */
+
+#include "loop_stats.h"
+
+const uint32_t LOOP_STATS_EDGES_US[LOOP_STATS_BUCKETS - 1] = {
+    1000, 2000, 5000, 6000, 7000, 8000, 10000, 15000, 20000, 50000, 100000
+};
+
+LoopStats::LoopStats(uint32_t budgetUs) : m_budgetUs(budgetUs), m_lastUs(0), m_started(false) {
+    memset(&m_data, 0, sizeof(m_data));
+}
+
+void LoopStats::record(uint32_t nowUs) {
+    if (!m_started) {
+        m_started = true;
+        m_lastUs = nowUs;
+        portENTER_CRITICAL(&m_mux);
+        m_data.sinceMs = millis();
+        portEXIT_CRITICAL(&m_mux);
+        return;
+    }
+    uint32_t period = nowUs - m_lastUs;
+    m_lastUs = nowUs;
+    uint8_t b = 0;
+    while (b < LOOP_STATS_BUCKETS - 1 && period > LOOP_STATS_EDGES_US[b]) b++;
+
+    portENTER_CRITICAL(&m_mux);
+    m_data.buckets[b]++;
+    m_data.count++;
+    m_data.sumUs += period;
+    if (period > m_data.maxUs) m_data.maxUs = period;
+    if (period > m_budgetUs) m_data.overBudget++;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void LoopStats::reset() {
+    portENTER_CRITICAL(&m_mux);
+    memset(&m_data, 0, sizeof(m_data));
+    m_data.sinceMs = millis();
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void LoopStats::copy(LoopStatsData& out) const {
+    portENTER_CRITICAL(&m_mux);
+    out = m_data;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+uint32_t LoopStats::percentileUs(const LoopStatsData& d, float p) {
+    if (d.count == 0) return 0;
+    uint32_t target = (uint32_t)ceilf(d.count * p);
+    if (target == 0) target = 1;
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < LOOP_STATS_BUCKETS - 1; b++) {
+        seen += d.buckets[b];
+        if (seen >= target) return min(LOOP_STATS_EDGES_US[b], d.maxUs);
+    }
+    return d.maxUs;
+}
+
+void LoopStats::toJson(JsonWriter& j) const {
+    LoopStatsData d;
+    copy(d);
+    j.beginObject();
+    j.field("n", d.count).field("ms", millis() - d.sinceMs);
+    j.field("mean", d.count ? (uint32_t)(d.sumUs / d.count) : 0u).field("max", d.maxUs);
+    j.field("p50", percentileUs(d, 0.5f)).field("p99", percentileUs(d, 0.99f));
+    j.field("over", d.overBudget).field("budget", m_budgetUs);
+    j.key("edges").beginArray();
+    for (uint8_t b = 0; b < LOOP_STATS_BUCKETS - 1; b++) j.value(LOOP_STATS_EDGES_US[b]);
+    j.endArray();
+    j.key("hist").beginArray();
+    for (uint8_t b = 0; b < LOOP_STATS_BUCKETS; b++) j.value(d.buckets[b]);
+    j.endArray();
+    j.endObject();
+}
+
+void LoopStats::printStats(Print& out) const {
+    LoopStatsData d;
+    copy(d);
+    uint32_t mean = d.count ? (uint32_t)(d.sumUs / d.count) : 0;
+    out.printf("loop period: n=%lu mean=%.2f p50<=%.1f p99<=%.1f max=%.2f ms, >%.0f ms: %lu\n",
+               (unsigned long)d.count, mean / 1000.0, percentileUs(d, 0.5f) / 1000.0,
+               percentileUs(d, 0.99f) / 1000.0, d.maxUs / 1000.0, m_budgetUs / 1000.0,
+               (unsigned long)d.overBudget);
+    uint32_t lo = 0;
+    for (uint8_t b = 0; b < LOOP_STATS_BUCKETS; b++) {
+        if (d.buckets[b] == 0) {
+            if (b < LOOP_STATS_BUCKETS - 1) lo = LOOP_STATS_EDGES_US[b];
+            continue;
+        }
+        if (b < LOOP_STATS_BUCKETS - 1) {
+            out.printf("  %5.1f-%5.1f ms: %lu\n", lo / 1000.0, LOOP_STATS_EDGES_US[b] / 1000.0, (unsigned long)d.buckets[b]);
+            lo = LOOP_STATS_EDGES_US[b];
+        } else {
+            out.printf("  >%5.1f ms:       %lu\n", lo / 1000.0, (unsigned long)d.buckets[b]);
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * 主循环周期分布：每圈记一次与上一圈开头的间隔，按固定分桶统计直方图、最大值与超控制周期的次数
+ * 用来看网页请求（尤其是 tools/cmd_flood.py 的 /cmd 洪泛）会不会拖慢控制循环
+ * record() 在主循环中调用，copy()/reset() 可在网页任务中调用（短临界区）
+ */
+
+#ifndef LOOP_STATS_H
+#define LOOP_STATS_H
+
+#include <Arduino.h>
+#include "json_writer.h"
+
+// 桶上界（微秒），最后一个桶收大于最后一个上界的所有样本；主循环末尾有 delay(5)，正常落在 5–6 ms 一档
+#define LOOP_STATS_BUCKETS  12
+extern const uint32_t LOOP_STATS_EDGES_US[LOOP_STATS_BUCKETS - 1];
+
+struct LoopStatsData {
+    uint32_t buckets[LOOP_STATS_BUCKETS];
+    uint32_t count;
+    uint32_t maxUs;
+    uint64_t sumUs;
+    uint32_t overBudget;   // 周期超过 budgetUs 的圈数（控制周期会被推迟）
+    uint32_t sinceMs;      // 开始统计的时刻
+};
+
+class LoopStats {
+private:
+    mutable portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+    LoopStatsData m_data;
+    uint32_t m_budgetUs;
+    uint32_t m_lastUs;
+    bool m_started;
+
+public:
+    explicit LoopStats(uint32_t budgetUs);
+
+    // 每圈开头调用一次
+    void record(uint32_t nowUs);
+    void reset();
+    void copy(LoopStatsData& out) const;
+
+    uint32_t getBudgetUs() const { return m_budgetUs; }
+
+    // 按直方图估计分位数（返回所在桶的上界；落在最后一个桶返回最大值）
+    static uint32_t percentileUs(const LoopStatsData& d, float p);
+    // {"n":..,"mean":..,"max":..,"p50":..,"p99":..,"over":..,"budget":..,"edges":[..],"hist":[..]}
+    void toJson(JsonWriter& j) const;
+    void printStats(Print& out) const;
+};
+
+#endif // LOOP_STATS_H
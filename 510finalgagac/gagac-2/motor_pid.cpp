@@ -0,0 +1,78 @@
+/* 车轮转速 PID + 前馈控制器实现（只依赖 C 标准库） */
+
+#include "motor_pid.h"
+#include <math.h>
+
+static float clampf(float v, float lo, float hi) {
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+void motorPidReset(MotorPidState& st) {
+    st.error = 0.0f;
+    st.lastError = 0.0f;
+    st.integral = 0.0f;
+    st.lastTarget = 0.0f;
+}
+
+void motorPidSchedule(MotorPidState& st, const MotorPidConfig& cfg, float target) {
+    float speedRatio = fabsf(target) / PID_SCHED_REF_RPM;
+
+    if (speedRatio > 1.5f) {
+        st.kp = cfg.kpBase * 1.3f;
+        st.ki = cfg.kiBase * 1.2f;
+    } else if (speedRatio < 0.5f) {
+        st.kp = cfg.kpBase * 0.8f;
+        st.ki = cfg.kiBase * 0.9f;
+    } else {
+        st.kp = cfg.kpBase;
+        st.ki = cfg.kiBase;
+    }
+    st.kd = cfg.kdBase;
+}
+
+int motorPidStep(MotorPidState& st, const MotorPidConfig& cfg, float target, float measured) {
+    motorPidSchedule(st, cfg, target);
+
+    st.error = target - measured;
+
+    // 换向：积分补的是另一个方向的前馈误差（负载/摩擦），带过去只会反着推
+    if (target * st.lastTarget < 0.0f) st.integral = 0.0f;
+    st.lastTarget = target;
+
+    float derivative = (st.error - st.lastError) / cfg.dtSec;
+    st.lastError = st.error;
+
+    float feedforward = 0.0f;
+    if (cfg.useFeedforward && target != 0.0f) {
+        feedforward = cfg.ffA * fabsf(target) + cfg.ffB;
+        if (target < 0.0f) feedforward = -feedforward;
+    }
+
+    // 抗饱和：输出已经顶到限幅（或压在死区下限）、且误差还在往同一方向推时不积分
+    float unclamped = st.kp * st.error + st.ki * st.integral + st.kd * derivative + feedforward;
+    bool saturated = (unclamped >= cfg.pwmMax && st.error > 0.0f) ||
+                     (unclamped <= -cfg.pwmMax && st.error < 0.0f);
+    if (target > 0.0f && unclamped <= cfg.deadZonePWM && st.error < 0.0f) saturated = true;
+    if (target < 0.0f && unclamped >= -cfg.deadZonePWM && st.error > 0.0f) saturated = true;
+    if (!saturated) {
+        st.integral += st.error * cfg.dtSec;
+        float integralLimit = cfg.pwmMax / (st.ki + 0.001f);
+        st.integral = clampf(st.integral, -integralLimit, integralLimit);
+    }
+
+    float output = st.kp * st.error + st.ki * st.integral + st.kd * derivative + feedforward;
+    output = clampf(output, (float)-cfg.pwmMax, (float)cfg.pwmMax);
+
+    if (target == 0.0f) {
+        output = 0.0f;
+        st.integral = 0.0f;
+    } else {
+        if (output > 0.0f && output < cfg.deadZonePWM) {
+            output = (float)cfg.deadZonePWM;
+        } else if (output < 0.0f && output > -cfg.deadZonePWM) {
+            output = (float)-cfg.deadZonePWM;
+        }
+    }
+
+    return (int)output;
+}
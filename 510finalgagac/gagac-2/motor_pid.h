@@ -0,0 +1,47 @@
+/*
+ * 车轮转速 PID + 前馈控制器（与硬件无关，可在 Linux 主机上编译）
+ * 输入目标/实测转速 (RPM)，输出带符号 PWM；增益按目标转速分段调度
+ */
+
+#ifndef MOTOR_PID_H
+#define MOTOR_PID_H
+
+#include <stdint.h>
+
+// 增益调度的参考转速：|target| / 45 RPM 作为速度比
+#define PID_SCHED_REF_RPM   45.0f
+
+// 控制器参数（由主程序的可调全局量填充）
+struct MotorPidConfig {
+    float kpBase;
+    float kiBase;
+    float kdBase;
+    float ffA;            // 前馈：PWM = A * |RPM| + B
+    float ffB;
+    bool useFeedforward;
+    int deadZonePWM;      // 非零目标时的最小 |PWM|
+    int pwmMax;
+    float dtSec;          // 控制周期
+};
+
+// 单个车轮的控制器状态
+struct MotorPidState {
+    float error;
+    float lastError;
+    float integral;
+    float lastTarget;     // 上周期目标，用于判断换向
+    float kp;             // 本周期调度后的增益（用于打印）
+    float ki;
+    float kd;
+};
+
+void motorPidReset(MotorPidState& st);
+
+// 按目标转速分段调度 Kp/Ki：高速加大、低速减小
+void motorPidSchedule(MotorPidState& st, const MotorPidConfig& cfg, float target);
+
+// 执行一个控制周期，返回 PWM（已限幅，已处理死区；target 为 0 或换向时清积分，
+// 输出已到限幅或死区下限时不再朝同一方向累积积分）
+int motorPidStep(MotorPidState& st, const MotorPidConfig& cfg, float target, float measured);
+
+#endif // MOTOR_PID_H
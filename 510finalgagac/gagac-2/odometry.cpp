@@ -0,0 +1,282 @@
+/*
+ * 轮式里程计与 UMBmark 标定实现
+ * 参考 Borenstein & Feng 的 UMBmark：
+ *   alpha = (x_cw + x_ccw) / (-4L)，beta = (x_cw - x_ccw) / (-4L)
+ *   R = (L/2) / sin(beta/2)，Ed = (R + b/2) / (R - b/2)，Eb = 90 / (90 - alpha)
+ * 坐标系：x 沿第一条直边，y 指向车体左侧；x_cw/x_ccw 为 VIVE 终点相对里程计终点的误差重心
+ */
+
+#include "odometry.h"
+
+void odomIntegrate(OdomPose& pose, long dCountL, long dCountR,
+                   const OdomGeometry& geom, float pulsesPerRev) {
+    float dL = (float)dCountL / pulsesPerRev * PI * geom.wheelDiamL;
+    float dR = (float)dCountR / pulsesPerRev * PI * geom.wheelDiamR;
+    float d = (dL + dR) / 2.0f;
+    float dTheta = (dR - dL) / geom.trackWidth;
+
+    // 圆弧中点方向近似
+    float midTheta = pose.theta + dTheta / 2.0f;
+    pose.x += d * cosf(midTheta);
+    pose.y += d * sinf(midTheta);
+    pose.theta += dTheta;
+}
+
+OdomCalibrator::OdomCalibrator() {
+    m_phase = CAL_IDLE;
+    m_side = CAL_DEFAULT_SIDE_MM;
+    m_pulsesPerRev = 1.0f;
+    m_runsPerDir = 1;
+    m_geom = OdomGeometry{0.0f, 0.0f, 0.0f};
+    m_runIdx = 0;
+    m_segIdx = 0;
+    m_segStartL = 0;
+    m_segStartR = 0;
+    m_phaseStartMs = 0;
+    m_sumX = m_sumY = 0.0f;
+    m_sumN = 0;
+    m_result.valid = false;
+    m_result.solved = false;
+    m_error = "";
+}
+
+bool OdomCalibrator::start(float sideMm, uint8_t runsPerDir, const OdomGeometry& current, float pulsesPerRev) {
+    if (sideMm < 200.0f || runsPerDir == 0) return false;
+    m_side = sideMm;
+    m_runsPerDir = (runsPerDir > CAL_MAX_RUNS_PER_DIR) ? CAL_MAX_RUNS_PER_DIR : runsPerDir;
+    m_geom = current;
+    m_pulsesPerRev = pulsesPerRev;
+    // 先顺时针全部跑完，再逆时针
+    for (uint8_t i = 0; i < 2 * m_runsPerDir; i++) {
+        m_runs[i].cw = (i < m_runsPerDir);
+    }
+    m_runIdx = 0;
+    m_segIdx = 0;
+    m_result.valid = false;
+    m_result.solved = false;
+    m_error = "";
+    m_phase = CAL_SETTLE;
+    m_phaseStartMs = 0;  // 首次 step 时初始化
+    return true;
+}
+
+void OdomCalibrator::stop() {
+    if (m_phase != CAL_IDLE) m_error = "aborted";
+    m_phase = CAL_IDLE;
+}
+
+void OdomCalibrator::beginSettle(uint32_t nowMs) {
+    m_phase = CAL_SETTLE;
+    m_phaseStartMs = nowMs;
+    m_sumX = m_sumY = 0.0f;
+    m_sumN = 0;
+}
+
+// 以标称几何判断当前段是否完成：直边看平均行程，转角看两轮弧长
+bool OdomCalibrator::segmentDone(uint8_t seg, long countL, long countR) const {
+    float mmPerCountL = PI * m_geom.wheelDiamL / m_pulsesPerRev;
+    float mmPerCountR = PI * m_geom.wheelDiamR / m_pulsesPerRev;
+    float dL = (float)(countL - m_segStartL) * mmPerCountL;
+    float dR = (float)(countR - m_segStartR) * mmPerCountR;
+
+    if ((seg % 2) == 0) {
+        return (dL + dR) / 2.0f >= m_side;
+    }
+    float arc = (fabsf(dL) + fabsf(dR)) / 2.0f;
+    return arc >= (PI / 2.0f) * (m_geom.trackWidth / 2.0f);
+}
+
+void OdomCalibrator::step(uint32_t nowMs, long countL, long countR,
+                          float viveX, float viveY, bool viveValid,
+                          float& targetL, float& targetR) {
+    targetL = 0.0f;
+    targetR = 0.0f;
+    if (m_phase == CAL_IDLE) return;
+
+    if (m_phase == CAL_SETTLE) {
+        if (m_phaseStartMs == 0) beginSettle(nowMs);
+        if (viveValid) {
+            m_sumX += viveX;
+            m_sumY += viveY;
+            m_sumN++;
+        }
+        if (nowMs - m_phaseStartMs < CAL_SETTLE_MS) return;
+
+        if (m_sumN == 0) {
+            m_error = "no VIVE fix";
+            m_phase = CAL_IDLE;
+            return;
+        }
+
+        Run& run = m_runs[m_runIdx];
+        // 记录上一段的编码器增量（含停车滑行部分）
+        if (m_segIdx > 0) {
+            run.seg[m_segIdx - 1].dCountL = countL - m_segStartL;
+            run.seg[m_segIdx - 1].dCountR = countR - m_segStartR;
+        }
+        run.viveX[m_segIdx] = m_sumX / m_sumN;
+        run.viveY[m_segIdx] = m_sumY / m_sumN;
+
+        if (m_segIdx == 8) {
+            m_runIdx++;
+            m_segIdx = 0;
+            if (m_runIdx >= 2 * m_runsPerDir) {
+                computeResult();
+                m_phase = CAL_IDLE;
+                return;
+            }
+            // 下一轮从当前位置重新起步（再停一次取起点坐标）
+            beginSettle(nowMs);
+            return;
+        }
+
+        m_segStartL = countL;
+        m_segStartR = countR;
+        m_segIdx++;
+        m_phase = CAL_MOVE;
+        m_phaseStartMs = nowMs;
+        return;
+    }
+
+    // CAL_MOVE：m_segIdx 已指向“正在跑的段 + 1”
+    uint8_t seg = m_segIdx - 1;
+    if (nowMs - m_phaseStartMs > CAL_SEGMENT_TIMEOUT_MS) {
+        m_error = "segment timeout";
+        m_phase = CAL_IDLE;
+        return;
+    }
+
+    if (segmentDone(seg, countL, countR)) {
+        beginSettle(nowMs);
+        return;
+    }
+
+    if ((seg % 2) == 0) {
+        targetL = CAL_DRIVE_RPM;
+        targetR = CAL_DRIVE_RPM;
+    } else if (m_runs[m_runIdx].cw) {
+        // 顺时针 = 原地右转
+        targetL = CAL_TURN_RPM;
+        targetR = -CAL_TURN_RPM;
+    } else {
+        targetL = -CAL_TURN_RPM;
+        targetR = CAL_TURN_RPM;
+    }
+}
+
+// 把一轮的 VIVE 终点换算到“起点坐标系”：x 沿第一条直边弦方向，y 指向左侧
+// VIVE 坐标系手性未知，用第一次转向的方向判断是否镜像
+void OdomCalibrator::runEndInFrame(const Run& r, float& ax, float& ay) const {
+    float ux = r.viveX[1] - r.viveX[0];
+    float uy = r.viveY[1] - r.viveY[0];
+    float n = sqrtf(ux * ux + uy * uy);
+    if (n < 1.0f) { ax = ay = 0.0f; return; }
+    ux /= n; uy /= n;
+
+    float lx = -uy, ly = ux;  // 右手系下的左侧方向
+    float l2x = r.viveX[3] - r.viveX[2];
+    float l2y = r.viveY[3] - r.viveY[2];
+    float cross = ux * l2y - uy * l2x;
+    bool turnedLeft = cross > 0.0f;
+    if (turnedLeft == r.cw) { lx = -lx; ly = -ly; }  // 顺时针却“左转”→ 坐标系镜像
+
+    float ex = r.viveX[8] - r.viveX[0];
+    float ey = r.viveY[8] - r.viveY[0];
+    ax = ex * ux + ey * uy;
+    ay = ex * lx + ey * ly;
+}
+
+// 每方向 2 圈以上时，每个方向的最后一圈留作验证
+bool OdomCalibrator::isHeldOut(uint8_t run) const {
+    return m_runsPerDir >= 2 && (run == m_runsPerDir - 1 || run == 2 * m_runsPerDir - 1);
+}
+
+// 用给定几何重新积分编码器数据，计算 UMBmark 闭合误差（有留出圈时只用留出圈）
+float OdomCalibrator::closureError(const OdomGeometry& g) const {
+    float cgX[2] = {0, 0}, cgY[2] = {0, 0};
+    uint8_t n = (m_runsPerDir >= 2) ? 1 : m_runsPerDir;
+    for (uint8_t i = 0; i < 2 * m_runsPerDir; i++) {
+        if (m_runsPerDir >= 2 && !isHeldOut(i)) continue;
+        const Run& r = m_runs[i];
+        OdomPose p = {0.0f, 0.0f, 0.0f};
+        for (uint8_t s = 0; s < 8; s++) {
+            odomIntegrate(p, r.seg[s].dCountL, r.seg[s].dCountR, g, m_pulsesPerRev);
+        }
+        float ax, ay;
+        runEndInFrame(r, ax, ay);
+        uint8_t dir = r.cw ? 0 : 1;
+        cgX[dir] += (ax - p.x) / n;
+        cgY[dir] += (ay - p.y) / n;
+    }
+    float eCw = sqrtf(cgX[0] * cgX[0] + cgY[0] * cgY[0]);
+    float eCcw = sqrtf(cgX[1] * cgX[1] + cgY[1] * cgY[1]);
+    return (eCw > eCcw) ? eCw : eCcw;
+}
+
+void OdomCalibrator::computeResult() {
+    const OdomGeometry& g = m_geom;
+    float xCw = 0.0f, xCcw = 0.0f;
+    float viveLen = 0.0f, odomLen = 0.0f;
+    float avgDiam = (g.wheelDiamL + g.wheelDiamR) / 2.0f;
+    uint8_t fitRuns = (m_runsPerDir >= 2) ? m_runsPerDir - 1 : m_runsPerDir;
+
+    for (uint8_t i = 0; i < 2 * m_runsPerDir; i++) {
+        if (isHeldOut(i)) continue;
+        const Run& r = m_runs[i];
+        OdomPose p = {0.0f, 0.0f, 0.0f};
+        for (uint8_t s = 0; s < 8; s++) {
+            odomIntegrate(p, r.seg[s].dCountL, r.seg[s].dCountR, g, m_pulsesPerRev);
+            if ((s % 2) == 0) {
+                float dx = r.viveX[s + 1] - r.viveX[s];
+                float dy = r.viveY[s + 1] - r.viveY[s];
+                viveLen += sqrtf(dx * dx + dy * dy);
+                odomLen += (float)(r.seg[s].dCountL + r.seg[s].dCountR) / 2.0f
+                           / m_pulsesPerRev * PI * avgDiam;
+            }
+        }
+        float ax, ay;
+        runEndInFrame(r, ax, ay);
+        if (r.cw) xCw += (ax - p.x) / fitRuns;
+        else      xCcw += (ax - p.x) / fitRuns;
+    }
+
+    OdomCalResult& res = m_result;
+    res.before = g;
+    res.scale = (odomLen > 1.0f) ? viveLen / odomLen : 1.0f;
+
+    float L = m_side;
+    float alpha = (xCw + xCcw) / (-4.0f * L);
+    float beta = (xCw - xCcw) / (-4.0f * L);
+    res.alphaDeg = alpha * 180.0f / PI;
+    res.betaDeg = beta * 180.0f / PI;
+
+    float halfB = g.trackWidth / 2.0f;
+    if (fabsf(beta) > 1e-6f) {
+        float R = (L / 2.0f) / sinf(beta / 2.0f);
+        res.ed = (R + halfB) / (R - halfB);
+    } else {
+        res.ed = 1.0f;
+    }
+    res.eb = (PI / 2.0f) / (PI / 2.0f - alpha);
+
+    // 平均轮径按 VIVE 直边长度缩放；转角弧长是按旧轮径算的，轮距同样乘以 scale
+    float da = avgDiam * res.scale;
+    res.after.wheelDiamL = 2.0f / (res.ed + 1.0f) * da;
+    res.after.wheelDiamR = 2.0f / (1.0f / res.ed + 1.0f) * da;
+    res.after.trackWidth = res.eb * res.scale * g.trackWidth;
+
+    res.heldOut = m_runsPerDir >= 2;
+    res.closureBefore = closureError(res.before);
+    res.closureAfter = closureError(res.after);
+    res.solved = isfinite(res.after.wheelDiamL) && isfinite(res.after.wheelDiamR) &&
+                 isfinite(res.after.trackWidth) && res.after.trackWidth > 0.0f;
+    if (!res.solved) {
+        res.valid = false;
+        m_error = "solve failed";
+        return;
+    }
+    res.valid = res.scale >= CAL_SCALE_MIN && res.scale <= CAL_SCALE_MAX &&
+                res.ed >= CAL_RATIO_MIN && res.ed <= CAL_RATIO_MAX &&
+                res.eb >= CAL_RATIO_MIN && res.eb <= CAL_RATIO_MAX;
+    if (!res.valid) m_error = "result out of range";
+}
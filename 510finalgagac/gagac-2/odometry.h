@@ -0,0 +1,122 @@
+/*
+ * 轮式里程计 + UMBmark 标定（ESP32）
+ * - 依据左右轮编码器计数与轮径/轮距做航迹推算
+ * - 标定模式：顺时针/逆时针各跑正方形，用 VIVE 作为真值求解左右轮径与轮距
+ */
+
+#ifndef ODOMETRY_H
+#define ODOMETRY_H
+
+#include <Arduino.h>
+
+// 标定运动参数
+#define CAL_DRIVE_RPM      30.0f   // 直行轮速
+#define CAL_TURN_RPM       20.0f   // 原地转向轮速
+#define CAL_SETTLE_MS      600     // 每段结束后停车等待（同时平均 VIVE 坐标）
+#define CAL_SEGMENT_TIMEOUT_MS 15000
+#define CAL_MAX_RUNS_PER_DIR   3
+#define CAL_DEFAULT_SIDE_MM    1000.0f
+// 结果合理范围：超出说明 VIVE 比例没标好、打滑或跑偏，不保存
+#define CAL_SCALE_MIN      0.8f
+#define CAL_SCALE_MAX      1.2f
+#define CAL_RATIO_MIN      0.9f    // Ed、Eb
+#define CAL_RATIO_MAX      1.1f
+
+// 车体几何（轮径/轮距，单位 mm）
+struct OdomGeometry {
+    float wheelDiamL;
+    float wheelDiamR;
+    float trackWidth;
+};
+
+// 平面位姿：theta 为弧度，逆时针为正，0 = 起始车头方向
+struct OdomPose {
+    float x;
+    float y;
+    float theta;
+};
+
+// 用一段编码器增量推进位姿（按圆弧近似）
+void odomIntegrate(OdomPose& pose, long dCountL, long dCountR,
+                   const OdomGeometry& geom, float pulsesPerRev);
+
+// 标定结果（VIVE 坐标须已换算成 mm）
+// 每方向跑 2 圈以上时，每个方向最后一圈留出不参与拟合，闭合误差只在留出的两圈上算；
+// 只跑 1 圈时闭合误差是在拟合数据上算的（heldOut = false），偏乐观
+struct OdomCalResult {
+    bool valid;
+    bool solved;          // 已算出数值（valid 为 false 时可能是超出合理范围）
+    bool heldOut;         // 闭合误差是否在留出的圈上计算
+    OdomGeometry before;
+    OdomGeometry after;
+    float closureBefore;  // UMBmark 闭合误差 max(|cg_cw|, |cg_ccw|)，mm
+    float closureAfter;   // 用新参数重新积分编码器数据后的闭合误差
+    float alphaDeg;       // 每个转角的转向误差（轮距误差）
+    float betaDeg;        // 每条直边的弯曲角（轮径不等）
+    float ed;             // 右/左轮径比
+    float eb;             // 实际/标称轮距比
+    float scale;          // 平均轮径比例（VIVE 直边长度 / 里程计长度）
+};
+
+class OdomCalibrator {
+private:
+    enum Phase { CAL_IDLE, CAL_SETTLE, CAL_MOVE };
+
+    struct Segment {
+        long dCountL;
+        long dCountR;
+    };
+
+    struct Run {
+        bool cw;
+        Segment seg[8];     // 直边/转角交替：0,2,4,6 为直边
+        float viveX[9];     // 起点 + 每段结束后的 VIVE 坐标
+        float viveY[9];
+    };
+
+    Phase m_phase;
+    float m_side;
+    float m_pulsesPerRev;
+    uint8_t m_runsPerDir;
+    OdomGeometry m_geom;
+
+    Run m_runs[2 * CAL_MAX_RUNS_PER_DIR];
+    uint8_t m_runIdx;
+    uint8_t m_segIdx;       // 0..8，8 表示本轮结束
+    long m_segStartL;
+    long m_segStartR;
+    uint32_t m_phaseStartMs;
+    float m_sumX, m_sumY;
+    uint16_t m_sumN;
+
+    OdomCalResult m_result;
+    const char* m_error;
+
+    void beginSettle(uint32_t nowMs);
+    bool segmentDone(uint8_t seg, long countL, long countR) const;
+    void computeResult();
+    bool isHeldOut(uint8_t run) const;
+    float closureError(const OdomGeometry& g) const;
+    void runEndInFrame(const Run& r, float& ax, float& ay) const;
+
+public:
+    OdomCalibrator();
+
+    // 开始标定：sideMm 为正方形边长，runsPerDir 为每个方向的圈数
+    bool start(float sideMm, uint8_t runsPerDir, const OdomGeometry& current, float pulsesPerRev);
+    void stop();
+    bool isActive() const { return m_phase != CAL_IDLE; }
+
+    // 每次 loop 调用，输出左右轮目标转速 (RPM)；标定结束/失败后 isActive() 变为 false
+    void step(uint32_t nowMs, long countL, long countR,
+              float viveX, float viveY, bool viveValid,
+              float& targetL, float& targetR);
+
+    const OdomCalResult& getResult() const { return m_result; }
+    const char* getError() const { return m_error; }
+    uint8_t getRunIndex() const { return m_runIdx; }
+    uint8_t getTotalRuns() const { return 2 * m_runsPerDir; }
+    uint8_t getSegmentIndex() const { return m_segIdx; }
+};
+
+#endif // ODOMETRY_H
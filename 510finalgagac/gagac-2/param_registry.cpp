@@ -0,0 +1,164 @@
+/* 可调参数表实现 */
+
+#include "param_registry.h"
+#include <math.h>
+
+#define PARAM_SLOT_EMPTY  0xFF
+
+static bool nameEquals(const char* a, const char* b) {
+    while (*a && *b) {
+        if (toupper((unsigned char)*a) != toupper((unsigned char)*b)) return false;
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+ParamRegistry::ParamRegistry(const ParamDesc* table, uint8_t count)
+    : m_table(table), m_count(count > PARAM_MAX_ENTRIES ? PARAM_MAX_ENTRIES : count),
+      m_pendingCount(0),
+      m_applied(0), m_clamped(0), m_dropped(0), m_collisions(0) {
+    memset(m_slots, PARAM_SLOT_EMPTY, sizeof(m_slots));
+    for (uint8_t i = 0; i < m_count; i++) {
+        uint32_t slot = m_table[i].hash & (PARAM_HASH_SLOTS - 1);
+        while (m_slots[slot] != PARAM_SLOT_EMPTY) {
+            if (nameEquals(m_table[m_slots[slot]].name, m_table[i].name)) m_collisions++;
+            slot = (slot + 1) & (PARAM_HASH_SLOTS - 1);
+        }
+        m_slots[slot] = i;
+    }
+}
+
+int ParamRegistry::find(const char* name) const {
+    uint32_t h = paramHash(name);
+    uint32_t slot = h & (PARAM_HASH_SLOTS - 1);
+    while (m_slots[slot] != PARAM_SLOT_EMPTY) {
+        const ParamDesc& d = m_table[m_slots[slot]];
+        if (d.hash == h && nameEquals(d.name, name)) return m_slots[slot];
+        slot = (slot + 1) & (PARAM_HASH_SLOTS - 1);
+    }
+    return -1;
+}
+
+int ParamRegistry::findHash(uint32_t hash) const {
+    uint32_t slot = hash & (PARAM_HASH_SLOTS - 1);
+    while (m_slots[slot] != PARAM_SLOT_EMPTY) {
+        if (m_table[m_slots[slot]].hash == hash) return m_slots[slot];
+        slot = (slot + 1) & (PARAM_HASH_SLOTS - 1);
+    }
+    return -1;
+}
+
+uint32_t ParamRegistry::schemaHash() const {
+    uint32_t h = 2166136261u;
+    for (uint8_t i = 0; i < m_count; i++) {
+        h = (h ^ m_table[i].hash) * 16777619u;
+        h = (h ^ m_table[i].type) * 16777619u;
+    }
+    return h;
+}
+
+float ParamRegistry::get(uint8_t index) const {
+    const ParamDesc& d = m_table[index];
+    switch (d.type) {
+        case PARAM_BOOL:  return *(bool*)d.ptr ? 1.0f : 0.0f;
+        case PARAM_U8:    return *(uint8_t*)d.ptr;
+        case PARAM_U16:   return *(uint16_t*)d.ptr;
+        case PARAM_INT:   return (float)*(int*)d.ptr;
+        case PARAM_U32:   return (float)*(unsigned long*)d.ptr;
+        case PARAM_FLOAT: return *(float*)d.ptr;
+        case PARAM_I16:   return *(int16_t*)d.ptr;
+    }
+    return 0.0f;
+}
+
+void ParamRegistry::write(uint8_t index, float value) {
+    const ParamDesc& d = m_table[index];
+    switch (d.type) {
+        case PARAM_BOOL:  *(bool*)d.ptr = (value != 0.0f); break;
+        case PARAM_U8:    *(uint8_t*)d.ptr = (uint8_t)lroundf(value); break;
+        case PARAM_U16:   *(uint16_t*)d.ptr = (uint16_t)lroundf(value); break;
+        case PARAM_INT:   *(int*)d.ptr = (int)lroundf(value); break;
+        case PARAM_U32:   *(unsigned long*)d.ptr = (unsigned long)lroundf(value); break;
+        case PARAM_FLOAT: *(float*)d.ptr = value; break;
+        case PARAM_I16:   *(int16_t*)d.ptr = (int16_t)lroundf(value); break;
+    }
+}
+
+bool ParamRegistry::set(uint8_t index, float value) {
+    if (index >= m_count || isnan(value)) return false;
+    const ParamDesc& d = m_table[index];
+    bool clamped = false;
+    if (value < d.minVal) { value = d.minVal; clamped = true; }
+    if (value > d.maxVal) { value = d.maxVal; clamped = true; }
+
+    bool ok = true;
+    portENTER_CRITICAL(&m_mux);
+    if (clamped) m_clamped++;
+    uint8_t k = 0;
+    while (k < m_pendingCount && m_pending[k].index != index) k++;
+    if (k < m_pendingCount) {
+        m_pending[k].value = value;
+    } else if (m_pendingCount < PARAM_MAX_PENDING) {
+        m_pending[m_pendingCount++] = Pending{index, value};
+    } else {
+        m_dropped++;
+        ok = false;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return ok;
+}
+
+bool ParamRegistry::set(const char* name, float value) {
+    int index = find(name);
+    return index >= 0 && set((uint8_t)index, value);
+}
+
+bool ParamRegistry::setImmediate(uint8_t index, float value) {
+    if (index >= m_count || isnan(value)) return false;
+    const ParamDesc& d = m_table[index];
+    if (value < d.minVal || value > d.maxVal) {
+        value = constrain(value, d.minVal, d.maxVal);
+        m_clamped++;
+    }
+    write(index, value);
+    m_applied++;
+    return true;
+}
+
+uint8_t ParamRegistry::applyPending() {
+    if (m_pendingCount == 0) return 0;   // 只读一个字节，无需加锁
+    Pending batch[PARAM_MAX_PENDING];
+    portENTER_CRITICAL(&m_mux);
+    uint8_t n = m_pendingCount;
+    memcpy(batch, m_pending, n * sizeof(Pending));
+    m_pendingCount = 0;
+    portEXIT_CRITICAL(&m_mux);
+
+    for (uint8_t k = 0; k < n; k++) write(batch[k].index, batch[k].value);
+    m_applied += n;
+    return n;
+}
+
+void ParamRegistry::printAll(Print& out) const {
+    for (uint8_t i = 0; i < m_count; i++) {
+        const ParamDesc& d = m_table[i];
+        out.printf("  [%2u] %c %-24s = %g  (%g..%g)\n", (unsigned)d.id, d.group, d.name, get(i), d.minVal, d.maxVal);
+    }
+}
+
+void ParamRegistry::printStats(Print& out) const {
+    out.printf("params: %u entries, applied=%lu clamped=%lu dropped=%lu pending=%u%s\n", (unsigned)m_count,
+               (unsigned long)m_applied, (unsigned long)m_clamped, (unsigned long)m_dropped,
+               (unsigned)m_pendingCount, m_collisions ? " (DUPLICATE NAMES!)" : "");
+}
+
+bool paramParseAssignment(const char* text, size_t len, char* name, float& value) {
+    const char* eq = (const char*)memchr(text, '=', len);
+    if (!eq || eq == text || eq - text >= PARAM_NAME_MAX) return false;
+    memcpy(name, text, eq - text);
+    name[eq - text] = '\0';
+    char* stop = nullptr;
+    value = strtof(eq + 1, &stop);
+    return stop != eq + 1;
+}
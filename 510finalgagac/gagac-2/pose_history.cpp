@@ -0,0 +1,40 @@
+/* 位姿/轮速历史环形缓冲实现 */
+
+#include "pose_history.h"
+
+PoseHistory::PoseHistory() : m_seq(0) {
+    memset(m_ring, 0, sizeof(m_ring));
+}
+
+void PoseHistory::push(const PoseSample& s) {
+    portENTER_CRITICAL(&m_mux);
+    uint32_t seq = m_seq + 1;
+    PoseSample& slot = m_ring[seq % POSE_HISTORY_SIZE];
+    slot = s;
+    slot.seq = seq;
+    m_seq = seq;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+uint32_t PoseHistory::latestSeq() const {
+    portENTER_CRITICAL(&m_mux);
+    uint32_t seq = m_seq;
+    portEXIT_CRITICAL(&m_mux);
+    return seq;
+}
+
+size_t PoseHistory::copySince(uint32_t since, PoseSample* out, size_t max, bool* gap) const {
+    portENTER_CRITICAL(&m_mux);
+    uint32_t latest = m_seq;
+    uint32_t oldest = latest > POSE_HISTORY_SIZE ? latest - POSE_HISTORY_SIZE + 1 : 1;
+    if (since > latest) since = 0;
+    bool missed = latest > 0 && since + 1 < oldest;
+    uint32_t first = missed ? oldest : since + 1;
+    size_t n = 0;
+    for (uint32_t seq = first; seq <= latest && n < max; seq++) {
+        out[n++] = m_ring[seq % POSE_HISTORY_SIZE];
+    }
+    portEXIT_CRITICAL(&m_mux);
+    if (gap) *gap = missed;
+    return n;
+}
@@ -0,0 +1,40 @@
+/*
+ * 位姿/轮速历史环形缓冲：主循环每个控制周期（20ms）记一条，带递增序号
+ * 网页用 /history?since=序号 一次取回比自己上次看到的更新的全部样本，画图不再只看到最新一点而混叠
+ * push() 在主循环中调用，copySince() 在网页任务中调用；只在临界区里拷贝样本，格式化在临界区外
+ */
+
+#ifndef POSE_HISTORY_H
+#define POSE_HISTORY_H
+
+#include <Arduino.h>
+
+#define POSE_HISTORY_SIZE  128   // 50 Hz 下约 2.5 秒；网页每 0.5 秒取一次
+
+struct PoseSample {
+    uint32_t seq;      // 从 1 开始
+    uint32_t ms;
+    float x, y, angle;
+    float speedL, speedR;     // rpm
+    float targetL, targetR;
+};
+
+class PoseHistory {
+private:
+    mutable portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+    PoseSample m_ring[POSE_HISTORY_SIZE];
+    uint32_t m_seq;   // 最新一条的序号，0 = 空
+
+public:
+    PoseHistory();
+
+    // seq 由缓冲区分配
+    void push(const PoseSample& s);
+    uint32_t latestSeq() const;
+
+    // 按时间顺序拷出序号大于 since 的样本（最多 max 条，从最旧的开始），返回条数
+    // since 比缓冲区里最旧的还早（网页太久没取）时 *gap = true；since 比最新的还大（板子重启过）按 0 处理
+    size_t copySince(uint32_t since, PoseSample* out, size_t max, bool* gap = nullptr) const;
+};
+
+#endif // POSE_HISTORY_H
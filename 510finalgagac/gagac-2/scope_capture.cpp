@@ -0,0 +1,164 @@
+/* 控制信号示波器实现 */
+
+#include "scope_capture.h"
+
+static const char* const SCOPE_TRIG_NAMES[SCOPE_TRIG_COUNT] = { "now", "setpoint", "error", "mode" };
+
+ScopeCapture::ScopeCapture(uint16_t periodMs)
+    : m_periodMs(periodMs), m_state(SCOPE_IDLE), m_written(0), m_trigIndex(0), m_postLeft(0), m_trigMs(0),
+      m_havePrev(false), m_reading(false), m_captures(0) {
+    m_cfg = ScopeConfig{SCOPE_TRIG_NOW, 0.0f, 0, 1};
+    memset(&m_prev, 0, sizeof(m_prev));
+}
+
+bool ScopeCapture::arm(const ScopeConfig& cfg) {
+    if (cfg.trigger >= SCOPE_TRIG_COUNT || cfg.post == 0 || (uint32_t)cfg.pre + cfg.post > SCOPE_DEPTH) {
+        return false;
+    }
+    portENTER_CRITICAL(&m_mux);
+    bool ok = !m_reading;
+    if (ok) {
+        m_cfg = cfg;
+        m_written = 0;
+        m_havePrev = false;
+        m_state = SCOPE_ARMED;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return ok;
+}
+
+void ScopeCapture::stop() {
+    portENTER_CRITICAL(&m_mux);
+    if (m_state != SCOPE_DONE) m_state = SCOPE_IDLE;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+// 触发判断用整数（0.1 RPM）比较，与下载的数据一致
+static bool scopeFires(const ScopeConfig& cfg, const ScopeSample& s, const ScopeSample& prev, bool havePrev) {
+    int32_t lv = (int32_t)(cfg.level * SCOPE_RPM_SCALE);
+    switch (cfg.trigger) {
+        case SCOPE_TRIG_NOW:
+            return true;
+        case SCOPE_TRIG_SETPOINT:
+            return havePrev && (abs(s.targetL - prev.targetL) > lv || abs(s.targetR - prev.targetR) > lv);
+        case SCOPE_TRIG_ERROR:
+            return abs(s.errorL) > lv || abs(s.errorR) > lv;
+        case SCOPE_TRIG_MODE:
+            return havePrev && s.mode != prev.mode;
+        default:
+            return false;
+    }
+}
+
+void ScopeCapture::record(const ScopeSample& s, uint32_t nowMs) {
+    portENTER_CRITICAL(&m_mux);
+    if (m_state == SCOPE_ARMED || m_state == SCOPE_TRIGGERED) {
+        m_ring[m_written % SCOPE_DEPTH] = s;
+        m_written++;
+        if (m_state == SCOPE_ARMED) {
+            // 先攒够触发前样本再看触发条件，保证触发点前面有 pre 条
+            if (m_written > m_cfg.pre && scopeFires(m_cfg, s, m_prev, m_havePrev)) {
+                m_state = SCOPE_TRIGGERED;
+                m_trigIndex = m_written - 1;
+                m_trigMs = nowMs;
+                m_postLeft = m_cfg.post;
+            }
+        }
+        if (m_state == SCOPE_TRIGGERED && --m_postLeft == 0) {
+            m_state = SCOPE_DONE;
+            m_captures++;
+        }
+        m_prev = s;
+        m_havePrev = true;
+    }
+    portEXIT_CRITICAL(&m_mux);
+}
+
+ScopeState ScopeCapture::getState() const {
+    portENTER_CRITICAL(&m_mux);
+    ScopeState st = m_state;
+    portEXIT_CRITICAL(&m_mux);
+    return st;
+}
+
+bool ScopeCapture::beginRead(ScopeHeader& h, const uint8_t*& a, size_t& na, const uint8_t*& b, size_t& nb) {
+    portENTER_CRITICAL(&m_mux);
+    bool ok = m_state == SCOPE_DONE && !m_reading;
+    if (ok) m_reading = true;
+    portEXIT_CRITICAL(&m_mux);
+    if (!ok) return false;
+
+    // 冻结后主循环不再写，这里可以直接读
+    uint16_t count = m_cfg.pre + m_cfg.post;
+    memcpy(h.magic, "SCP1", 4);
+    h.sampleSize = sizeof(ScopeSample);
+    h.trigger = m_cfg.trigger;
+    h.count = count;
+    h.pre = m_cfg.pre;
+    h.periodMs = m_periodMs;
+    h.trigMs = m_trigMs;
+    h.level = m_cfg.level;
+
+    uint32_t start = (m_trigIndex - m_cfg.pre) % SCOPE_DEPTH;
+    size_t first = min((size_t)count, (size_t)(SCOPE_DEPTH - start));
+    a = (const uint8_t*)&m_ring[start];
+    na = first * sizeof(ScopeSample);
+    b = (const uint8_t*)&m_ring[0];
+    nb = (count - first) * sizeof(ScopeSample);
+    return true;
+}
+
+void ScopeCapture::endRead() {
+    portENTER_CRITICAL(&m_mux);
+    m_reading = false;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void ScopeCapture::toJson(JsonWriter& j) const {
+    portENTER_CRITICAL(&m_mux);
+    ScopeConfig cfg = m_cfg;
+    ScopeState st = m_state;
+    uint32_t n = min(m_written, (uint32_t)SCOPE_DEPTH);
+    uint32_t captures = m_captures;
+    portEXIT_CRITICAL(&m_mux);
+    j.beginObject();
+    j.field("state", stateName(st)).field("trig", triggerName(cfg.trigger)).field("level", cfg.level, 1);
+    j.field("pre", cfg.pre).field("post", cfg.post).field("n", n);
+    j.field("depth", SCOPE_DEPTH).field("period", m_periodMs).field("captures", captures);
+    j.endObject();
+}
+
+void ScopeCapture::printStats(Print& out) const {
+    portENTER_CRITICAL(&m_mux);
+    ScopeConfig cfg = m_cfg;
+    ScopeState st = m_state;
+    uint32_t written = m_written;
+    portEXIT_CRITICAL(&m_mux);
+    out.printf("scope: %s trig=%s level=%.1f pre=%u post=%u written=%lu captures=%lu\n",
+               stateName(st), triggerName(cfg.trigger), cfg.level, (unsigned)cfg.pre, (unsigned)cfg.post,
+               (unsigned long)written, (unsigned long)m_captures);
+}
+
+const char* ScopeCapture::triggerName(ScopeTrigger t) {
+    return t < SCOPE_TRIG_COUNT ? SCOPE_TRIG_NAMES[t] : "?";
+}
+
+const char* ScopeCapture::stateName(ScopeState s) {
+    switch (s) {
+        case SCOPE_IDLE: return "idle";
+        case SCOPE_ARMED: return "armed";
+        case SCOPE_TRIGGERED: return "triggered";
+        case SCOPE_DONE: return "done";
+        default: return "?";
+    }
+}
+
+bool ScopeCapture::parseTrigger(const char* name, ScopeTrigger& out) {
+    for (uint8_t t = 0; t < SCOPE_TRIG_COUNT; t++) {
+        if (strcasecmp(name, SCOPE_TRIG_NAMES[t]) == 0) {
+            out = (ScopeTrigger)t;
+            return true;
+        }
+    }
+    return false;
+}
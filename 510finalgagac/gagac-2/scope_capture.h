@@ -0,0 +1,125 @@
+/*
+ * 控制信号“示波器”：每个控制周期记一条两轮的目标/实测转速、误差、积分项与 PWM，带触发与预触发
+ * - 网页（或串口 SCOPE_ARM）设置触发条件和触发前/后深度后布防；布防期间样本持续写入环形缓冲，
+ *   触发后再记 post 条即冻结，网页用 /scope/data 一次下载（ScopeHeader + ScopeSample[]，小端二进制）
+ * - 触发条件：立即、任一轮目标转速跳变超过 level、任一轮 |误差| 超过 level（RPM）、模式位变化
+ * - 冻结期间主循环不再写缓冲，下载不用拷贝；下载中不能重新布防
+ * record() 在主循环控制周期内调用，其余可在网页任务中调用
+ */
+
+#ifndef SCOPE_CAPTURE_H
+#define SCOPE_CAPTURE_H
+
+#include <Arduino.h>
+#include "json_writer.h"
+
+#define SCOPE_DEPTH       1024   // 样本数，20 ms 控制周期约 20 s
+#define SCOPE_RPM_SCALE   10.0f  // 转速/误差以 0.1 RPM 为单位
+
+// 模式位（ScopeSample::mode）
+#define SCOPE_MODE_VIVE     0x01
+#define SCOPE_MODE_SEQ      0x02
+#define SCOPE_MODE_AUTO     0x04
+#define SCOPE_MODE_PLANNER  0x08
+#define SCOPE_MODE_OWNER    0x10   // 目标速度来自 Owner
+#define SCOPE_MODE_TELEOP   0x20   // 目标速度来自连续遥控
+#define SCOPE_MODE_CAL      0x40
+#define SCOPE_MODE_SLIP     0x80   // 打滑限斜率中
+
+// 一个控制周期（24 字节）
+struct __attribute__((packed)) ScopeSample {
+    uint16_t ms;           // millis() 低 16 位
+    uint8_t mode;          // SCOPE_MODE_*
+    uint8_t reserved;
+    int16_t targetL, speedL, errorL;   // 0.1 RPM
+    int16_t iTermL;        // Ki * 积分（PWM 单位，积分项对输出的贡献）
+    int16_t pwmL;
+    int16_t targetR, speedR, errorR;
+    int16_t iTermR;
+    int16_t pwmR;
+};
+static_assert(sizeof(ScopeSample) == 24, "scope sample layout");
+
+// 下载数据的头（20 字节），后接 count 条 ScopeSample，第 pre 条为触发样本
+struct __attribute__((packed)) ScopeHeader {
+    char magic[4];         // "SCP1"
+    uint8_t sampleSize;
+    uint8_t trigger;       // ScopeTrigger
+    uint16_t count;
+    uint16_t pre;
+    uint16_t periodMs;
+    uint32_t trigMs;       // 触发时刻 millis()
+    float level;
+};
+static_assert(sizeof(ScopeHeader) == 20, "scope header layout");
+
+// 浮点 -> 定点（四舍五入并饱和到 int16）
+inline int16_t scopeQuantize(float v, float scale = 1.0f) {
+    float q = roundf(v * scale);
+    return (int16_t)(q > 32767.0f ? 32767 : (q < -32768.0f ? -32768 : q));
+}
+
+enum ScopeTrigger : uint8_t {
+    SCOPE_TRIG_NOW = 0,    // 预触发样本够了就触发
+    SCOPE_TRIG_SETPOINT,   // 任一轮目标转速一个周期内变化 > level
+    SCOPE_TRIG_ERROR,      // 任一轮 |误差| > level
+    SCOPE_TRIG_MODE,       // 模式位变化
+    SCOPE_TRIG_COUNT
+};
+
+enum ScopeState : uint8_t {
+    SCOPE_IDLE = 0,
+    SCOPE_ARMED,           // 记录中，等触发
+    SCOPE_TRIGGERED,       // 已触发，记触发后样本
+    SCOPE_DONE             // 冻结，可下载
+};
+
+struct ScopeConfig {
+    ScopeTrigger trigger;
+    float level;           // RPM（SETPOINT/ERROR）
+    uint16_t pre;          // 触发前样本数
+    uint16_t post;         // 触发后样本数（含触发样本），pre + post <= SCOPE_DEPTH
+};
+
+class ScopeCapture {
+private:
+    mutable portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+    ScopeSample m_ring[SCOPE_DEPTH];
+    ScopeConfig m_cfg;
+    uint16_t m_periodMs;
+    ScopeState m_state;
+    uint32_t m_written;     // 布防后写入的样本数
+    uint32_t m_trigIndex;   // 触发样本的写入序号
+    uint16_t m_postLeft;
+    uint32_t m_trigMs;
+    ScopeSample m_prev;
+    bool m_havePrev;
+    bool m_reading;
+    uint32_t m_captures;
+
+public:
+    explicit ScopeCapture(uint16_t periodMs);
+
+    // 配置不合法或正在下载时返回 false
+    bool arm(const ScopeConfig& cfg);
+    void stop();
+    // 主循环：每个控制周期输出 PWM 后调用一次
+    void record(const ScopeSample& s, uint32_t nowMs);
+
+    ScopeState getState() const;
+    bool isRecording() const { ScopeState st = getState(); return st == SCOPE_ARMED || st == SCOPE_TRIGGERED; }
+
+    // 下载：冻结时给出头和按时间顺序的两段（环形缓冲可能绕回），读完必须调用 endRead()
+    bool beginRead(ScopeHeader& h, const uint8_t*& a, size_t& na, const uint8_t*& b, size_t& nb);
+    void endRead();
+
+    // {"state":..,"trig":..,"level":..,"pre":..,"post":..,"n":..,"depth":..,"captures":..}
+    void toJson(JsonWriter& j) const;
+    void printStats(Print& out) const;
+
+    static const char* triggerName(ScopeTrigger t);
+    static const char* stateName(ScopeState s);
+    static bool parseTrigger(const char* name, ScopeTrigger& out);
+};
+
+#endif // SCOPE_CAPTURE_H
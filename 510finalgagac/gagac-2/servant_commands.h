@@ -0,0 +1,79 @@
+/*
+ * Servant 文本命令表：前缀 -> 处理函数 + 参数类型 + 允许的来源
+ * - 按最长前缀匹配，顺序无关（这里按原 if 链的顺序排列，CMD_BENCH 用它模拟旧写法）
+ * - 转发给 Owner 的命令不接受来自 Owner 的 ASCII 行，避免来回回显
+ * - 表项写成 CMD(...) / CMD_ARG(...)，由使用方定义这两个宏展开：gagac-2.ino 展开成 CmdEntry，
+ *   tools/cmd_bench 在电脑上用同一张表（处理函数换成桩）计时并检查每个前缀都命中自己
+ */
+
+#ifndef SERVANT_COMMANDS_H
+#define SERVANT_COMMANDS_H
+
+#include "cmd_dispatch.h"
+
+#define SERVANT_COMMAND_TABLE(CMD, CMD_ARG) \
+    CMD("F",             CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdForward)                  \
+    CMD("B",             CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdBackward)                 \
+    CMD("L",             CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdLeft)                     \
+    CMD("R",             CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdRight)                    \
+    CMD("S",             CMD_ARG_NONE,  CMD_SRC_ALL,   cmdStop)                     \
+    CMD("SV",            CMD_ARG_INT,   CMD_SRC_ALL,   cmdServo)                    \
+    CMD_ARG("KPB",       CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdSetParam, "Kp_base")      \
+    CMD_ARG("KIB",       CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdSetParam, "Ki_base")      \
+    CMD_ARG("KDB",       CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdSetParam, "Kd_base")      \
+    CMD_ARG("FFA",       CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdSetParam, "feedforwardA") \
+    CMD_ARG("FFB",       CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdSetParam, "feedforwardB") \
+    CMD("FF1",           CMD_ARG_NONE,  CMD_SRC_ALL,   cmdFeedforwardOn)            \
+    CMD("FF0",           CMD_ARG_NONE,  CMD_SRC_ALL,   cmdFeedforwardOff)           \
+    CMD("RESET",         CMD_ARG_NONE,  CMD_SRC_ALL,   cmdResetEncoders)            \
+    CMD_ARG("SLEW",      CMD_ARG_INT,   CMD_SRC_ALL,   cmdSetParam, "slipPwmSlew")  \
+    CMD("CAL_START",     CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdCalStart)                 \
+    CMD("CAL_STOP",      CMD_ARG_NONE,  CMD_SRC_ALL,   cmdCalStop)                  \
+    CMD("CAL_RESET",     CMD_ARG_NONE,  CMD_SRC_ALL,   cmdCalReset)                 \
+    CMD("ODOM_RESET",    CMD_ARG_NONE,  CMD_SRC_ALL,   cmdOdomReset)                \
+    CMD("AUTO_ON",       CMD_ARG_NONE,  CMD_SRC_LOCAL, cmdAutoOn)                   \
+    CMD("AUTO_OFF",      CMD_ARG_NONE,  CMD_SRC_LOCAL, cmdAutoOff)                  \
+    CMD("MP_ON",         CMD_ARG_NONE,  CMD_SRC_LOCAL, cmdPlannerOn)                \
+    CMD("MP_OFF",        CMD_ARG_NONE,  CMD_SRC_LOCAL, cmdPlannerOff)               \
+    CMD("MP_ROUTE:",     CMD_ARG_TEXT,  CMD_SRC_LOCAL, cmdPlannerRoute)             \
+    CMD("TOF_BENCH",      CMD_ARG_NONE, CMD_SRC_LOCAL, cmdToFBench)                 \
+    CMD("TOF_BENCH:",     CMD_ARG_INT,  CMD_SRC_LOCAL, cmdToFBench)                 \
+    CMD("TOF_BENCH_STOP", CMD_ARG_NONE, CMD_SRC_LOCAL, cmdToFBench)                 \
+    CMD("MP_PARAM:",     CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdParam)                    \
+    CMD("PARAM:",        CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdParam)                    \
+    CMD("PARAMS",        CMD_ARG_NONE,  CMD_SRC_ALL,   cmdParamList)                \
+    CMD("PSAVE",         CMD_ARG_NONE,  CMD_SRC_ALL,   cmdProfileSave)              \
+    CMD("PSAVE:",        CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdProfileSave)              \
+    CMD("PLOAD:",        CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdProfileLoad)              \
+    CMD("PDIFF",         CMD_ARG_NONE,  CMD_SRC_ALL,   cmdProfileDiff)              \
+    CMD("PDIFF:",        CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdProfileDiff)              \
+    CMD("PLIST",         CMD_ARG_NONE,  CMD_SRC_ALL,   cmdProfileList)              \
+    CMD("PDEL:",         CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdProfileDelete)            \
+    CMD("SEQ:",          CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdSeqLoad)                  \
+    CMD("SEQ_START",     CMD_ARG_NONE,  CMD_SRC_ALL,   cmdSeqStart)                 \
+    CMD("SEQ_STOP",      CMD_ARG_NONE,  CMD_SRC_ALL,   cmdSeqStop)                  \
+    CMD("VIVE_ON",       CMD_ARG_NONE,  CMD_SRC_ALL,   cmdViveOn)                   \
+    CMD("VIVE_OFF",      CMD_ARG_NONE,  CMD_SRC_ALL,   cmdViveOff)                  \
+    CMD("VIVE_TEST_ON",  CMD_ARG_NONE,  CMD_SRC_ALL,   cmdViveTestOn)               \
+    CMD("TEST_ON",       CMD_ARG_NONE,  CMD_SRC_ALL,   cmdViveTestOn)               \
+    CMD("VIVE_TEST_OFF", CMD_ARG_NONE,  CMD_SRC_ALL,   cmdViveTestOff)              \
+    CMD("TEST_OFF",      CMD_ARG_NONE,  CMD_SRC_ALL,   cmdViveTestOff)              \
+    CMD("VIVE_STATUS",   CMD_ARG_NONE,  CMD_SRC_ALL,   cmdStatus)                   \
+    CMD("STATUS",        CMD_ARG_NONE,  CMD_SRC_ALL,   cmdStatus)                   \
+    CMD("SLIP_LOG",      CMD_ARG_NONE,  CMD_SRC_ALL,   cmdSlipLog)                  \
+    CMD("VIVE_MARK",     CMD_ARG_NONE,  CMD_SRC_ALL,   cmdViveMark)                 \
+    CMD("VIVE_SCALE:",   CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdViveScale)                \
+    CMD("LINK_STATS",    CMD_ARG_NONE,  CMD_SRC_ALL,   cmdLinkStats)                \
+    CMD("LINK_TIMEOUT:", CMD_ARG_INT,   CMD_SRC_ALL,   cmdLinkTimeout)              \
+    CMD("LINK_BENCH",    CMD_ARG_NONE,  CMD_SRC_ALL,   cmdLinkBench)                \
+    CMD("LINK_BENCH:",   CMD_ARG_INT,   CMD_SRC_ALL,   cmdLinkBench)                \
+    CMD("LOOP_STATS",    CMD_ARG_NONE,  CMD_SRC_ALL,   cmdLoopStats)                \
+    CMD("LOOP_RESET",    CMD_ARG_NONE,  CMD_SRC_ALL,   cmdLoopReset)                \
+    CMD("SCOPE_ARM:",    CMD_ARG_TEXT,  CMD_SRC_ALL,   cmdScopeArm)                 \
+    CMD("SCOPE_STOP",    CMD_ARG_NONE,  CMD_SRC_ALL,   cmdScopeStop)                \
+    CMD("CMD_BENCH",     CMD_ARG_NONE,  CMD_SRC_ALL,   cmdBench)                    \
+    CMD("CMD_BENCH:",    CMD_ARG_INT,   CMD_SRC_ALL,   cmdBench)                    \
+    CMD("SPEED=",        CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdSliderSpeed)              \
+    CMD("TURN=",         CMD_ARG_FLOAT, CMD_SRC_ALL,   cmdSliderTurn)
+
+#endif // SERVANT_COMMANDS_H
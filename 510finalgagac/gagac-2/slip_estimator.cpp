@@ -0,0 +1,117 @@
+/* 车轮打滑检测实现：按固定窗口差分 VIVE 位置，与编码器车体速度比较 */
+
+#include "slip_estimator.h"
+
+SlipEstimator::SlipEstimator() {
+    reset();
+}
+
+void SlipEstimator::reset() {
+    m_lastX = 0.0f;
+    m_lastY = 0.0f;
+    m_lastSampleMs = 0;
+    m_hasSample = false;
+    m_encSpeed = 0.0f;
+    m_viveSpeed = 0.0f;
+    m_ratio = 0.0f;
+    m_overCount = 0;
+    m_slipping = false;
+    m_lastSlipMs = 0;
+    m_current = SlipEvent{0, 0, 0.0f, 0.0f, 0.0f};
+    m_logHead = 0;
+    m_logCount = 0;
+    m_totalEvents = 0;
+}
+
+// 把当前事件写入环形缓冲
+void SlipEstimator::finishEvent(uint32_t nowMs) {
+    m_current.durationMs = nowMs - m_current.startMs;
+    m_log[m_logHead] = m_current;
+    m_logHead = (m_logHead + 1) % SLIP_LOG_SIZE;
+    if (m_logCount < SLIP_LOG_SIZE) m_logCount++;
+    m_totalEvents++;
+}
+
+bool SlipEstimator::update(uint32_t nowMs, float encSpeed, float viveX, float viveY, bool viveValid) {
+    // VIVE 丢失：清空差分基准，已在打滑中的事件按当前时间收尾
+    if (!viveValid) {
+        m_hasSample = false;
+        m_overCount = 0;
+        if (m_slipping) {
+            m_slipping = false;
+            m_lastSlipMs = nowMs;
+            finishEvent(nowMs);
+            return true;
+        }
+        return false;
+    }
+
+    if (!m_hasSample) {
+        m_lastX = viveX;
+        m_lastY = viveY;
+        m_lastSampleMs = nowMs;
+        m_hasSample = true;
+        return false;
+    }
+
+    uint32_t dt = nowMs - m_lastSampleMs;
+    if (dt < SLIP_WINDOW_MS) return false;
+
+    float dx = viveX - m_lastX;
+    float dy = viveY - m_lastY;
+    m_lastX = viveX;
+    m_lastY = viveY;
+    m_lastSampleMs = nowMs;
+
+    float viveSpeed = sqrtf(dx * dx + dy * dy) * 1000.0f / (float)dt;
+    if (viveSpeed > SLIP_VIVE_MAX_SPEED) return false;  // 跳点，丢弃本窗口
+
+    m_viveSpeed += SLIP_VIVE_EMA_ALPHA * (viveSpeed - m_viveSpeed);
+    m_encSpeed = fabsf(encSpeed);
+
+    // 低速时不判定（原地转向时车体速度本身接近 0，也落在这里）
+    if (m_encSpeed < SLIP_MIN_ENC_SPEED) {
+        m_ratio = 0.0f;
+    } else {
+        m_ratio = (m_encSpeed - m_viveSpeed) / m_encSpeed;
+        if (m_ratio < 0.0f) m_ratio = 0.0f;
+    }
+
+    if (!m_slipping) {
+        m_overCount = (m_ratio > SLIP_RATIO_ENTER) ? m_overCount + 1 : 0;
+        if (m_overCount >= SLIP_CONFIRM_WINDOWS) {
+            m_slipping = true;
+            m_current = SlipEvent{nowMs, 0, m_ratio, m_encSpeed, m_viveSpeed};
+        }
+        return false;
+    }
+
+    // 打滑中：更新峰值，低于退出阈值则结束事件
+    m_lastSlipMs = nowMs;
+    if (m_ratio > m_current.peakRatio) {
+        m_current.peakRatio = m_ratio;
+        m_current.encSpeed = m_encSpeed;
+        m_current.viveSpeed = m_viveSpeed;
+    }
+    if (m_ratio < SLIP_RATIO_EXIT) {
+        m_slipping = false;
+        m_overCount = 0;
+        finishEvent(nowMs);
+        return true;
+    }
+    return false;
+}
+
+bool SlipEstimator::isLimiting(uint32_t nowMs) const {
+    if (m_slipping) return true;
+    return m_totalEvents > 0 && (nowMs - m_lastSlipMs) < SLIP_HOLD_MS;
+}
+
+const SlipEvent& SlipEstimator::getEvent(uint8_t index) const {
+    uint8_t start = (m_logCount < SLIP_LOG_SIZE) ? 0 : m_logHead;
+    return m_log[(start + index) % SLIP_LOG_SIZE];
+}
+
+const SlipEvent& SlipEstimator::getLastEvent() const {
+    return m_log[(m_logHead + SLIP_LOG_SIZE - 1) % SLIP_LOG_SIZE];
+}
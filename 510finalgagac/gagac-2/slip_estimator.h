@@ -0,0 +1,88 @@
+/*
+ * 车轮打滑检测（ESP32）
+ * 比较编码器推算的车体速度与 VIVE 位置差分速度，判定打滑并记录事件
+ */
+
+#ifndef SLIP_ESTIMATOR_H
+#define SLIP_ESTIMATOR_H
+
+#include <Arduino.h>
+
+// 采样窗口：VIVE 位置差分与编码器速度都按此周期比较（与 SPEED_CALC_PERIOD 对齐）
+#define SLIP_WINDOW_MS        100
+// 编码器速度低于此值（mm/s）不判定打滑，避免低速噪声
+#define SLIP_MIN_ENC_SPEED    80.0f
+// VIVE 差分速度超过此值（mm/s，坐标已换算成 mm）视为跳点，丢弃本窗口；
+// 约为最高车速（100 RPM × π × 65 mm ≈ 340 mm/s）的 4 倍
+#define SLIP_VIVE_MAX_SPEED   1500.0f
+// 打滑比 = (|v_enc| - v_vive) / |v_enc|，进入/退出阈值（带回差）
+#define SLIP_RATIO_ENTER      0.35f
+#define SLIP_RATIO_EXIT       0.20f
+// 连续多少个窗口超阈值才判定为打滑
+#define SLIP_CONFIRM_WINDOWS  2
+// 打滑结束后继续限制 PWM 斜率的时间（ms）
+#define SLIP_HOLD_MS          1000
+// VIVE 速度一阶低通系数
+#define SLIP_VIVE_EMA_ALPHA   0.5f
+// 事件环形缓冲长度
+#define SLIP_LOG_SIZE         16
+
+// 一次打滑事件（时间戳为 millis）
+struct SlipEvent {
+    uint32_t startMs;     // 判定打滑的时刻
+    uint32_t durationMs;  // 持续时间
+    float peakRatio;      // 期间最大打滑比
+    float encSpeed;       // 峰值时编码器车体速度 (mm/s)
+    float viveSpeed;      // 峰值时 VIVE 速度 (mm/s)
+};
+
+class SlipEstimator {
+private:
+    // VIVE 差分状态
+    float m_lastX;
+    float m_lastY;
+    uint32_t m_lastSampleMs;
+    bool m_hasSample;
+
+    // 当前估计
+    float m_encSpeed;
+    float m_viveSpeed;
+    float m_ratio;
+    uint8_t m_overCount;
+    bool m_slipping;
+    uint32_t m_lastSlipMs;
+
+    // 正在进行的事件 + 历史
+    SlipEvent m_current;
+    SlipEvent m_log[SLIP_LOG_SIZE];
+    uint8_t m_logHead;
+    uint8_t m_logCount;
+    uint32_t m_totalEvents;
+
+    void finishEvent(uint32_t nowMs);
+
+public:
+    SlipEstimator();
+
+    void reset();
+
+    // 每次 loop 调用；encSpeed 为编码器车体速度 (mm/s, 带符号)，viveX/viveY 为换算后的坐标 (mm)
+    // 返回 true 表示刚结束一次打滑事件，可通过 getLastEvent() 取出打印
+    bool update(uint32_t nowMs, float encSpeed, float viveX, float viveY, bool viveValid);
+
+    // 是否处于打滑或打滑后的保持期（用于限制 PWM 斜率）
+    bool isLimiting(uint32_t nowMs) const;
+    bool isSlipping() const { return m_slipping; }
+
+    float getRatio() const { return m_ratio; }
+    float getEncSpeed() const { return m_encSpeed; }
+    float getViveSpeed() const { return m_viveSpeed; }
+
+    // 事件日志：index 0 为最早的一条
+    uint8_t getEventCount() const { return m_logCount; }
+    uint32_t getTotalEvents() const { return m_totalEvents; }
+    const SlipEvent& getEvent(uint8_t index) const;
+    const SlipEvent& getLastEvent() const;
+};
+
+#endif // SLIP_ESTIMATOR_H
@@ -0,0 +1,115 @@
+/* 连续遥控通道实现 */
+
+#include "teleop.h"
+
+TeleopChannel::TeleopChannel()
+    : m_newestRxUs(0), m_hasNew(false), m_owner(TELEOP_SOURCE_NONE), m_lastSeq(0), m_lastRxUs(0),
+      m_prevSentMs(0), m_haveSeq(false), m_active(false), m_ackSource(TELEOP_SOURCE_NONE), m_ackPending(false),
+      m_rx(0), m_applied(0), m_overwritten(0), m_stale(0), m_lost(0), m_busy(0), m_bad(0), m_timeouts(0),
+      m_jitterUs(0.0f), m_maxGapUs(0) {
+    memset(&m_newest, 0, sizeof(m_newest));
+    memset(&m_ack, 0, sizeof(m_ack));
+}
+
+bool TeleopChannel::offer(const uint8_t* data, size_t len, uint8_t source, uint32_t rxUs) {
+    TeleopPacket p;
+    if (len != sizeof(p) || data[0] != TELEOP_MAGIC) {
+        m_bad++;
+        return false;
+    }
+    memcpy(&p, data, sizeof(p));
+
+    bool accepted = false;
+    portENTER_CRITICAL(&m_mux);
+    bool ownerLive = m_owner != TELEOP_SOURCE_NONE && rxUs - m_lastRxUs < TELEOP_OWNER_HOLD_MS * 1000UL;
+    if (source != m_owner) {
+        if (ownerLive) {
+            m_busy++;
+            portEXIT_CRITICAL(&m_mux);
+            return false;
+        }
+        m_owner = source;
+        m_haveSeq = false;
+    }
+
+    int16_t d = (int16_t)(p.seq - m_lastSeq);
+    if (m_haveSeq && d <= 0 && d > -TELEOP_RESTART_GAP) {
+        m_stale++;
+    } else {
+        if (m_haveSeq && d > 0) {
+            m_lost += d - 1;
+            uint32_t gap = rxUs - m_lastRxUs;
+            if (gap > m_maxGapUs) m_maxGapUs = gap;
+            if (d == 1) {
+                // 到达间隔与发送间隔之差
+                float D = (float)gap - (float)(p.sentMs - m_prevSentMs) * 1000.0f;
+                m_jitterUs += (fabsf(D) - m_jitterUs) / 16.0f;
+            }
+        }
+        if (m_hasNew) m_overwritten++;
+        m_newest = p;
+        m_newestRxUs = rxUs;
+        m_hasNew = true;
+        m_lastSeq = p.seq;
+        m_prevSentMs = p.sentMs;
+        m_lastRxUs = rxUs;   // 只有被接受的包才续命死人开关
+        m_haveSeq = true;
+        m_rx++;
+        accepted = true;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return accepted;
+}
+
+bool TeleopChannel::takeAck(TeleopAck& ack, uint8_t& source) {
+    portENTER_CRITICAL(&m_mux);
+    bool pending = m_ackPending;
+    if (pending) {
+        ack = m_ack;
+        source = m_ackSource;
+        m_ackPending = false;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return pending;
+}
+
+TeleopEvent TeleopChannel::poll(uint32_t nowUs, uint32_t timeoutUs, TeleopSetpoint& out) {
+    portENTER_CRITICAL(&m_mux);
+    if (m_hasNew) {
+        TeleopPacket p = m_newest;
+        uint32_t rxUs = m_newestRxUs;
+        uint8_t source = m_owner;
+        m_hasNew = false;
+        m_ack = TeleopAck{TELEOP_ACK_MAGIC, p.flags, p.seq, p.sentMs, nowUs - rxUs};
+        m_ackSource = source;
+        m_ackPending = true;
+        portEXIT_CRITICAL(&m_mux);
+
+        out.source = source;
+        out.seq = p.seq;
+        out.enable = (p.flags & TELEOP_FLAG_ENABLE) != 0;
+        out.linear = constrain(p.linear / TELEOP_SCALE, -100.0f, 100.0f);
+        out.angular = constrain(p.angular / TELEOP_SCALE, -100.0f, 100.0f);
+        m_active = out.enable;
+        m_applied++;
+        return TELEOP_APPLY;
+    }
+    uint32_t lastRxUs = m_lastRxUs;
+    portEXIT_CRITICAL(&m_mux);
+
+    if (m_active && nowUs - lastRxUs > timeoutUs) {
+        m_active = false;
+        m_timeouts++;
+        return TELEOP_TIMEOUT;
+    }
+    return TELEOP_IDLE;
+}
+
+void TeleopChannel::printStats(Print& out) const {
+    out.printf("teleop: %s rx=%lu applied=%lu overwritten=%lu stale=%lu lost=%lu busy=%lu bad=%lu timeouts=%lu "
+               "jitter=%.2f ms max_gap=%.1f ms\n",
+               m_active ? "ACTIVE" : "idle", (unsigned long)m_rx, (unsigned long)m_applied,
+               (unsigned long)m_overwritten, (unsigned long)m_stale, (unsigned long)m_lost,
+               (unsigned long)m_busy, (unsigned long)m_bad, (unsigned long)m_timeouts,
+               m_jitterUs / 1000.0, m_maxGapUs / 1000.0);
+}
@@ -0,0 +1,106 @@
+/*
+ * 连续遥控通道：网页（WebSocket 二进制帧）或本地测试程序（UDP）以固定 50 Hz 发送线速度/角速度设定值
+ * - 每包带序号：主循环只执行最新的一包，过期/重复的包直接丢弃，中间丢的包不重发也不补
+ * - 死人开关：包里的 ENABLE 位（手柄肩键/按住方向键）不在时按停车处理；
+ *   超过 teleopTimeoutMs 收不到包也停车（松开按键的包丢了、网页卡死、Wi-Fi 断开都不会让小车一直走）
+ * - 同一时间只有一个来源控制：另一个来源要等当前来源静默 TELEOP_OWNER_HOLD_MS 后才能接管
+ * offer()/takeAck() 在网页任务中调用，poll() 在主循环中调用
+ */
+
+#ifndef TELEOP_H
+#define TELEOP_H
+
+#include <Arduino.h>
+
+#define TELEOP_MAGIC          'T'
+#define TELEOP_ACK_MAGIC      'A'
+#define TELEOP_UDP_PORT       4210
+#define TELEOP_FLAG_ENABLE    0x01   // 死人开关按下
+#define TELEOP_SCALE          10.0f  // linear/angular 以 0.1% 为单位
+#define TELEOP_SOURCE_UDP     0xFE   // 其余值为 WebSocket 客户端号
+#define TELEOP_SOURCE_NONE    0xFF
+#define TELEOP_OWNER_HOLD_MS  500
+#define TELEOP_RESTART_GAP    1000   // 序号倒退超过这么多视为发送端重启
+
+// 上行包（小端，12 字节）
+struct __attribute__((packed)) TeleopPacket {
+    uint8_t magic;      // 'T'
+    uint8_t flags;      // TELEOP_FLAG_*
+    uint16_t seq;
+    int16_t linear;     // -1000..1000 = -100.0..100.0 %（前进为正）
+    int16_t angular;    // -1000..1000（右转为正，与 setCarTurn 的 turnRate 同号）
+    uint32_t sentMs;    // 发送端时间戳（毫秒），原样回显
+};
+static_assert(sizeof(TeleopPacket) == 12, "teleop packet layout");
+
+// 回执（小端，12 字节）：主循环执行了哪一包、从收到到执行用了多久
+struct __attribute__((packed)) TeleopAck {
+    uint8_t magic;      // 'A'
+    uint8_t flags;      // 回显包的 flags
+    uint16_t seq;
+    uint32_t sentMs;
+    uint32_t holdUs;    // 网页任务收到 -> 主循环设定目标转速
+};
+static_assert(sizeof(TeleopAck) == 12, "teleop ack layout");
+
+struct TeleopSetpoint {
+    uint8_t source;
+    uint16_t seq;
+    bool enable;
+    float linear;       // %
+    float angular;      // %
+};
+
+enum TeleopEvent : uint8_t {
+    TELEOP_IDLE = 0,    // 没有新包
+    TELEOP_APPLY,       // 有新包，out 为最新设定值
+    TELEOP_TIMEOUT      // 遥控中静默超时（只报一次），应停车
+};
+
+class TeleopChannel {
+private:
+    mutable portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+
+    // 网页任务写
+    TeleopPacket m_newest;
+    uint32_t m_newestRxUs;
+    bool m_hasNew;
+    uint8_t m_owner;
+    uint16_t m_lastSeq;
+    uint32_t m_lastRxUs;
+    uint32_t m_prevSentMs;
+    bool m_haveSeq;
+
+    // 主循环写
+    bool m_active;            // 正在执行遥控的非停车设定值
+    TeleopAck m_ack;
+    uint8_t m_ackSource;
+    bool m_ackPending;
+
+    uint32_t m_rx;
+    uint32_t m_applied;
+    uint32_t m_overwritten;   // 主循环还没取走就被更新的包覆盖（只执行最新）
+    uint32_t m_stale;         // 序号不比已收到的新（乱序/重复）
+    uint32_t m_lost;          // 序号跳过的包
+    uint32_t m_busy;          // 其他来源正在控制
+    uint32_t m_bad;           // 长度/魔数不对
+    uint32_t m_timeouts;
+    float m_jitterUs;         // RFC 3550 到达间隔抖动
+    uint32_t m_maxGapUs;      // 相邻两包的最大到达间隔
+
+public:
+    TeleopChannel();
+
+    // 网页任务：收到一包；返回是否被接受
+    bool offer(const uint8_t* data, size_t len, uint8_t source, uint32_t rxUs);
+    // 网页任务：取待发的回执
+    bool takeAck(TeleopAck& ack, uint8_t& source);
+
+    // 主循环：每圈调用一次
+    TeleopEvent poll(uint32_t nowUs, uint32_t timeoutUs, TeleopSetpoint& out);
+
+    bool isActive() const { return m_active; }
+    void printStats(Print& out) const;
+};
+
+#endif // TELEOP_H
@@ -0,0 +1,58 @@
+/* 网页任务与主循环之间的命令/ack 队列实现 */
+
+#include "web_bridge.h"
+
+WebCommandQueue::WebCommandQueue()
+    : m_cmds(NULL), m_acks(NULL), m_posted(0), m_drops(0), m_ackDrops(0), m_maxWaiting(0) {
+}
+
+bool WebCommandQueue::begin(uint8_t cmdDepth, uint8_t ackDepth) {
+    m_cmds = xQueueCreate(cmdDepth, sizeof(WebCommand));
+    m_acks = xQueueCreate(ackDepth, sizeof(WebAck));
+    return m_cmds != NULL && m_acks != NULL;
+}
+
+bool WebCommandQueue::post(uint8_t client, uint32_t id, const char* line, size_t len, uint32_t rxUs) {
+    if (m_cmds == NULL) return false;
+    WebCommand c;
+    c.client = client;
+    c.id = id;
+    c.rxUs = rxUs;
+    if (len > WEB_CMD_MAX_LINE - 1) len = WEB_CMD_MAX_LINE - 1;
+    memcpy(c.line, line, len);
+    c.line[len] = '\0';
+    if (xQueueSend(m_cmds, &c, 0) != pdTRUE) {
+        m_drops++;
+        return false;
+    }
+    m_posted++;
+    return true;
+}
+
+bool WebCommandQueue::poll(WebCommand& out) {
+    if (m_cmds == NULL) return false;
+    uint8_t waiting = (uint8_t)uxQueueMessagesWaiting(m_cmds);
+    if (waiting > m_maxWaiting) m_maxWaiting = waiting;
+    return xQueueReceive(m_cmds, &out, 0) == pdTRUE;
+}
+
+bool WebCommandQueue::postAck(uint8_t client, uint32_t id, uint8_t result, uint32_t actUs) {
+    if (m_acks == NULL) return false;
+    WebAck a{client, result, id, actUs};
+    if (xQueueSend(m_acks, &a, 0) != pdTRUE) {
+        m_ackDrops++;
+        return false;
+    }
+    return true;
+}
+
+bool WebCommandQueue::pollAck(WebAck& out) {
+    if (m_acks == NULL) return false;
+    return xQueueReceive(m_acks, &out, 0) == pdTRUE;
+}
+
+void WebCommandQueue::printStats(Print& out) const {
+    out.printf("web cmd queue: posted=%lu drops=%lu max_waiting=%u ack_drops=%lu\n",
+               (unsigned long)m_posted, (unsigned long)m_drops, (unsigned)m_maxWaiting,
+               (unsigned long)m_ackDrops);
+}
@@ -0,0 +1,87 @@
+/*
+ * 网页任务与主循环之间的数据交换（Servant）
+ * HTTP 与 WebSocket 在核 0 的独立任务里处理，主循环（核 1）只做控制：
+ * - 命令：网页任务把命令行放入 WebCommandQueue，主循环每圈取出、执行；WebSocket 的 ack 经回程队列交给网页任务发送
+ * - 状态：主循环每圈把网页要显示的量拷进 WebSnapshot<T>，网页任务只读这份拷贝，不碰电机/VIVE 全局量
+ * - 两边都不等待对方：队列满时丢弃并计数，快照读写只在临界区里拷贝一次结构体
+ */
+
+#ifndef WEB_BRIDGE_H
+#define WEB_BRIDGE_H
+
+#include <Arduino.h>
+
+#define WEB_CMD_MAX_LINE      96
+#define WEB_CMD_QUEUE_DEPTH   16
+#define WEB_ACK_QUEUE_DEPTH   16
+#define WEB_CLIENT_HTTP       0xFF   // 来自 HTTP /cmd，不回 ack
+
+// 网页任务 -> 主循环
+struct WebCommand {
+    uint8_t client;   // WebSocket 客户端号或 WEB_CLIENT_HTTP
+    uint32_t id;      // 网页命令编号，0 = 不回 ack
+    uint32_t rxUs;    // 网页任务收到命令的时刻（micros）
+    char line[WEB_CMD_MAX_LINE];
+};
+
+// 主循环 -> 网页任务
+struct WebAck {
+    uint8_t client;
+    uint8_t result;   // CmdResult
+    uint32_t id;
+    uint32_t actUs;   // 收到命令到电机输出的微秒数
+};
+
+class WebCommandQueue {
+private:
+    QueueHandle_t m_cmds;
+    QueueHandle_t m_acks;
+    uint32_t m_posted;
+    uint32_t m_drops;      // 命令队列满
+    uint32_t m_ackDrops;   // ack 队列满
+    uint8_t m_maxWaiting;  // 主循环取命令时队列里最多积压过几条
+
+public:
+    WebCommandQueue();
+
+    bool begin(uint8_t cmdDepth = WEB_CMD_QUEUE_DEPTH, uint8_t ackDepth = WEB_ACK_QUEUE_DEPTH);
+
+    // 网页任务调用；line 不必以 \0 结尾，超长截断
+    bool post(uint8_t client, uint32_t id, const char* line, size_t len, uint32_t rxUs);
+    bool pollAck(WebAck& out);
+
+    // 主循环调用，都不阻塞
+    bool poll(WebCommand& out);
+    bool postAck(uint8_t client, uint32_t id, uint8_t result, uint32_t actUs);
+
+    uint32_t getDrops() const { return m_drops; }
+    void printStats(Print& out) const;
+};
+
+// 单写者（主循环）多读者的状态快照
+template <typename T>
+class WebSnapshot {
+private:
+    mutable portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+    T m_value{};
+    uint32_t m_seq = 0;
+
+public:
+    void publish(const T& value) {
+        portENTER_CRITICAL(&m_mux);
+        m_value = value;
+        m_seq++;
+        portEXIT_CRITICAL(&m_mux);
+    }
+
+    // 返回发布序号（0 = 还没有发布过）
+    uint32_t read(T& out) const {
+        portENTER_CRITICAL(&m_mux);
+        out = m_value;
+        uint32_t seq = m_seq;
+        portEXIT_CRITICAL(&m_mux);
+        return seq;
+    }
+};
+
+#endif // WEB_BRIDGE_H
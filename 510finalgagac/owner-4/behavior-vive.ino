@@ -3,6 +3,7 @@
 // Uses Vive tracking data for position and orientation
 
 #include <Arduino.h>
+#include "motion_arbiter.h"
 
 // Navigation parameters
 const float ANGLE_TOLERANCE = 20.0f;      // degrees - angle error threshold for turning
@@ -40,8 +41,8 @@ float fastAtan2(float y, float x) {
 
 // Navigate to target point using Vive coordinates
 // Returns: true if target reached, false if still navigating
-// Command format: "F<speed>", "L<rate>", "R<rate>", "S"
-bool gotoPoint(float xDesired, float yDesired, float viveX, float viveY, float viveAngle, String& cmd) {
+// Command: F<speed>, L<rate>, R<rate> or S, at MOTION_PRIO_GOTO
+bool gotoPoint(float xDesired, float yDesired, float viveX, float viveY, float viveAngle, MotionCommand& cmd) {
     // Calculate distance and angle to target
     float deltaY = yDesired - viveY;
     float deltaX = xDesired - viveX;
@@ -75,7 +76,7 @@ bool gotoPoint(float xDesired, float yDesired, float viveX, float viveY, float v
     
     // Check if target reached
     if (distance <= DISTANCE_TOLERANCE) {
-        cmd = "S";  // Stop
+        cmd = motionStop(MOTION_PRIO_GOTO);  // Stop
         return true;
     }
     
@@ -83,9 +84,9 @@ bool gotoPoint(float xDesired, float yDesired, float viveX, float viveY, float v
     if (abs(angleError) > ANGLE_TOLERANCE) {
         // Need to turn first
         if (angleError > 0) {
-            cmd = "R" + String(60);  // Turn right (clockwise)
+            cmd = motionCommand(MOTION_RIGHT, 60, MOTION_PRIO_GOTO);  // Turn right (clockwise)
         } else {
-            cmd = "L" + String(60);  // Turn left (counter-clockwise)
+            cmd = motionCommand(MOTION_LEFT, 60, MOTION_PRIO_GOTO);  // Turn left (counter-clockwise)
         }
         return false;
     }
@@ -99,40 +100,40 @@ bool gotoPoint(float xDesired, float yDesired, float viveX, float viveY, float v
         } else if (distance < 100.0f) {
             speed = 40.0f;
         }
-        cmd = "F" + String((int)speed);
+        cmd = motionCommand(MOTION_FORWARD, (int)speed, MOTION_PRIO_GOTO);
         return false;
     }
     
     // Should not reach here, but stop just in case
-    cmd = "S";
+    cmd = motionStop(MOTION_PRIO_GOTO);
     return true;
 }
 
 // Navigate to target with obstacle avoidance (combines Vive nav with ToF sensors)
-// Returns command string
-String decideViveNavigation(float xDesired, float yDesired, 
+// Returns the motion command for this tick
+MotionCommand decideViveNavigation(float xDesired, float yDesired, 
                            float viveX, float viveY, float viveAngle,
                            uint16_t F, uint16_t R1, uint16_t R2) {
-    String cmd;
+    MotionCommand cmd;
     
     // Check for obstacles first (safety)
     const uint16_t OBSTACLE_THRESHOLD = 150;  // 15cm
     
     // Emergency stop if too close to obstacle
     if (F < OBSTACLE_THRESHOLD || R1 < 80) {
-        return "S";
+        return motionStop(MOTION_PRIO_GOTO);
     }
     
     // Try to navigate to target
     bool reached = gotoPoint(xDesired, yDesired, viveX, viveY, viveAngle, cmd);
     
     // If moving forward and obstacle detected, stop and turn
-    if (cmd.startsWith("F") && F < 300) {
+    if (cmd.type == MOTION_FORWARD && F < 300) {
         // Obstacle ahead, turn away
         if (R1 < R2 - 20) {
-            cmd = "L" + String(40);  // Turn left if more space on left (away from right wall)
+            cmd = motionCommand(MOTION_LEFT, 40, MOTION_PRIO_GOTO);  // Turn left if more space on left (away from right wall)
         } else {
-            cmd = "R" + String(40);  // Turn right
+            cmd = motionCommand(MOTION_RIGHT, 40, MOTION_PRIO_GOTO);  // Turn right
         }
     }
     
@@ -1,5 +1,8 @@
 // behavior-wall.ino
 // 右侧巡墙逻辑：基于 3 路 ToF（前/右前/右后）实现避障与贴墙，参数可实时调整
+// 每次返回一条 MotionCommand（优先级 MOTION_PRIO_WALL），由 owner-4.ino 的仲裁器决定是否发送
+// 输入是滤波后的 ToFReading：TOF_OPEN（确实没有目标）按“很远/没有墙”处理，
+// TOF_UNKNOWN（读数过旧或不可信）不当作没有墙：前方不知道就停，右侧不知道就不找墙、不出胡同
 
 
 
@@ -8,9 +11,13 @@
 
 
 #include <Arduino.h>
+#include "motion_arbiter.h"
+#include "tof.h"
 
-// 检查传感器读数是否有效
-static bool isValid(uint16_t d) { return (d > 1 && d < 3000); }
+// 可信的距离用滤波值；没有目标（以及不知道的，由调用处另外处理）按 5 m 算
+static float wallRange(const ToFReading& r) {
+    return (r.state == TOF_OK && r.mm < 5000) ? r.mm : 5000.0f;
+}
 
 // ============ 参数设置 (可实时调整) ============
 // 前方避障参数
@@ -53,35 +60,13 @@ unsigned long SEQ_FRONT_POST_STOP_MS = 100;
 unsigned long SEQ_STUCK_BACK_MS = 800;  
 unsigned long SEQ_STUCK_TURN_MS = 100;
 
-// 参数更新函数（从UART接收参数）
-void updateWallParam(const String& paramName, float value) {
-    if (paramName == "FRONT_TURN_TH") FRONT_TURN_TH = (uint16_t)value;
-    else if (paramName == "FRONT_BACKUP_TH") FRONT_BACKUP_TH = (uint16_t)value;
-    else if (paramName == "WALL_TOO_CLOSE") WALL_TOO_CLOSE = value;
-    else if (paramName == "WALL_IDEAL") WALL_IDEAL = value;
-    else if (paramName == "WALL_TOO_FAR") WALL_TOO_FAR = value;
-    else if (paramName == "RIGHT_LOST_WALL") RIGHT_LOST_WALL = value;
-    else if (paramName == "SPEED_FWD") SPEED_FWD = (uint8_t)value;
-    else if (paramName == "SPEED_BACK") SPEED_BACK = (uint8_t)value;
-    else if (paramName == "TURN_SPIN") TURN_SPIN = (uint8_t)value;
-    else if (paramName == "TURN_CORRECT") TURN_CORRECT = (uint8_t)value;
-    else if (paramName == "TURN_GENTLE") TURN_GENTLE = (uint8_t)value;
-    else if (paramName == "TURN_HARD_FIND") TURN_HARD_FIND = (uint8_t)value;
-    else if (paramName == "TURN_TINY") TURN_TINY = (uint8_t)value;
-    else if (paramName == "STALL_CHECK_TIME") STALL_CHECK_TIME = (unsigned long)value;
-    else if (paramName == "STALL_MOVE_TH") STALL_MOVE_TH = (int)value;
-    else if (paramName == "MAX_BACKUP_MS") MAX_BACKUP_MS = (unsigned long)value;
-    else if (paramName == "SEQ_EXIT_STRAIGHT_MS") SEQ_EXIT_STRAIGHT_MS = (unsigned long)value;
-    else if (paramName == "SEQ_EXIT_TURN_MS") SEQ_EXIT_TURN_MS = (unsigned long)value;
-    else if (paramName == "SEQ_EXIT_STOP_MS") SEQ_EXIT_STOP_MS = (unsigned long)value;
-    else if (paramName == "SEQ_FRONT_PRE_STOP_MS") SEQ_FRONT_PRE_STOP_MS = (unsigned long)value;
-    else if (paramName == "SEQ_FRONT_TURN_MS") SEQ_FRONT_TURN_MS = (unsigned long)value;
-    else if (paramName == "SEQ_FRONT_POST_STOP_MS") SEQ_FRONT_POST_STOP_MS = (unsigned long)value;
-    else if (paramName == "SEQ_STUCK_BACK_MS") SEQ_STUCK_BACK_MS = (unsigned long)value;
-    else if (paramName == "SEQ_STUCK_TURN_MS") SEQ_STUCK_TURN_MS = (unsigned long)value;
+// 以上参数登记在 params.ino 的参数表中（网页滑块 / PARAM: 命令经 ownerParams 修改）
+
+static MotionCommand wallCmd(MotionType type, float value) {
+    return motionCommand(type, value, MOTION_PRIO_WALL);
 }
 
-String decideWallFollowing(uint16_t F_raw, uint16_t R1_raw, uint16_t R2_raw) {
+MotionCommand decideWallFollowing(const ToFReading tof[TOF_COUNT]) {
     // 状态记录变量
     static unsigned long backupStartTime = 0;
     static bool isBackingUp = false;           
@@ -100,32 +85,36 @@ String decideWallFollowing(uint16_t F_raw, uint16_t R1_raw, uint16_t R2_raw) {
     static unsigned long stuckStartTime = 0;
 
     // 1. 数据预处理
-    bool hasF  = isValid(F_raw);
-    bool hasR1 = isValid(R1_raw);
-    bool hasR2 = isValid(R2_raw);
+    bool knowF  = tof[0].state != TOF_UNKNOWN;
+    bool knowR1 = tof[1].state != TOF_UNKNOWN;
+    bool knowR2 = tof[2].state != TOF_UNKNOWN;
 
-    if (!hasF && !hasR1 && !hasR2) { return "S"; } // 启动保护: 全无数据则停车
+    if (!knowF && !knowR1 && !knowR2) { return wallCmd(MOTION_STOP, 0); } // 启动保护: 全无数据则停车
 
-    float F  = (hasF && F_raw < 5000) ? F_raw : 5000.0f;
-    float R1 = hasR1 ? R1_raw : 5000.0f;
-    float R2 = hasR2 ? R2_raw : 5000.0f; 
-    bool isHeadOut = (R1 > RIGHT_LOST_WALL); 
+    float F  = wallRange(tof[0]);
+    float R1 = wallRange(tof[1]);
+    float R2 = wallRange(tof[2]);
+    bool isHeadOut = knowR1 && (R1 > RIGHT_LOST_WALL); // R1 不知道不算丢墙
+    bool isRightNear = !knowR1 || R1 <= 120.0f;         // 不知道右边有没有墙时按有墙处理（往左躲）
 
 
     // ================= [优先级 1] 卡死脱困序列 (倒车 -> 旋转) =================
     // 触发后强制执行，用于从障碍物中拔出来
     if (isStuckSequenceActive) {
         unsigned long dt = millis() - stuckStartTime;
-        if (dt < SEQ_STUCK_BACK_MS) { return "B" + String(SPEED_BACK + 10); } // 强力倒车
-        else if (dt < (SEQ_STUCK_BACK_MS + SEQ_STUCK_TURN_MS)) { return "L" + String(TURN_SPIN); } // 换个方向
+        if (dt < SEQ_STUCK_BACK_MS) { return wallCmd(MOTION_BACKWARD, SPEED_BACK + 10); } // 强力倒车
+        else if (dt < (SEQ_STUCK_BACK_MS + SEQ_STUCK_TURN_MS)) { return wallCmd(MOTION_LEFT, TURN_SPIN); } // 换个方向
         else { 
             isStuckSequenceActive = false; 
             lastStallCheckTime = millis(); 
             lastF = F; lastR1 = R1;
         }
-        return "B" + String(SPEED_BACK);
+        return wallCmd(MOTION_BACKWARD, SPEED_BACK);
     }
 
+    // 前方不知道（读数过旧/不可信）就不能往前走，等新读数
+    if (!knowF) { return wallCmd(MOTION_STOP, 0); }
+
     // ================= [逻辑核心] 卡死检测 =================
     if (millis() - lastStallCheckTime > STALL_CHECK_TIME) {
         int deltaF = abs((int)F - (int)lastF);
@@ -136,7 +125,7 @@ String decideWallFollowing(uint16_t F_raw, uint16_t R1_raw, uint16_t R2_raw) {
             // 判定为卡死，触发脱困序列 (倒车)
             isStuckSequenceActive = true;
             stuckStartTime = millis();
-            return "B" + String(SPEED_BACK); 
+            return wallCmd(MOTION_BACKWARD, SPEED_BACK); 
         }
         // 更新历史位置
         lastF = F; lastR1 = R1;
@@ -153,37 +142,37 @@ String decideWallFollowing(uint16_t F_raw, uint16_t R1_raw, uint16_t R2_raw) {
             isFrontTurnSequenceActive = true; 
             frontSeqStage = 1; 
             stageStartTime = millis();
-            return "S"; 
+            return wallCmd(MOTION_STOP, 0); 
         }
-        return "B" + String(SPEED_BACK);
+        return wallCmd(MOTION_BACKWARD, SPEED_BACK);
     } else { isBackingUp = false; }
 
     // 1. 前方避障序列 (停 -> 盲转 -> 停)
-    if (F <= FRONT_TURN_TH && R1<= 120.0F || isFrontTurnSequenceActive) { ////要改这里！！！！
+    if (F <= FRONT_TURN_TH && isRightNear || isFrontTurnSequenceActive) { ////要改这里！！！！
         if (!isFrontTurnSequenceActive) { isFrontTurnSequenceActive = true; frontSeqStage = 1; stageStartTime = millis(); }
         unsigned long dt = millis() - stageStartTime;
 
         // 阶段1: 停车稳住
         if (frontSeqStage == 1) {
-            if (dt < SEQ_FRONT_PRE_STOP_MS) return "S"; 
-            else { frontSeqStage = 2; stageStartTime = millis(); return "L" + String(TURN_SPIN); }
+            if (dt < SEQ_FRONT_PRE_STOP_MS) return wallCmd(MOTION_STOP, 0); 
+            else { frontSeqStage = 2; stageStartTime = millis(); return wallCmd(MOTION_LEFT, TURN_SPIN); }
         }
         // 阶段2: 闭眼转弯
         if (frontSeqStage == 2) {
-            if (dt < SEQ_FRONT_TURN_MS) return "L" + String(TURN_SPIN);
-            else { frontSeqStage = 3; stageStartTime = millis(); return "S"; }
+            if (dt < SEQ_FRONT_TURN_MS) return wallCmd(MOTION_LEFT, TURN_SPIN);
+            else { frontSeqStage = 3; stageStartTime = millis(); return wallCmd(MOTION_STOP, 0); }
         }
         // 阶段3: 转后观察
         if (frontSeqStage == 3) {
-            if (dt < SEQ_FRONT_POST_STOP_MS) return "S"; 
+            if (dt < SEQ_FRONT_POST_STOP_MS) return wallCmd(MOTION_STOP, 0); 
             else { isFrontTurnSequenceActive = false; frontSeqStage = 0; }
         }
-        return "S";
+        return wallCmd(MOTION_STOP, 0);
     }
 
 
-    if (F <= FRONT_TURN_TH && R1> 120.0F || isFrontTurnSequenceActive) {
-        return "R" + String(TURN_HARD_FIND);
+    if (F <= FRONT_TURN_TH && !isRightNear || isFrontTurnSequenceActive) {
+        return wallCmd(MOTION_RIGHT, TURN_HARD_FIND);
     }
 
     // 2. 出胡同序列 (防撞角: 直行 -> 猛拐 -> 停)
@@ -192,57 +181,61 @@ String decideWallFollowing(uint16_t F_raw, uint16_t R1_raw, uint16_t R2_raw) {
         else {
             if (!isExitingSequenceActive) { isExitingSequenceActive = true; exitStartTime = millis(); }
             unsigned long dt = millis() - exitStartTime;
-            if (dt < SEQ_EXIT_STRAIGHT_MS) { return "F" + String(SPEED_FWD); }
-            else if (dt < (SEQ_EXIT_STRAIGHT_MS + SEQ_EXIT_TURN_MS)) { return "R" + String(TURN_HARD_FIND); }
-            else if (dt < (SEQ_EXIT_STRAIGHT_MS + SEQ_EXIT_TURN_MS + SEQ_EXIT_STOP_MS)) { return "S"; }
+            if (dt < SEQ_EXIT_STRAIGHT_MS) { return wallCmd(MOTION_FORWARD, SPEED_FWD); }
+            else if (dt < (SEQ_EXIT_STRAIGHT_MS + SEQ_EXIT_TURN_MS)) { return wallCmd(MOTION_RIGHT, TURN_HARD_FIND); }
+            else if (dt < (SEQ_EXIT_STRAIGHT_MS + SEQ_EXIT_TURN_MS + SEQ_EXIT_STOP_MS)) { return wallCmd(MOTION_STOP, 0); }
             else { isExitingSequenceActive = false; }
-            if (isExitingSequenceActive) return "F" + String(SPEED_FWD);
+            if (isExitingSequenceActive) return wallCmd(MOTION_FORWARD, SPEED_FWD);
         }
     }
 
+    // R1 不知道（不是没有墙）：不找墙也不出胡同，慢速直行等新读数，前方仍由上面的避障保护
+    if (!knowR1) { return wallCmd(MOTION_FORWARD, SPEED_FWD / 2); }
+
     // 3. 常规巡墙 (简化版: R1主导，R2辅助)
     if (!isHeadOut) {
         float diff = R1 - R2;
         
         // [特殊保护] 刚转过直角弯，车尾(R2)还在后面很远，diff 是负的大数
         // 此时强制直行，防止误判为"车头扎墙"
-        if (diff < -100.0f) { return "F" + String(SPEED_FWD); }
+        if (knowR2 && diff < -100.0f) { return wallCmd(MOTION_FORWARD, SPEED_FWD); }
 
         // ============ 第一层：只看 R1 (距离控制) ============
         
         // 1. 太近了 (R1 < 6cm) -> 必须左转远离 (保命)
         if (R1 < WALL_TOO_CLOSE) { 
-            return "L" + String(TURN_CORRECT); 
+            return wallCmd(MOTION_LEFT, TURN_CORRECT); 
         }
 
         // 2. 太远了 (R1 > 13cm) -> 必须右转去找墙 (防丢)
         if (R1 > WALL_TOO_FAR) { 
-            return "R" + String(TURN_GENTLE); 
+            return wallCmd(MOTION_RIGHT, TURN_GENTLE); 
         }
 
         // ============ 第二层：只看 R1 vs R2 (平行控制) ============
         // 能走到这里，说明 R1 距离适中 (在 6cm ~ 13cm 之间)，很安全
-        // 这时候我们才用 R2 来微调车身姿态
+        // 这时候我们才用 R2 来微调车身姿态（R2 不知道就不调）
+        if (!knowR2) { return wallCmd(MOTION_FORWARD, SPEED_FWD); }
         
         // 3. 车头扎向墙 (R1 比 R2 小，说明车头歪进去了)
         // 稍微左转一点点回正
         if (diff < -5.0f) { 
-            return "L" + String(TURN_TINY); 
+            return wallCmd(MOTION_LEFT, TURN_TINY); 
         }
 
         // 4. 车头撇向外 (R1 比 R2 大，说明车头歪出去了)
         // 稍微右转一点点回正
         if (diff > 5.0f) { 
-            return "R" + String(TURN_TINY); 
+            return wallCmd(MOTION_RIGHT, TURN_TINY); 
         }
         
         // 5. 既不近也不远，而且是平行的 -> 完美，直行
-        return "F" + String(SPEED_FWD);
+        return wallCmd(MOTION_FORWARD, SPEED_FWD);
     }
     else { 
         // 6. 找不到墙 (空地模式) -> 画大圈找墙
-        return "R" + String(30); 
+        return wallCmd(MOTION_RIGHT, 30); 
     }
 
-    return "F" + String(SPEED_FWD);
+    return wallCmd(MOTION_FORWARD, SPEED_FWD);
 }
\ No newline at end of file
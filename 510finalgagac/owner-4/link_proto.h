@@ -0,0 +1,323 @@
+/*
+ * Owner <-> Servant UART 二进制消息层
+ * - 线上格式：0x00 + COBS([type][seq][payload...][crc16 lo][crc16 hi]) + 0x00
+ * - COBS 编码后帧内不含 0x00，ASCII 行也不含 0x00，所以同一条串口上两种格式可以混用
+ *   （串口监视器手敲的文本命令照常按行处理）
+ * - CRC16 为 CCITT-FALSE（poly 0x1021, init 0xFFFF），覆盖 type/seq/payload
+ * - 每种消息类型各自一个序号，接收端按类型统计丢包/重复
+ * 本文件在 gagac-2/ 与 owner-4/ 各有一份，修改时两边保持一致
+ */
+
+#ifndef LINK_PROTO_H
+#define LINK_PROTO_H
+
+#include <Arduino.h>
+
+#define LINK_PARAM_NAME_LEN  24    // 参数名最长 23 字符（SEQ_FRONT_POST_STOP_MS = 22）
+#define LINK_MAX_PAYLOAD     48
+#define LINK_MAX_RAW         (2 + LINK_MAX_PAYLOAD + 2)            // type + seq + payload + crc
+#define LINK_MAX_WIRE        (LINK_MAX_RAW + LINK_MAX_RAW / 254 + 3) // COBS 开销 + 两个分隔符
+#define LINK_MAX_LINE        256   // ASCII 行（MP_ROUTE 可能较长）
+
+enum LinkMsgType : uint8_t {
+    LINK_POSE = 1,     // servant -> owner：VIVE 位姿
+    LINK_MOTION,       // owner -> servant：运动命令
+    LINK_PARAM,        // servant -> owner：参数下发
+    LINK_MODE,         // servant -> owner：模式切换
+    LINK_ACK,          // 双向：确认 PARAM/MODE
+    LINK_HEARTBEAT,    // 双向：心跳，带时间戳回显（测 RTT）
+    LINK_PARAM_DESC,   // owner -> servant：参数表中的一项（网页据此生成滑块）
+    LINK_TYPE_COUNT
+};
+
+// 模式切换编号（对应原 ASCII 命令）
+enum LinkModeId : uint8_t {
+    LINK_MODE_AUTO_OFF = 0,
+    LINK_MODE_AUTO_ON,
+    LINK_MODE_MP_OFF,
+    LINK_MODE_MP_ON,
+    LINK_MODE_GOTO_OFF
+};
+
+// 参数归属：'W' = 巡墙参数（PARAM:），'M' = 手动规划参数（MP_PARAM:）
+#define LINK_PARAM_WALL     'W'
+#define LINK_PARAM_PLANNER  'M'
+
+struct LinkPose {
+    float x;
+    float y;
+    float angle;
+    uint32_t stampUs;  // 发送端采样时刻（发送端 micros），接收端用 LinkClock 换算
+};
+
+struct LinkMotion {
+    char mode;         // 'F','B','L','R','S'
+    float value;       // 速度或转向力度
+    uint32_t stampUs;  // 发送端决策时刻
+};
+
+struct LinkParam {
+    char target;
+    char name[LINK_PARAM_NAME_LEN];
+    float value;
+};
+
+// 参数描述（ParamDesc 去掉指针，附当前值）
+struct LinkParamDesc {
+    uint8_t index;     // 在对端参数表中的位置（= 参数 ID）
+    uint8_t count;     // 对端参数表总项数
+    uint8_t type;      // ParamType
+    char group;        // 分组（网页分栏）
+    float value;
+    float minVal;
+    float maxVal;
+    float step;
+    char name[LINK_PARAM_NAME_LEN];
+};
+
+struct LinkMode {
+    uint8_t mode;      // LinkModeId
+};
+
+struct LinkAck {
+    uint8_t type;      // 被确认消息的类型与序号
+    uint8_t seq;
+    uint8_t status;    // 0 = OK，非 0 = 未处理
+};
+
+// 心跳：发送时刻 + 回显对端上一次心跳的发送时刻及本端收到它的时刻（均为各自 micros）
+// 收到后 RTT = (t4 - t1) - (t3 - t2)，t1=echoUs, t2=echoRxUs, t3=txUs, t4=本地接收时刻
+struct LinkHeartbeat {
+    uint32_t txUs;
+    uint32_t echoUs;
+    uint32_t echoRxUs;
+};
+
+struct LinkMessage {
+    uint8_t type;
+    uint8_t seq;
+    union {
+        LinkPose pose;
+        LinkMotion motion;
+        LinkParam param;
+        LinkMode mode;
+        LinkAck ack;
+        LinkHeartbeat heartbeat;
+        LinkParamDesc paramDesc;
+    };
+};
+
+// feed() 的返回值
+enum LinkRxResult {
+    LINK_RX_NONE = 0,
+    LINK_RX_MESSAGE,   // message() 中是一条完整且校验通过的二进制消息
+    LINK_RX_TEXT       // text() 中是一行 ASCII（已去掉 \r\n）
+};
+
+uint16_t linkCrc16(const uint8_t* data, size_t len);
+
+// COBS 编解码；decode 出错返回 0
+size_t cobsEncode(const uint8_t* in, size_t len, uint8_t* out);
+size_t cobsDecode(const uint8_t* in, size_t len, uint8_t* out);
+
+// 一端串口的收发状态：发送序号、接收拼帧缓冲、统计
+class LinkPort {
+private:
+    uint8_t m_txSeq[LINK_TYPE_COUNT];
+    uint8_t m_rxSeq[LINK_TYPE_COUNT];
+    bool m_rxSeen[LINK_TYPE_COUNT];
+
+    uint8_t m_frame[LINK_MAX_WIRE];
+    uint8_t m_frameLen;
+    bool m_inFrame;
+    bool m_skipLine;          // 帧超长后丢弃到行尾
+    char m_line[LINK_MAX_LINE];
+    uint16_t m_lineLen;
+    bool m_lineOverrun;
+
+    LinkMessage m_msg;
+
+    uint32_t m_txFrames;
+    uint32_t m_rxFrames;
+    uint32_t m_rxLines;
+    uint32_t m_crcErrors;
+    uint32_t m_frameErrors;   // COBS/长度/类型错误
+    uint32_t m_overruns;
+    uint32_t m_seqGaps;
+    uint32_t m_seqDups;
+
+    LinkRxResult finishFrame();
+
+public:
+    LinkPort();
+    void reset();
+
+    // 编码一条消息（自动填写本类型的下一个序号），返回线上字节数
+    size_t encode(LinkMessage& msg, uint8_t* out);
+    size_t send(Print& out, LinkMessage& msg);
+
+    size_t sendPose(Print& out, float x, float y, float angle, uint32_t stampUs);
+    size_t sendMotion(Print& out, char mode, float value, uint32_t stampUs);
+    size_t sendParam(Print& out, char target, const char* name, float value);
+    size_t sendMode(Print& out, uint8_t mode);
+    size_t sendAck(Print& out, uint8_t type, uint8_t seq, uint8_t status);
+    size_t sendHeartbeat(Print& out, uint32_t txUs, uint32_t echoUs, uint32_t echoRxUs);
+    size_t sendParamDesc(Print& out, const LinkParamDesc& desc);
+
+    // 逐字节喂入接收数据
+    LinkRxResult feed(uint8_t c);
+    const LinkMessage& message() const { return m_msg; }
+    const char* text() const { return m_line; }
+
+    uint32_t getTxFrames() const { return m_txFrames; }
+    uint32_t getRxFrames() const { return m_rxFrames; }
+    uint32_t getRxLines() const { return m_rxLines; }
+    uint32_t getCrcErrors() const { return m_crcErrors; }
+    uint32_t getFrameErrors() const { return m_frameErrors; }
+    uint32_t getOverruns() const { return m_overruns; }
+    uint32_t getSeqGaps() const { return m_seqGaps; }
+    uint32_t getSeqDups() const { return m_seqDups; }
+    void printStats(Print& out) const;
+};
+
+// 接收队列中的一项：一条二进制消息或一行 ASCII
+struct LinkRxItem {
+    uint8_t kind;      // LINK_RX_MESSAGE / LINK_RX_TEXT
+    uint32_t rxUs;     // 拼帧完成时刻（micros），心跳测时用
+    union {
+        LinkMessage msg;
+        char text[LINK_MAX_LINE];
+    };
+};
+
+#define LINK_RX_QUEUE_DEPTH  8
+
+// UART 事件驱动接收：由串口驱动的事件任务（onReceive 回调）逐字节拼帧，
+// 完整消息放入 FreeRTOS 队列，主循环用 poll() 非阻塞取出，永远不在串口上等待
+class LinkReceiver {
+private:
+    HardwareSerial& m_serial;
+    LinkPort& m_port;
+    QueueHandle_t m_queue;
+    uint32_t m_queueDrops;   // 队列满时丢弃的消息数
+    LinkRxItem m_item;       // 只在事件任务中使用
+
+    void onData();
+
+public:
+    LinkReceiver(HardwareSerial& serial, LinkPort& port);
+
+    // 在 serial.begin() 之后调用
+    bool begin(uint8_t depth = LINK_RX_QUEUE_DEPTH);
+    bool poll(LinkRxItem& out);
+
+    uint32_t getQueueDrops() const { return m_queueDrops; }
+    void printStats(Print& out) const;
+};
+
+// 两板时钟同步（NTP 式）：每次心跳得到一组 t1..t4
+//   offset = ((t2 - t1) + (t3 - t4)) / 2  （对端 micros - 本端 micros），误差界 = RTT / 2
+// 每秒只保留 RTT 最小的一个样本，在最近 LINK_CLOCK_SAMPLES 秒上按 1/RTT² 加权拟合 offset + 漂移
+#define LINK_CLOCK_SAMPLES    32
+#define LINK_CLOCK_BUCKET_MS  1000
+
+class LinkClock {
+private:
+    struct Sample {
+        uint32_t localUs;   // t4
+        int32_t offsetUs;
+        uint32_t rttUs;
+    };
+
+    Sample m_samples[LINK_CLOCK_SAMPLES];
+    uint8_t m_head;
+    uint8_t m_count;
+
+    Sample m_best;          // 当前 1 秒桶内 RTT 最小的样本
+    bool m_haveBest;
+    uint32_t m_bucketStartMs;
+
+    bool m_valid;
+    uint32_t m_refUs;       // 拟合参考时刻（本端）
+    int32_t m_offsetUs;     // 参考时刻的 offset
+    float m_driftPpm;       // 对端相对本端的频率差
+    float m_uncertaintyUs;
+
+    void solve();
+
+public:
+    LinkClock();
+    void reset();
+    void addSample(uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4, uint32_t nowMs);
+
+    bool isValid() const { return m_valid; }
+    int32_t offsetAt(uint32_t localUs) const;
+    // 对端 micros 时间戳 -> 本端 micros
+    uint32_t remoteToLocal(uint32_t remoteUs) const;
+    uint32_t localToRemote(uint32_t localUs) const;
+
+    float getOffsetUs() const { return (float)m_offsetUs; }
+    float getDriftPpm() const { return m_driftPpm; }
+    float getUncertaintyUs() const { return m_uncertaintyUs; }
+    uint8_t getSampleCount() const { return m_count; }
+    void printStatus(Print& out) const;
+};
+
+// 链路监督：周期心跳 + 超时判定 + RTT/丢包统计（两端共用）
+#define LINK_HB_PERIOD_MS        200
+#define LINK_HB_TIMEOUT_MS       600   // 默认超时，可用命令修改
+#define LINK_HB_TIMEOUT_MIN_MS   250
+
+class LinkSupervisor {
+private:
+    uint32_t m_periodMs;
+    uint32_t m_timeoutMs;
+    uint32_t m_lastTxMs;
+    uint32_t m_lastRxMs;
+    bool m_alive;
+
+    // 对端最近一次心跳（用于回显）
+    bool m_havePeer;
+    uint32_t m_peerTxUs;
+    uint32_t m_peerRxUs;
+    uint8_t m_peerSeq;
+
+    float m_rttUs;          // 最近一次
+    float m_rttAvgUs;       // 指数平均
+    float m_rttMinUs;
+    float m_rttMaxUs;
+    uint32_t m_hbTx;
+    uint32_t m_hbRx;
+    uint32_t m_hbMissed;    // 心跳序号缺口
+    uint32_t m_timeouts;
+
+    LinkClock m_clock;
+
+public:
+    LinkSupervisor();
+    void setTimeout(uint32_t ms);
+    uint32_t getTimeout() const { return m_timeoutMs; }
+
+    // 到时则发送一次心跳
+    void service(LinkPort& port, Print& out, uint32_t nowMs);
+    // 收到对端心跳消息（rxUs 为拼帧完成时刻）
+    void onHeartbeat(const LinkMessage& msg, uint32_t rxUs, uint32_t nowMs);
+    // 检查超时；刚刚从“在线”变为“掉线”时返回 true
+    bool checkLost(uint32_t nowMs);
+
+    bool isAlive() const { return m_alive; }
+    float getRttMs() const { return m_rttUs / 1000.0f; }
+    float getRttAvgMs() const { return m_rttAvgUs / 1000.0f; }
+    uint32_t getHbMissed() const { return m_hbMissed; }
+    uint32_t getTimeouts() const { return m_timeouts; }
+    const LinkClock& clock() const { return m_clock; }
+    void printStats(Print& out, uint32_t nowMs) const;
+};
+
+// 运动命令 <-> ASCII（"F70" / "S"），用于串口回显与兼容旧文本命令
+bool linkMotionFromString(const char* s, LinkMotion& m);
+
+// 板上基准测试：位姿消息的二进制 vs 原 ASCII 格式（每条字节数、编码+解析耗时）
+void linkBenchmark(Print& out, uint32_t iterations);
+
+#endif // LINK_PROTO_H
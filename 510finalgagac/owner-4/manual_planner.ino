@@ -2,9 +2,10 @@
 // 使用方法：
 // 1) 如使用预设路线，调用 mp_setDefaultRoute()。
 // 2) 如需运行时更新，使用 MP_ROUTE:x,y,h,b;... 字符串调用 mp_loadRouteString()。
-// 3) 调用 mp_step(x,y,angle) 每次返回一条 "F/L/R/S"，angle 为 -180~180，0° 对应 +Y。
+// 3) 调用 mp_step(x,y,angle) 每次返回一条 MotionCommand（F/L/R/S，优先级 MOTION_PRIO_PLANNER），angle 为 -180~180，0° 对应 +Y。
 
 #include <Arduino.h>
+#include "motion_arbiter.h"
 
 struct Waypoint {
   float x;
@@ -18,7 +19,7 @@ static const uint8_t MP_MAX_ROUTE = 12;
 static Waypoint routeBuf[MP_MAX_ROUTE];
 uint8_t mp_routeCount = 0;
 
-// 参数（可按车速/场景调整，可被运行时更新）
+// 参数（可按车速/场景调整，可被运行时更新，见 params.ino）
 float MP_DIST_TOL     = 50.0f;   // 到点距离阈值 (mm)
 float MP_ANGLE_TOL    = 15.0f;   // 朝向角容差 (deg)
 float MP_SPEED_FAR    = 70.0f;   // 远距离速度
@@ -95,6 +96,38 @@ bool mp_loadRouteString(const String& s) {
   return mp_active;
 }
 
+// 路线随参数配置一起保存：[路点数][x, y, 朝向 f32, 撞击次数 u8] × 路点数
+static const uint16_t MP_WAYPOINT_BYTES = 3 * sizeof(float) + 1;
+
+uint16_t mp_exportRoute(uint8_t* buf, uint16_t cap) {
+  uint16_t n = 0;
+  buf[n++] = 0;
+  for (uint8_t i = 0; i < mp_routeCount && n + MP_WAYPOINT_BYTES <= cap; i++) {
+    memcpy(buf + n, &routeBuf[i].x, sizeof(float));
+    memcpy(buf + n + 4, &routeBuf[i].y, sizeof(float));
+    memcpy(buf + n + 8, &routeBuf[i].headingDeg, sizeof(float));
+    buf[n + 12] = routeBuf[i].bumps;
+    n += MP_WAYPOINT_BYTES;
+    buf[0]++;
+  }
+  return n;
+}
+
+// 只替换路点，不启动规划（开机恢复/加载配置时小车不应自己动起来）
+bool mp_importRoute(const uint8_t* buf, uint16_t len) {
+  if (len < 1 || buf[0] > MP_MAX_ROUTE || len != 1 + buf[0] * MP_WAYPOINT_BYTES) return false;
+  mp_routeCount = buf[0];
+  const uint8_t* p = buf + 1;
+  for (uint8_t i = 0; i < mp_routeCount; i++, p += MP_WAYPOINT_BYTES) {
+    memcpy(&routeBuf[i].x, p, sizeof(float));
+    memcpy(&routeBuf[i].y, p + 4, sizeof(float));
+    memcpy(&routeBuf[i].headingDeg, p + 8, sizeof(float));
+    routeBuf[i].bumps = p[12];
+  }
+  mp_idx = 0; mp_active = false; mp_inBump = false; mp_bumpDone = 0;
+  return true;
+}
+
 // 停止
 void mp_stop() {
   mp_active = false;
@@ -104,23 +137,14 @@ bool mp_isActive() {
   return mp_active;
 }
 
-// 运行时参数更新：键=值
-void mp_updateParam(const String& key, float val) {
-  String k = key;
-  k.toUpperCase();
-  if (k == "MP_DIST_TOL") MP_DIST_TOL = val;
-  else if (k == "MP_ANGLE_TOL") MP_ANGLE_TOL = val;
-  else if (k == "MP_SPEED_FAR") MP_SPEED_FAR = val;
-  else if (k == "MP_SPEED_NEAR") MP_SPEED_NEAR = val;
-  else if (k == "MP_TURN_RATE") MP_TURN_RATE = val;
-  else if (k == "MP_BUMP_FWD_MS") MP_BUMP_FWD_MS = (uint16_t)val;
-  else if (k == "MP_BUMP_STOP_MS") MP_BUMP_STOP_MS = (uint16_t)val;
+static MotionCommand mpCmd(MotionType type, float value) {
+  return motionCommand(type, value, MOTION_PRIO_PLANNER);
 }
 
-// 生成下一步指令；返回 "S/Lxx/Rxx/Fxx"。到达最后一个路点后返回 "S" 并停机。
-String mp_step(float x, float y, float angleDeg) {
+// 生成下一步指令（S/Lxx/Rxx/Fxx）。到达最后一个路点后返回停车并停机。
+MotionCommand mp_step(float x, float y, float angleDeg) {
   if (!mp_active || mp_routeCount == 0) {
-    return "S";
+    return mpCmd(MOTION_STOP, 0);
   }
 
   Waypoint target = routeBuf[mp_idx];
@@ -129,9 +153,9 @@ String mp_step(float x, float y, float angleDeg) {
   if (mp_inBump) {
     unsigned long now = millis();
     if (now - mp_bumpT0 < MP_BUMP_FWD_MS) {
-      return "F60"; // 前冲
+      return mpCmd(MOTION_FORWARD, 60); // 前冲
     } else if (now - mp_bumpT0 < (MP_BUMP_FWD_MS + MP_BUMP_STOP_MS)) {
-      return "S";   // 停顿
+      return mpCmd(MOTION_STOP, 0);   // 停顿
     } else {
       mp_bumpDone++;
       if (mp_bumpDone >= target.bumps) {
@@ -141,11 +165,11 @@ String mp_step(float x, float y, float angleDeg) {
           mp_idx++;
         } else {
           mp_active = false;
-          return "S";
+          return mpCmd(MOTION_STOP, 0);
         }
       }
       mp_bumpT0 = millis();
-      return "S";
+      return mpCmd(MOTION_STOP, 0);
     }
   }
 
@@ -160,16 +184,16 @@ String mp_step(float x, float y, float angleDeg) {
     float desired = mp_normDeg((180.0f / PI) * atan2f(dy, dx) + 90.0f);
     float err = mp_normDeg(desired - angleDeg);
     if (fabsf(err) > MP_ANGLE_TOL) {
-      return (err > 0) ? "R" + String((int)MP_TURN_RATE) : "L" + String((int)MP_TURN_RATE);
+      return (err > 0) ? mpCmd(MOTION_RIGHT, (int)MP_TURN_RATE) : mpCmd(MOTION_LEFT, (int)MP_TURN_RATE);
     }
     float spd = (dist < 150.0f) ? MP_SPEED_NEAR : MP_SPEED_FAR;
-    return "F" + String((int)spd);
+    return mpCmd(MOTION_FORWARD, (int)spd);
   }
 
   // 到点后对准指定朝向
   float headingErr = mp_normDeg(target.headingDeg - angleDeg);
   if (fabsf(headingErr) > MP_ANGLE_TOL) {
-    return (headingErr > 0) ? "R" + String((int)MP_TURN_RATE) : "L" + String((int)MP_TURN_RATE);
+    return (headingErr > 0) ? mpCmd(MOTION_RIGHT, (int)MP_TURN_RATE) : mpCmd(MOTION_LEFT, (int)MP_TURN_RATE);
   }
 
   // 进入撞击阶段（若需要）
@@ -177,16 +201,16 @@ String mp_step(float x, float y, float angleDeg) {
     mp_inBump = true;
     mp_bumpDone = 0;
     mp_bumpT0 = millis();
-    return "F60";
+    return mpCmd(MOTION_FORWARD, 60);
   }
 
   // 无撞击则切到下一个路点
   if (mp_idx + 1 < mp_routeCount) {
     mp_idx++;
-    return "S";
+    return mpCmd(MOTION_STOP, 0);
   } else {
     mp_active = false;
-    return "S";
+    return mpCmd(MOTION_STOP, 0);
   }
 }
 
@@ -195,7 +219,6 @@ String mp_step(float x, float y, float angleDeg) {
 // 在初始化时调用 mp_setRoute(route, ROUTE_COUNT);
 // 在 loop 中：
 // if (mp_isActive()) {
-//   String cmd = mp_step(viveX, viveY, viveAngle);
-//   sendToServant(cmd);
+//   motionArbiter.submit(mp_step(viveX, viveY, viveAngle));
 // }
 
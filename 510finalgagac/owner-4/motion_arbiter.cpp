@@ -0,0 +1,68 @@
+/* Owner 运动命令仲裁实现 */
+
+#include "motion_arbiter.h"
+#include <stdio.h>
+
+size_t motionFormat(const MotionCommand& c, char* buf, size_t len) {
+    int n = (c.type == MOTION_STOP) ? snprintf(buf, len, "S") : snprintf(buf, len, "%c%d", (char)c.type, (int)c.value);
+    return n < 0 ? 0 : (size_t)n;
+}
+
+MotionArbiter::MotionArbiter()
+    : m_count(0), m_held(motionStop(0)), m_heldUntil(0), m_hasHeld(false),
+      m_ticks(0), m_submitted(0), m_conflicts(0), m_heldWins(0), m_expiredStops(0), m_dropped(0) {}
+
+bool MotionArbiter::submit(const MotionCommand& c) {
+    if (m_count >= MOTION_MAX_CANDIDATES) {
+        m_dropped++;
+        return false;
+    }
+    m_candidates[m_count++] = c;
+    m_submitted++;
+    return true;
+}
+
+bool MotionArbiter::arbitrate(uint32_t nowMs, MotionCommand& out) {
+    m_ticks++;
+    const MotionCommand* best = nullptr;
+    for (uint8_t i = 0; i < m_count; i++) {
+        if (!best || m_candidates[i].priority > best->priority) best = &m_candidates[i];
+    }
+    if (m_count > 1) m_conflicts++;
+    bool heldLive = m_hasHeld && (int32_t)(nowMs - m_heldUntil) < 0;
+
+    bool send = true;
+    if (heldLive && (!best || m_held.priority > best->priority)) {
+        if (best) {
+            m_heldWins++;
+            out = m_held;
+        } else {
+            send = false;   // Servant 仍在执行它，无需重复
+        }
+    } else if (best) {
+        m_held = *best;
+        m_heldUntil = nowMs + best->ttlMs;
+        m_hasHeld = true;
+        out = *best;
+    } else if (m_hasHeld) {
+        // 没有行为再提交，上一条也已过期
+        m_hasHeld = false;
+        if (m_held.type != MOTION_STOP) {
+            m_expiredStops++;
+            out = motionStop(m_held.priority, 0);
+        } else {
+            send = false;
+        }
+    } else {
+        send = false;
+    }
+    m_count = 0;
+    return send;
+}
+
+size_t MotionArbiter::formatStats(char* buf, size_t len) const {
+    int n = snprintf(buf, len, "motion arbiter: ticks=%lu submitted=%lu conflicts=%lu held_wins=%lu expired_stops=%lu dropped=%lu\n",
+                     (unsigned long)m_ticks, (unsigned long)m_submitted, (unsigned long)m_conflicts,
+                     (unsigned long)m_heldWins, (unsigned long)m_expiredStops, (unsigned long)m_dropped);
+    return n < 0 ? 0 : (size_t)n;
+}
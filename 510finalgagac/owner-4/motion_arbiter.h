@@ -0,0 +1,82 @@
+/*
+ * Owner 运动命令仲裁：巡墙 / VIVE 点对点 / 手动规划 / 模式切换停车都只产生 MotionCommand（POD，不用 String），
+ * 每个 loop 末尾由仲裁器选出唯一一条，再由 sendMotion() 编码成一帧发给 Servant
+ * - 优先级高者胜，同优先级先提交者胜
+ * - TTL：胜出的命令在 TTL 内仍有效，期间低优先级的命令不能覆盖它；
+ *   所有行为都不再提交且 TTL 过期后补发一次停车（行为停了，小车不会带着最后一条命令一直走）
+ */
+
+#ifndef MOTION_ARBITER_H
+#define MOTION_ARBITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MOTION_MAX_CANDIDATES   8
+#define MOTION_DEFAULT_TTL_MS   200   // 行为每个 loop（约 50ms）都会重新提交
+
+// 取值与 LinkMotion.mode 相同
+enum MotionType : uint8_t {
+    MOTION_STOP     = 'S',
+    MOTION_FORWARD  = 'F',
+    MOTION_BACKWARD = 'B',
+    MOTION_LEFT     = 'L',
+    MOTION_RIGHT    = 'R'
+};
+
+// 同时开启多个模式时，原来按 loop 中的顺序后发者覆盖先发者：巡墙 < 点对点 < 手动规划
+enum MotionPriority : uint8_t {
+    MOTION_PRIO_WALL     = 10,
+    MOTION_PRIO_GOTO     = 20,
+    MOTION_PRIO_PLANNER  = 30,
+    MOTION_PRIO_OPERATOR = 200   // AUTO_OFF / MP_OFF / GOTO_OFF 的立即停车
+};
+
+struct MotionCommand {
+    uint8_t type;       // MotionType
+    float value;        // 速度或转向力度（停车为 0）
+    uint8_t priority;   // MotionPriority
+    uint16_t ttlMs;     // 0 = 只在本 tick 有效
+};
+
+constexpr MotionCommand motionCommand(MotionType type, float value, uint8_t priority,
+                                      uint16_t ttlMs = MOTION_DEFAULT_TTL_MS) {
+    return MotionCommand{(uint8_t)type, value, priority, ttlMs};
+}
+
+constexpr MotionCommand motionStop(uint8_t priority, uint16_t ttlMs = MOTION_DEFAULT_TTL_MS) {
+    return MotionCommand{(uint8_t)MOTION_STOP, 0.0f, priority, ttlMs};
+}
+
+// 格式化成原 ASCII 命令（"F50"、"S"），用于串口回显；返回长度
+size_t motionFormat(const MotionCommand& c, char* buf, size_t len);
+
+class MotionArbiter {
+private:
+    MotionCommand m_candidates[MOTION_MAX_CANDIDATES];
+    uint8_t m_count;
+
+    MotionCommand m_held;   // 上次胜出的命令
+    uint32_t m_heldUntil;
+    bool m_hasHeld;
+
+    uint32_t m_ticks;
+    uint32_t m_submitted;
+    uint32_t m_conflicts;     // 一个 tick 内收到多条命令
+    uint32_t m_heldWins;      // 未过期的高优先级命令挡住了新提交的命令
+    uint32_t m_expiredStops;  // TTL 过期后补发的停车
+    uint32_t m_dropped;       // 候选数组已满
+
+public:
+    MotionArbiter();
+
+    // 行为在本 tick 内提交命令（不发送）
+    bool submit(const MotionCommand& c);
+    // 每个 tick 末尾调用一次：选出要发送的命令写入 out 并返回 true；本 tick 无需发送则返回 false
+    bool arbitrate(uint32_t nowMs, MotionCommand& out);
+
+    // 统计一行（含换行）写入 buf，返回长度；不依赖 Arduino，便于在主机上测试
+    size_t formatStats(char* buf, size_t len) const;
+};
+
+#endif // MOTION_ARBITER_H
@@ -3,22 +3,33 @@
 // Right Wall Following with Auto Switch
 
 #include <HardwareSerial.h>
-
-// ToF function prototypes（在 tof.cpp 中实现）
-void ToF_init();
-bool ToF_read(uint16_t d[3]);
+#include "link_proto.h"
+#include "param_registry.h"
+#include "param_store.h"
+#include "motion_arbiter.h"
+#include "tof.h"   // ToF 读数接口（在 tof-new-sensor.ino 中实现）
 
 // 手动规划（基于 VIVE 路点）
 struct Waypoint; // 在 manual_planner.ino 中定义
 void mp_setRoute(const Waypoint* wp, uint8_t cnt);
 void mp_setDefaultRoute();
 bool mp_loadRouteString(const String& s);
-String mp_step(float x, float y, float angleDeg);
+MotionCommand mp_step(float x, float y, float angleDeg);
 void mp_stop();
 bool mp_isActive();
-void mp_updateParam(const String& key, float val);
+uint16_t mp_exportRoute(uint8_t* buf, uint16_t cap);
+bool mp_importRoute(const uint8_t* buf, uint16_t len);
 extern uint8_t mp_routeCount;
 
+// 参数表（params.ino）
+extern ParamRegistry ownerParams;
+extern ParamStore ownerStore;
+void requestParamDescriptors();
+void serviceParamDescriptors();
+bool setParamText(const String& kv);
+void restoreParamProfile();
+bool handleProfileCommand(const String& cmd);
+
 //~~~~~~~~~~wifi config~~~~~~~~~~~~~~~~
 //const char* SSID     = "MoXianBao";
 //const char* PASSWORD = "olivedog";
@@ -35,10 +46,20 @@ IPAddress subnet(255, 255, 255, 0);
 
 
 // Wall-following behavior
-String decideWallFollowing(uint16_t F, uint16_t R1, uint16_t R2);
+MotionCommand decideWallFollowing(const ToFReading tof[TOF_COUNT]);
 
 HardwareSerial ServantSerial(1);
-uint16_t tofDist[3];
+LinkPort servantLink;   // 与 Servant 之间的二进制消息层（ASCII 行仍然兼容）
+LinkReceiver servantRx(ServantSerial, servantLink);  // UART 事件任务中拼帧，loop 从队列取
+LinkSupervisor servantSup;  // 与 Servant 互发心跳（Servant 据此做掉线停车），统计 RTT/丢包
+
+// 运动命令只在变化时发送；不变的命令按此周期补发一次，防止单帧丢失后一直不更新
+const uint32_t MOTION_REFRESH_MS = 500;
+const uint32_t LINK_REPORT_MS = 5000;
+uint32_t motionSuppressed = 0;
+MotionArbiter motionArbiter;  // 各行为提交的运动命令，每个 loop 只发胜出的一条
+LinkPort consoleLink;  // USB 串口监视器的行拼接（STATUS 等）
+ToFReading tofNow[TOF_COUNT];   // 巡墙用：距离（已校准）+ 置信度 + 年龄 + 状态
 
 // 自动模式开关，默认关闭
 bool isAutoRunning = false;
@@ -46,6 +67,7 @@ bool isAutoRunning = false;
 // Vive 坐标与点对点导航
 float viveX = 0.0f, viveY = 0.0f, viveAngle = 0.0f;
 bool hasViveFix = false;
+uint32_t viveLocalUs = 0;  // 这次坐标在 Servant 上的采样时刻，已换算到本板 micros
 bool isViveGoto = false;
 float gotoTargetX = 0.0f, gotoTargetY = 0.0f;
 const float GOTO_DIST_TOL = 50.0f;   // 到点距离阈值 (mm)
@@ -65,6 +87,23 @@ float   TOF_SCALE_F   = 1.03; // R0/Front 远距离偏小 -> 稍放大
 float   TOF_SCALE_R1  = 1.00;
 float   TOF_SCALE_R2  = 1.00; // 若需要比例修正，可调至 1.05 等
 
+// ToF 测距配置（改动后 ToF 任务重新配置传感器）：巡墙只关心 ~50–500 mm，不需要长距离模式的时间预算
+uint8_t  TOF_DIST_MODE    = TOF_MODE_SHORT;
+uint16_t TOF_BUDGET_F_MS  = 33;    // 前方还要看转弯阈值（最大 500 mm）
+uint16_t TOF_BUDGET_R1_MS = 20;
+uint16_t TOF_BUDGET_R2_MS = 20;
+uint8_t  TOF_STAGGER_MASK = 0x06;  // R1/R2 朝向同一面墙、挨得近，轮流测距免得互相干扰（位 0=F 1=R1 2=R2）
+
+// ToF 滤波：距离变化快于 TOF_GATE_MM_S 的样本要连续两次才信；置信度（测距状态 + 信号/环境光）低于 TOF_MIN_CONF 的不用；
+// 超过 TOF_HOLD_MS 没有可信样本的传感器算“不知道”，巡墙不把它当作“没有墙”
+uint16_t TOF_GATE_MM_S = 1500;
+uint8_t  TOF_MIN_CONF  = 40;
+uint16_t TOF_HOLD_MS   = 250;
+
+static ToFConfig tofParamConfig() {
+  return ToFConfig{TOF_DIST_MODE, {TOF_BUDGET_F_MS, TOF_BUDGET_R1_MS, TOF_BUDGET_R2_MS}, TOF_STAGGER_MASK};
+}
+
 static uint16_t applyToFCal(uint16_t raw, int16_t offset, float scale = 1.0f) {
   int32_t v = (int32_t)((float)raw * scale) + offset;
   if (v < 0) v = 0;
@@ -78,9 +117,9 @@ static float normDeg(float a) {
   return a;
 }
 
-// 简单点对点决策：先对角，再前进，支持减速
-static bool decideViveGoto(String &cmd) {
-  if (!hasViveFix) { cmd = "S"; return false; }
+// 简单点对点决策：先对角，再前进，支持减速；到点后停车并结束点对点
+static MotionCommand decideViveGoto() {
+  if (!hasViveFix) return motionStop(MOTION_PRIO_GOTO);
   float dx = gotoTargetX - viveX;
   float dy = gotoTargetY - viveY;
   float dist = sqrtf(dx * dx + dy * dy);
@@ -90,35 +129,197 @@ static bool decideViveGoto(String &cmd) {
   float err = normDeg(desired - viveAngle);
 
   if (dist < GOTO_DIST_TOL) {
-    cmd = "S";
     isViveGoto = false;
-    return true; // reached
+    return motionStop(MOTION_PRIO_GOTO); // reached
   }
 
   if (fabsf(err) > GOTO_ANGLE_TOL) {
-    cmd = (err > 0) ? "R" + String((int)GOTO_TURN_RATE) : "L" + String((int)GOTO_TURN_RATE);
-    return false;
+    return motionCommand(err > 0 ? MOTION_RIGHT : MOTION_LEFT, (int)GOTO_TURN_RATE, MOTION_PRIO_GOTO);
   }
 
   float spd = (dist < 150.0f) ? GOTO_SPEED_NEAR : GOTO_SPEED_FAR;
-  cmd = "F" + String((int)spd);
-  return false;
+  return motionCommand(MOTION_FORWARD, (int)spd, MOTION_PRIO_GOTO);
+}
+
+// 仲裁胜出的运动命令编码成一帧二进制 MOTION 发出；串口监视器回显实际发出的命令
+void sendMotion(const MotionCommand &cmd) {
+  static uint8_t lastType = 0;
+  static float lastValue = 0.0f;
+  static uint32_t lastSentMs = 0;
+
+  if (cmd.type == lastType && cmd.value == lastValue && millis() - lastSentMs < MOTION_REFRESH_MS) {
+    motionSuppressed++;
+    return;
+  }
+  servantLink.sendMotion(ServantSerial, (char)cmd.type, cmd.value, micros());
+  lastType = cmd.type;
+  lastValue = cmd.value;
+  lastSentMs = millis();
+
+  char text[16];
+  motionFormat(cmd, text, sizeof(text));
+  Serial.println(text);
+}
+
+// Servant 转发来的 ASCII 命令（Web/上位机）
+void handleServantText(String webCmd) {
+  webCmd.trim();
+
+  if (webCmd == "AUTO_ON") {
+    ToF_benchStop(Serial);   // 巡墙要用正常配置
+    isAutoRunning = true;
+    Serial.println(">>> AUTO MODE STARTED <<<");
+  } 
+  else if (webCmd == "AUTO_OFF") {
+    isAutoRunning = false;
+    motionArbiter.submit(motionStop(MOTION_PRIO_OPERATOR, 0)); // 立刻停车
+    Serial.println(">>> AUTO MODE STOPPED <<<");
+  }
+  else if (webCmd == "MP_ON") {
+    isManualPlan = true;
+    isAutoRunning = false;
+    isViveGoto = false;
+    // 使用当前路点；若未动态下发，则加载默认路线
+    if (mp_routeCount == 0) mp_setDefaultRoute();
+    mp_setRoute(nullptr, mp_routeCount); // 重新起步
+    Serial.println(">>> MANUAL PLANNER STARTED <<<");
+  }
+  else if (webCmd == "MP_OFF") {
+    isManualPlan = false;
+    mp_stop();
+    motionArbiter.submit(motionStop(MOTION_PRIO_OPERATOR, 0));
+    Serial.println(">>> MANUAL PLANNER STOPPED <<<");
+  }
+  else if (webCmd.startsWith("MP_ROUTE:")) {
+    String payload = webCmd.substring(8);
+    if (mp_loadRouteString(payload)) {
+      Serial.printf(">>> MP_ROUTE loaded, count=%d\n", mp_routeCount);
+    } else {
+      Serial.println(">>> MP_ROUTE load failed (format: x,y,h,b;...)");
+    }
+  }
+  // 参数更新: PARAM:参数名=值（MP_PARAM: 为旧写法，同一张参数表）
+  else if (webCmd.startsWith("PARAM:") || webCmd.startsWith("MP_PARAM:")) {
+    String kv = webCmd.substring(webCmd.indexOf(':') + 1);
+    Serial.printf(">>> 参数更新: %s %s\n", kv.c_str(), setParamText(kv) ? "" : "(unknown)");
+  }
+  // Servant 请求参数表（网页生成滑块）
+  else if (webCmd == "PARAM_LIST") {
+    requestParamDescriptors();
+  }
+  // 参数配置保存/加载（PSAVE/PLOAD/PDIFF/PLIST/PDEL），在 params.ino 中处理
+  else if (handleProfileCommand(webCmd)) {
+    return;
+  }
+  // 解析 VIVE 数据: "VIVE:x,y,a"
+  else if (webCmd.startsWith("VIVE:")) {
+    int c1 = webCmd.indexOf(',');
+    int c2 = webCmd.indexOf(',', c1 + 1);
+    if (c1 > 5 && c2 > c1) {
+      viveX = webCmd.substring(5, c1).toFloat();
+      viveY = webCmd.substring(c1 + 1, c2).toFloat();
+      viveAngle = webCmd.substring(c2 + 1).toFloat();
+      viveAngle = normDeg(viveAngle);
+      hasViveFix = true;
+    }
+  }
+  // 设置/启动 VIVE 点对点: "GOTO:x,y"
+  else if (webCmd.startsWith("GOTO:")) {
+    int c = webCmd.indexOf(',');
+    if (c > 5) {
+      gotoTargetX = webCmd.substring(5, c).toFloat();
+      gotoTargetY = webCmd.substring(c + 1).toFloat();
+      isViveGoto = true;
+      isAutoRunning = false;
+      Serial.printf(">>> VIVE GOTO start: target=(%.1f, %.1f)\n", gotoTargetX, gotoTargetY);
+    }
+  }
+  // ToF 测量模式：TOF_BENCH[:每种设置的统计时间 ms]，各种距离模式 × 时间预算的采样率与噪声
+  else if (webCmd.startsWith("TOF_BENCH") && webCmd != "TOF_BENCH_STOP") {
+    uint32_t windowMs = webCmd.startsWith("TOF_BENCH:") ? webCmd.substring(10).toInt() : 2000;
+    if (isAutoRunning) Serial.println(">>> TOF_BENCH: stop auto mode first");
+    else if (!ToF_benchStart(windowMs)) Serial.println(">>> TOF_BENCH: already running");
+  }
+  else if (webCmd == "TOF_BENCH_STOP") {
+    ToF_benchStop(Serial);
+  }
+  else if (webCmd == "GOTO_OFF") {
+    isViveGoto = false;
+    motionArbiter.submit(motionStop(MOTION_PRIO_OPERATOR, 0));
+    Serial.println(">>> VIVE GOTO stopped");
+  }
+}
+
+// Servant 发来的二进制消息：模式切换复用文本命令的处理，参数直接更新并回 ACK
+void handleServantMessage(const LinkMessage &msg, uint32_t rxUs) {
+  switch (msg.type) {
+    case LINK_HEARTBEAT:
+      servantSup.onHeartbeat(msg, rxUs, millis());
+      break;
+    case LINK_POSE:
+      viveX = msg.pose.x;
+      viveY = msg.pose.y;
+      viveAngle = normDeg(msg.pose.angle);
+      hasViveFix = true;
+      // 时钟未同步时只能退而用接收时刻
+      viveLocalUs = servantSup.clock().isValid() ? servantSup.clock().remoteToLocal(msg.pose.stampUs) : rxUs;
+      break;
+    case LINK_MODE: {
+      static const char *modeCmd[] = { "AUTO_OFF", "AUTO_ON", "MP_OFF", "MP_ON", "GOTO_OFF" };
+      bool ok = msg.mode.mode < sizeof(modeCmd) / sizeof(modeCmd[0]);
+      if (ok) handleServantText(modeCmd[msg.mode.mode]);
+      servantLink.sendAck(ServantSerial, msg.type, msg.seq, ok ? 0 : 1);
+      break;
+    }
+    case LINK_PARAM: {
+      // 巡墙/手动规划参数在同一张表里，按名字查找即可（target 仅作提示）
+      bool ok = ownerParams.set(msg.param.name, msg.param.value);
+      Serial.printf(">>> 参数更新: %s = %.2f%s\n", msg.param.name, msg.param.value, ok ? "" : " (unknown)");
+      servantLink.sendAck(ServantSerial, msg.type, msg.seq, ok ? 0 : 1);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+// 坐标的“年龄”：从 Servant 计算出坐标到现在
+float viveAgeMs() {
+  return (uint32_t)(micros() - viveLocalUs) / 1000.0f;
 }
 
-void sendToServant(const String &cmd) {
-  ServantSerial.println(cmd);
-  Serial.println(cmd);
+void printStatus() {
+  Serial.println("===== OWNER STATUS =====");
+  Serial.printf("mode: auto=%d manualPlan=%d goto=%d\n", isAutoRunning, isManualPlan, isViveGoto);
+  if (hasViveFix) {
+    Serial.printf("vive: x=%.1f y=%.1f a=%.1f age=%.1f ms%s\n", viveX, viveY, viveAngle, viveAgeMs(),
+                  servantSup.clock().isValid() ? "" : " (unsynced)");
+  } else {
+    Serial.println("vive: no fix");
+  }
+  servantSup.printStats(Serial, millis());
+  servantSup.clock().printStatus(Serial);
+  servantRx.printStats(Serial);
+  ToF_printStats(Serial);
+  ownerParams.printStats(Serial);
+  Serial.printf("param profile: %s\n", ownerStore.activeProfile());
+  Serial.printf("link motion: suppressed duplicates=%lu\n", (unsigned long)motionSuppressed);
+  char arbiterStats[160];
+  motionArbiter.formatStats(arbiterStats, sizeof(arbiterStats));
+  Serial.print(arbiterStats);
 }
 
 void setup() {
   Serial.begin(115200);
   delay(300);
   Serial.println("\n===== OWNER BOARD (Right Wall Logic) =====");
-  
-  ToF_init();
+  restoreParamProfile();
+
+  ToF_init(tofParamConfig());   // 用恢复后的参数配置传感器
 
   // Owner RX=GPIO18, TX=GPIO17 （与 Servant 交叉连接；Servant TX=17 -> Owner RX=18）
   ServantSerial.begin(115200, SERIAL_8N1, 18, 17);
+  servantRx.begin();
   Serial.println("UART to servant ready. Waiting for Start...");
 }
 
@@ -126,126 +327,82 @@ void loop() {
   static uint32_t lastToFPrint = 0;
   uint16_t tofMon[3];
 
-  // 1. 处理来自 Servant 的 Web/上位机指令
-  if (ServantSerial.available()) {
-    String webCmd = ServantSerial.readStringUntil('\n');
-    webCmd.trim();
+  // 1. 处理来自 Servant 的 Web/上位机指令（二进制帧与 ASCII 行混合）
+  static LinkRxItem rxItem;
+  while (servantRx.poll(rxItem)) {
+    if (rxItem.kind == LINK_RX_MESSAGE) handleServantMessage(rxItem.msg, rxItem.rxUs);
+    else handleServantText(String(rxItem.text));
+  }
 
-    if (webCmd == "AUTO_ON") {
-      isAutoRunning = true;
-      Serial.println(">>> AUTO MODE STARTED <<<");
-    } 
-    else if (webCmd == "AUTO_OFF") {
-      isAutoRunning = false;
-      sendToServant("S"); // 立刻停车
-      Serial.println(">>> AUTO MODE STOPPED <<<");
-    }
-    else if (webCmd == "MP_ON") {
-      isManualPlan = true;
-      isAutoRunning = false;
-      isViveGoto = false;
-      // 使用当前路点；若未动态下发，则加载默认路线
-      if (mp_routeCount == 0) mp_setDefaultRoute();
-      mp_setRoute(nullptr, mp_routeCount); // 重新起步
-      Serial.println(">>> MANUAL PLANNER STARTED <<<");
-    }
-    else if (webCmd == "MP_OFF") {
-      isManualPlan = false;
-      mp_stop();
-      sendToServant("S");
-      Serial.println(">>> MANUAL PLANNER STOPPED <<<");
-    }
-    else if (webCmd.startsWith("MP_ROUTE:")) {
-      String payload = webCmd.substring(8);
-      if (mp_loadRouteString(payload)) {
-        Serial.printf(">>> MP_ROUTE loaded, count=%d\n", mp_routeCount);
-      } else {
-        Serial.println(">>> MP_ROUTE load failed (format: x,y,h,b;...)");
-      }
-    }
-    else if (webCmd.startsWith("MP_PARAM:")) {
-      // 形如 MP_PARAM:MP_SPEED_FAR=70
-      String kv = webCmd.substring(9);
-      int eq = kv.indexOf('=');
-      if (eq > 0) {
-        String key = kv.substring(0, eq);
-        float val = kv.substring(eq + 1).toFloat();
-        mp_updateParam(key, val);
-        Serial.printf(">>> MP_PARAM %s = %.2f\n", key.c_str(), val);
-      }
-    }
-    // 处理参数更新命令: PARAM:参数名=值
-    else if (webCmd.startsWith("PARAM:")) {
-      String paramStr = webCmd.substring(6); // 去掉"PARAM:"
-      int eqPos = paramStr.indexOf('=');
-      if (eqPos > 0) {
-        String paramName = paramStr.substring(0, eqPos);
-        float paramValue = paramStr.substring(eqPos + 1).toFloat();
-        updateWallParam(paramName, paramValue);
-        Serial.printf(">>> 参数更新: %s = %.2f\n", paramName.c_str(), paramValue);
-      }
-    }
-    // 解析 VIVE 数据: "VIVE:x,y,a"
-    else if (webCmd.startsWith("VIVE:")) {
-      int c1 = webCmd.indexOf(',');
-      int c2 = webCmd.indexOf(',', c1 + 1);
-      if (c1 > 5 && c2 > c1) {
-        viveX = webCmd.substring(5, c1).toFloat();
-        viveY = webCmd.substring(c1 + 1, c2).toFloat();
-        viveAngle = webCmd.substring(c2 + 1).toFloat();
-        viveAngle = normDeg(viveAngle);
-        hasViveFix = true;
-      }
-    }
-    // 设置/启动 VIVE 点对点: "GOTO:x,y"
-    else if (webCmd.startsWith("GOTO:")) {
-      int c = webCmd.indexOf(',');
-      if (c > 5) {
-        gotoTargetX = webCmd.substring(5, c).toFloat();
-        gotoTargetY = webCmd.substring(c + 1).toFloat();
-        isViveGoto = true;
-        isAutoRunning = false;
-        Serial.printf(">>> VIVE GOTO start: target=(%.1f, %.1f)\n", gotoTargetX, gotoTargetY);
-      }
-    }
-    else if (webCmd == "GOTO_OFF") {
-      isViveGoto = false;
-      sendToServant("S");
-      Serial.println(">>> VIVE GOTO stopped");
+  // USB 串口监视器命令（非阻塞拼行）
+  while (Serial.available()) {
+    if (consoleLink.feed(Serial.read()) == LINK_RX_TEXT) {
+      String cmd = String(consoleLink.text());
+      cmd.trim();
+      cmd.toUpperCase();
+      if (cmd == "STATUS") printStatus();
+      else if (cmd == "PARAMS") { ownerParams.printAll(Serial); ownerParams.printStats(Serial); }
+      else handleServantText(cmd);  // 也可在串口直接输入 AUTO_ON / GOTO:x,y 等
+      break;
     }
   }
 
-  // 2. auto mode 开了才跑巡墙，并打印 ToF 读数到串口监视器
-  if (isAutoRunning) {
-    if (ToF_read(tofDist)) {
-      uint16_t F  = applyToFCal(tofDist[0], TOF_OFFSET_F, TOF_SCALE_F);
-      uint16_t R1 = applyToFCal(tofDist[1], TOF_OFFSET_R1, TOF_SCALE_R1);
-      uint16_t R2 = applyToFCal(tofDist[2], TOF_OFFSET_R2, TOF_SCALE_R2);
+  // 链路监督：心跳 + 掉线提示 + 定期统计
+  static uint32_t lastLinkReport = 0;
+  servantSup.service(servantLink, ServantSerial, millis());
+  if (servantSup.checkLost(millis())) {
+    Serial.println("[LINK] servant heartbeat lost");
+  }
+  // 链路（重新）建立后把参数表推给 Servant，之后每轮发一项
+  static bool servantWasAlive = false;
+  if (servantSup.isAlive() && !servantWasAlive) requestParamDescriptors();
+  servantWasAlive = servantSup.isAlive();
+  serviceParamDescriptors();
+
+  // 本轮收到的参数更新在决策之前一次性生效；ToF 配置变了交给 ToF 任务
+  ownerParams.applyPending();
+  ToF_configure(tofParamConfig());
+  ToF_setFilter(TOF_GATE_MM_S, TOF_MIN_CONF);
+  ToF_benchService(Serial);
+  ToF_checkWiring(Serial);
+  if (millis() - lastLinkReport >= LINK_REPORT_MS) {
+    lastLinkReport = millis();
+    servantSup.printStats(Serial, millis());
+    Serial.printf("link motion: suppressed duplicates=%lu, rx gaps=%lu crc_err=%lu\n",
+                  (unsigned long)motionSuppressed, (unsigned long)servantLink.getSeqGaps(),
+                  (unsigned long)servantLink.getCrcErrors());
+    ToF_printRates(Serial);
+  }
 
-      // 串口监视器输出 ToF 距离（mm）
-      Serial.printf("ToF: F=%u mm, R1=%u mm, R2=%u mm\n", F, R1, R2);
+  // 2. auto mode 开了才跑巡墙；ToF 由核 0 的 ToF 任务采集并滤波，这里只读双缓冲里的最新值（无锁、无 I2C）
+  if (isAutoRunning) {
+    if (ToF_readings(TOF_HOLD_MS, tofNow)) {
+      tofNow[0].mm = applyToFCal(tofNow[0].mm, TOF_OFFSET_F, TOF_SCALE_F);
+      tofNow[1].mm = applyToFCal(tofNow[1].mm, TOF_OFFSET_R1, TOF_SCALE_R1);
+      tofNow[2].mm = applyToFCal(tofNow[2].mm, TOF_OFFSET_R2, TOF_SCALE_R2);
 
-      String cmd = decideWallFollowing(F, R1, R2);
-      sendToServant(cmd);
+      // 不在这里打印：串口输出会拖慢巡墙，距离由下面每 200 ms 的 [ToF MON] 输出
+      motionArbiter.submit(decideWallFollowing(tofNow));
     } else {
        Serial.println("ToF: no data");
-       sendToServant("S");
+       motionArbiter.submit(motionStop(MOTION_PRIO_WALL));
     }
   } 
 
   // 3. VIVE 点对点（独立于巡墙）
   if (isViveGoto) {
-    String cmd;
-    decideViveGoto(cmd);
-    sendToServant(cmd);
+    motionArbiter.submit(decideViveGoto());
   }
 
   // 4. 手动规划（路点序列 + 撞击）
   if (isManualPlan && mp_isActive() && hasViveFix) {
-    String cmd = mp_step(viveX, viveY, viveAngle);
-    sendToServant(cmd);
+    motionArbiter.submit(mp_step(viveX, viveY, viveAngle));
   }
 
+  // 5. 各行为的命令按优先级/TTL 仲裁，本轮最多发一条
+  MotionCommand motion;
+  if (motionArbiter.arbitrate(millis(), motion)) sendMotion(motion);
+
   // 3. 独立的 ToF 串口监视输出（不依赖 auto 模式）
   if (millis() - lastToFPrint >= 200) { // 每 200ms 一次
     lastToFPrint = millis();
@@ -0,0 +1,121 @@
+/*
+ * 可调参数表：每块板把自己的可调全局量登记在一张 constexpr 数组里
+ *   {名字, ID, 类型, 分组, 变量地址, 最小值, 最大值, 步长}
+ * - 按 ID 查找：ID 就是在表中的位置（表定义处用 paramIdsDense() 静态检查）
+ * - 按名字查找：名字的 FNV-1a 哈希（不分大小写，编译期算好）+ 开放寻址哈希表，O(1)
+ * - set() 只把新值放进待生效队列（可在任意任务/回调中调用），
+ *   applyPending() 在控制周期开头一次性写入变量，同一周期内不会看到改了一半的参数组
+ * - 可枚举（count()/desc()），网页据此生成滑块
+ * 本文件在 gagac-2/ 与 owner-4/ 各有一份，修改时两边保持一致
+ */
+
+#ifndef PARAM_REGISTRY_H
+#define PARAM_REGISTRY_H
+
+#include <Arduino.h>
+
+#define PARAM_MAX_ENTRIES   64
+#define PARAM_HASH_SLOTS    128   // 2 的幂，至少为表长的 2 倍
+#define PARAM_MAX_PENDING   16
+#define PARAM_NAME_MAX      24
+
+enum ParamType : uint8_t {
+    PARAM_BOOL = 0,
+    PARAM_U8,
+    PARAM_U16,
+    PARAM_INT,
+    PARAM_U32,       // unsigned long（毫秒等）
+    PARAM_FLOAT,
+    PARAM_I16
+};
+
+// 分组（也是网页分栏；'W'/'M' 与 link_proto 的参数归属一致）
+#define PARAM_GROUP_WALL     'W'
+#define PARAM_GROUP_PLANNER  'M'
+#define PARAM_GROUP_MOTOR    'P'
+#define PARAM_GROUP_TOF      'T'
+#define PARAM_GROUP_WEB      'N'
+#define PARAM_GROUP_VIVE     'V'
+
+struct ParamDesc {
+    const char* name;
+    uint16_t id;
+    uint8_t type;
+    char group;
+    void* ptr;
+    float minVal;
+    float maxVal;
+    float step;
+    uint32_t hash;
+};
+
+// FNV-1a，不分大小写
+constexpr uint32_t paramHash(const char* s) {
+    uint32_t h = 2166136261u;
+    for (; *s; s++) {
+        char c = (*s >= 'a' && *s <= 'z') ? (char)(*s - 32) : *s;
+        h = (h ^ (uint8_t)c) * 16777619u;
+    }
+    return h;
+}
+
+// 参数名就是变量名
+#define PARAM_ENTRY(id, var, type, group, minVal, maxVal, step) \
+    { #var, id, type, group, (void*)&(var), minVal, maxVal, step, paramHash(#var) }
+
+constexpr bool paramIdsDense(const ParamDesc* table, size_t count, size_t i = 0) {
+    return i >= count || (table[i].id == i && paramIdsDense(table, count, i + 1));
+}
+
+class ParamRegistry {
+private:
+    struct Pending {
+        uint8_t index;
+        float value;
+    };
+
+    const ParamDesc* m_table;
+    uint8_t m_count;
+    uint8_t m_slots[PARAM_HASH_SLOTS];   // 表中位置，0xFF = 空
+
+    Pending m_pending[PARAM_MAX_PENDING];
+    uint8_t m_pendingCount;
+    portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+
+    uint32_t m_applied;
+    uint32_t m_clamped;
+    uint32_t m_dropped;     // 待生效队列满
+    uint8_t m_collisions;   // 建表时发现的重复参数名
+
+    void write(uint8_t index, float value);
+
+public:
+    ParamRegistry(const ParamDesc* table, uint8_t count);
+
+    uint8_t count() const { return m_count; }
+    const ParamDesc& desc(uint8_t index) const { return m_table[index]; }
+
+    // 找不到返回 -1
+    int find(const char* name) const;
+    int findById(uint16_t id) const { return id < m_count ? (int)id : -1; }
+    int findHash(uint32_t hash) const;
+    // 表的“结构指纹”（名字 + 类型），参数表增删改后会变化
+    uint32_t schemaHash() const;
+
+    float get(uint8_t index) const;
+    // 夹到 [min, max] 后放入待生效队列；同一参数多次 set 只保留最后一次
+    bool set(uint8_t index, float value);
+    bool set(const char* name, float value);
+    // 在控制周期开头调用：一次性写入所有待生效的值，返回写入个数
+    uint8_t applyPending();
+    // 夹到范围后立即写入；只能在使用这些参数的同一任务中调用（开机恢复、整套加载）
+    bool setImmediate(uint8_t index, float value);
+
+    void printAll(Print& out) const;
+    void printStats(Print& out) const;
+};
+
+// 解析 "名字=值"（len 为 text 的有效长度，值须以 \0 或空白结尾）；名字过长/格式错误返回 false
+bool paramParseAssignment(const char* text, size_t len, char* name, float& value);
+
+#endif // PARAM_REGISTRY_H
@@ -0,0 +1,273 @@
+/* 参数表 NVS 持久化实现 */
+
+#include "param_store.h"
+#include <stddef.h>
+#include <math.h>
+
+#define PARAM_STORE_KEY_ACTIVE  "_active"
+#define PARAM_STORE_KEY_LIST    "_list"
+#define PARAM_STORE_BLOB_MAX    (sizeof(ParamBlobHeader) + PARAM_MAX_ENTRIES * sizeof(ParamBlobEntry) + PARAM_STORE_MAX_EXTRA)
+
+// 保存/加载/比较共用（只在主循环中调用）
+static uint8_t s_blob[PARAM_STORE_BLOB_MAX];
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// CRC 覆盖头部 crc 字段之前的部分 + 头部之后的全部内容
+static uint32_t blobCrc(const uint8_t* buf, size_t len) {
+    uint32_t crc = crc32Update(0, buf, offsetof(ParamBlobHeader, crc));
+    return crc32Update(crc, buf + sizeof(ParamBlobHeader), len - sizeof(ParamBlobHeader));
+}
+
+const char* paramStoreResultName(ParamStoreResult r) {
+    switch (r) {
+        case PSTORE_OK:        return "OK";
+        case PSTORE_NOT_FOUND: return "NOT_FOUND";
+        case PSTORE_BAD_NAME:  return "BAD_NAME";
+        case PSTORE_CORRUPT:   return "CORRUPT";
+        case PSTORE_VERSION:   return "VERSION";
+        case PSTORE_NO_SPACE:  return "NO_SPACE";
+        case PSTORE_TOO_BIG:   return "TOO_BIG";
+    }
+    return "?";
+}
+
+ParamStore::ParamStore(ParamRegistry& reg, const char* ns)
+    : m_reg(reg), m_ns(ns), m_loadUs(0), m_loadMatched(0), m_loadStored(0), m_schemaChanged(false) {
+    strcpy(m_active, PARAM_STORE_DEFAULT);
+}
+
+bool ParamStore::normalizeName(const char* name, size_t len, char* key) {
+    while (len > 0 && isspace((unsigned char)*name)) { name++; len--; }
+    while (len > 0 && isspace((unsigned char)name[len - 1])) len--;
+    if (len == 0 || len >= PARAM_PROFILE_NAME_LEN || name[0] == '_') return false;
+    for (size_t i = 0; i < len; i++) {
+        char c = (char)tolower((unsigned char)name[i]);
+        if (!isalnum((unsigned char)c) && c != '-' && c != '_') return false;
+        key[i] = c;
+    }
+    key[len] = '\0';
+    return true;
+}
+
+ParamStoreResult ParamStore::readBlob(const char* key, uint8_t* buf, size_t& len) {
+    if (!m_prefs.begin(m_ns, true)) return PSTORE_NOT_FOUND;   // 首次上电命名空间还不存在
+    len = m_prefs.getBytesLength(key);
+    ParamStoreResult r = PSTORE_OK;
+    if (len == 0) r = PSTORE_NOT_FOUND;
+    else if (len > PARAM_STORE_BLOB_MAX) r = PSTORE_TOO_BIG;
+    else if (m_prefs.getBytes(key, buf, len) != len) r = PSTORE_CORRUPT;
+    m_prefs.end();
+    if (r != PSTORE_OK) return r;
+
+    ParamBlobHeader h;
+    if (len < sizeof(h)) return PSTORE_CORRUPT;
+    memcpy(&h, buf, sizeof(h));
+    if (h.magic != PARAM_STORE_MAGIC) return PSTORE_CORRUPT;
+    if (h.version != PARAM_STORE_VERSION) return PSTORE_VERSION;
+    if (len != sizeof(h) + h.count * sizeof(ParamBlobEntry) + h.extraLen) return PSTORE_CORRUPT;
+    if (blobCrc(buf, len) != h.crc) return PSTORE_CORRUPT;
+    return PSTORE_OK;
+}
+
+bool ParamStore::addToList(const char* key) {
+    String names = m_prefs.getString(PARAM_STORE_KEY_LIST, "");
+    String padded = "," + names + ",";
+    if (padded.indexOf("," + String(key) + ",") >= 0) return true;
+    uint8_t n = names.length() ? 1 : 0;
+    for (size_t i = 0; i < names.length(); i++) if (names[i] == ',') n++;
+    if (n >= PARAM_STORE_MAX_PROFILES) return false;
+    if (names.length()) names += ",";
+    names += key;
+    m_prefs.putString(PARAM_STORE_KEY_LIST, names);
+    return true;
+}
+
+ParamStoreResult ParamStore::save(const char* name, const uint8_t* extra, uint16_t extraLen) {
+    char key[PARAM_PROFILE_NAME_LEN];
+    if (!normalizeName(name, strlen(name), key)) return PSTORE_BAD_NAME;
+    if (extraLen > PARAM_STORE_MAX_EXTRA) return PSTORE_TOO_BIG;
+
+    ParamBlobHeader h;
+    h.magic = PARAM_STORE_MAGIC;
+    h.version = PARAM_STORE_VERSION;
+    h.count = m_reg.count();
+    h.schema = m_reg.schemaHash();
+    h.extraLen = extraLen;
+    h.reserved = 0;
+    h.crc = 0;
+
+    size_t len = sizeof(h);
+    for (uint8_t i = 0; i < m_reg.count(); i++) {
+        ParamBlobEntry e{m_reg.desc(i).hash, m_reg.get(i)};
+        memcpy(s_blob + len, &e, sizeof(e));
+        len += sizeof(e);
+    }
+    if (extraLen) memcpy(s_blob + len, extra, extraLen);
+    len += extraLen;
+    memcpy(s_blob, &h, sizeof(h));
+    h.crc = blobCrc(s_blob, len);
+    memcpy(s_blob, &h, sizeof(h));
+
+    if (!m_prefs.begin(m_ns, false)) return PSTORE_NO_SPACE;
+    ParamStoreResult r = PSTORE_OK;
+    if (!m_prefs.isKey(key) && !addToList(key)) r = PSTORE_NO_SPACE;
+    else if (m_prefs.putBytes(key, s_blob, len) != len) r = PSTORE_NO_SPACE;
+    else if (strcmp(m_active, key) != 0 || !m_prefs.isKey(PARAM_STORE_KEY_ACTIVE)) m_prefs.putString(PARAM_STORE_KEY_ACTIVE, key);
+    m_prefs.end();
+    if (r == PSTORE_OK) strcpy(m_active, key);
+    return r;
+}
+
+ParamStoreResult ParamStore::load(const char* name, uint8_t* extra, uint16_t* extraLen) {
+    char key[PARAM_PROFILE_NAME_LEN];
+    if (!normalizeName(name, strlen(name), key)) return PSTORE_BAD_NAME;
+
+    uint32_t t0 = micros();
+    size_t len = 0;
+    ParamStoreResult r = readBlob(key, s_blob, len);
+    if (r != PSTORE_OK) return r;
+
+    ParamBlobHeader h;
+    memcpy(&h, s_blob, sizeof(h));
+    uint16_t matched = 0;
+    const uint8_t* p = s_blob + sizeof(h);
+    for (uint16_t k = 0; k < h.count; k++, p += sizeof(ParamBlobEntry)) {
+        ParamBlobEntry e;
+        memcpy(&e, p, sizeof(e));
+        int idx = m_reg.findHash(e.hash);
+        if (idx >= 0 && m_reg.setImmediate((uint8_t)idx, e.value)) matched++;
+    }
+    if (extra && extraLen) {
+        uint16_t n = (h.extraLen <= *extraLen) ? h.extraLen : 0;
+        memcpy(extra, p, n);
+        *extraLen = n;
+    }
+    m_loadUs = micros() - t0;
+    m_loadMatched = matched;
+    m_loadStored = h.count;
+    m_schemaChanged = (h.schema != m_reg.schemaHash());
+
+    if (strcmp(m_active, key) != 0) {
+        strcpy(m_active, key);
+        if (m_prefs.begin(m_ns, false)) {
+            m_prefs.putString(PARAM_STORE_KEY_ACTIVE, key);
+            m_prefs.end();
+        }
+    }
+    return PSTORE_OK;
+}
+
+ParamStoreResult ParamStore::restore(uint8_t* extra, uint16_t* extraLen) {
+    String active = PARAM_STORE_DEFAULT;
+    if (m_prefs.begin(m_ns, true)) {
+        active = m_prefs.getString(PARAM_STORE_KEY_ACTIVE, PARAM_STORE_DEFAULT);
+        m_prefs.end();
+    }
+    char key[PARAM_PROFILE_NAME_LEN];
+    if (!normalizeName(active.c_str(), active.length(), key)) strcpy(key, PARAM_STORE_DEFAULT);
+    strcpy(m_active, key);   // 加载成功时不必再写回 "_active"
+    ParamStoreResult r = load(key, extra, extraLen);
+    if (r != PSTORE_OK && strcmp(key, PARAM_STORE_DEFAULT) != 0) {
+        strcpy(m_active, PARAM_STORE_DEFAULT);
+        r = load(PARAM_STORE_DEFAULT, extra, extraLen);
+    }
+    return r;
+}
+
+ParamStoreResult ParamStore::remove(const char* name) {
+    char key[PARAM_PROFILE_NAME_LEN];
+    if (!normalizeName(name, strlen(name), key)) return PSTORE_BAD_NAME;
+    if (!m_prefs.begin(m_ns, false)) return PSTORE_NOT_FOUND;
+    ParamStoreResult r = PSTORE_OK;
+    if (!m_prefs.isKey(key)) {
+        r = PSTORE_NOT_FOUND;
+    } else {
+        m_prefs.remove(key);
+        String names = "," + m_prefs.getString(PARAM_STORE_KEY_LIST, "") + ",";
+        names.replace("," + String(key) + ",", ",");
+        names = names.substring(1, names.length() > 1 ? names.length() - 1 : 1);
+        m_prefs.putString(PARAM_STORE_KEY_LIST, names);
+        if (strcmp(m_active, key) == 0) {
+            m_prefs.remove(PARAM_STORE_KEY_ACTIVE);
+            strcpy(m_active, PARAM_STORE_DEFAULT);
+        }
+    }
+    m_prefs.end();
+    return r;
+}
+
+int ParamStore::diff(const char* name, Print& out) {
+    char key[PARAM_PROFILE_NAME_LEN];
+    if (!normalizeName(name, strlen(name), key)) return -1;
+    size_t len = 0;
+    ParamStoreResult r = readBlob(key, s_blob, len);
+    if (r != PSTORE_OK) {
+        out.printf("profile '%s': %s\n", key, paramStoreResultName(r));
+        return -1;
+    }
+    ParamBlobHeader h;
+    memcpy(&h, s_blob, sizeof(h));
+    out.printf("diff '%s' (stored) vs current%s:\n", key, h.schema != m_reg.schemaHash() ? " [param table changed]" : "");
+
+    int diffs = 0;
+    uint64_t seen = 0;
+    const uint8_t* p = s_blob + sizeof(h);
+    for (uint16_t k = 0; k < h.count; k++, p += sizeof(ParamBlobEntry)) {
+        ParamBlobEntry e;
+        memcpy(&e, p, sizeof(e));
+        int idx = m_reg.findHash(e.hash);
+        if (idx < 0) {
+            out.printf("  #%08lx  stored=%g (no longer in table)\n", (unsigned long)e.hash, e.value);
+            diffs++;
+            continue;
+        }
+        seen |= 1ULL << idx;
+        float now = m_reg.get((uint8_t)idx);
+        if (fabsf(now - e.value) > 1e-4f * fmaxf(1.0f, fabsf(e.value))) {
+            out.printf("  %-24s stored=%g now=%g\n", m_reg.desc((uint8_t)idx).name, e.value, now);
+            diffs++;
+        }
+    }
+    for (uint8_t i = 0; i < m_reg.count(); i++) {
+        if (!(seen >> i & 1)) {
+            out.printf("  %-24s now=%g (not in profile)\n", m_reg.desc(i).name, m_reg.get(i));
+            diffs++;
+        }
+    }
+    out.printf("  %d difference(s)\n", diffs);
+    return diffs;
+}
+
+void ParamStore::list(Print& out) {
+    String names;
+    if (m_prefs.begin(m_ns, true)) {
+        names = m_prefs.getString(PARAM_STORE_KEY_LIST, "");
+        m_prefs.end();
+    }
+    out.printf("profiles (active: %s):", m_active);
+    if (names.length() == 0) out.print(" none");
+    out.println();
+    int start = 0;
+    while (start < (int)names.length()) {
+        int comma = names.indexOf(',', start);
+        String key = (comma < 0) ? names.substring(start) : names.substring(start, comma);
+        size_t len = 0;
+        ParamStoreResult r = readBlob(key.c_str(), s_blob, len);
+        out.printf("  %-15s %4u bytes  %s\n", key.c_str(), (unsigned)len, paramStoreResultName(r));
+        if (comma < 0) break;
+        start = comma + 1;
+    }
+}
+
+void ParamStore::printLoadInfo(Print& out) const {
+    out.printf("profile '%s': %u/%u params restored in %lu us%s\n", m_active, (unsigned)m_loadMatched,
+               (unsigned)m_loadStored, (unsigned long)m_loadUs, m_schemaChanged ? " (param table changed since save)" : "");
+}
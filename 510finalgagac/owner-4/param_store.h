@@ -0,0 +1,91 @@
+/*
+ * 参数表的 NVS 持久化：整套参数存成一个带版本与 CRC 的二进制块，支持多个命名配置（profile）
+ * - 块格式：ParamBlobHeader + count × {名字哈希, float 值} + 板子自定义的附加段（路线等）
+ * - 按名字哈希对应参数，参数表增删/调整顺序后旧配置仍可加载（找不到的项跳过，缺的项保持当前值）
+ * - 开机时一次 getBytes 读出上次使用（或 "default"）的配置并直接写入变量
+ * - 配置名即 NVS 键（最长 15 字符，小写字母/数字/-/_），另存 "_active"（当前配置）与 "_list"（配置列表）
+ * 本文件在 gagac-2/ 与 owner-4/ 各有一份，修改时两边保持一致
+ */
+
+#ifndef PARAM_STORE_H
+#define PARAM_STORE_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "param_registry.h"
+
+#define PARAM_STORE_NAMESPACE     "params"
+#define PARAM_STORE_VERSION       1
+#define PARAM_STORE_MAGIC         0x314D5250UL   // "PRM1"
+#define PARAM_PROFILE_NAME_LEN    16             // NVS 键最长 15 字符
+#define PARAM_STORE_MAX_PROFILES  8
+#define PARAM_STORE_MAX_EXTRA     256
+#define PARAM_STORE_DEFAULT       "default"
+
+struct ParamBlobHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;      // 参数项数
+    uint32_t schema;     // 保存时参数表的结构指纹
+    uint16_t extraLen;   // 附加段长度
+    uint16_t reserved;
+    uint32_t crc;        // 块中除本字段外全部内容的 CRC-32
+};
+
+struct ParamBlobEntry {
+    uint32_t hash;
+    float value;
+};
+
+enum ParamStoreResult : uint8_t {
+    PSTORE_OK = 0,
+    PSTORE_NOT_FOUND,
+    PSTORE_BAD_NAME,
+    PSTORE_CORRUPT,      // 长度/魔数/CRC 不对
+    PSTORE_VERSION,      // 块格式版本不认识
+    PSTORE_NO_SPACE,     // NVS 写入失败或配置数已满
+    PSTORE_TOO_BIG
+};
+
+class ParamStore {
+private:
+    ParamRegistry& m_reg;
+    const char* m_ns;
+    Preferences m_prefs;
+    char m_active[PARAM_PROFILE_NAME_LEN];
+
+    // 上次成功加载的统计（加载耗时、匹配项数）
+    uint32_t m_loadUs;
+    uint16_t m_loadMatched;
+    uint16_t m_loadStored;
+    bool m_schemaChanged;
+
+    ParamStoreResult readBlob(const char* key, uint8_t* buf, size_t& len);
+    bool addToList(const char* key);
+
+public:
+    ParamStore(ParamRegistry& reg, const char* ns = PARAM_STORE_NAMESPACE);
+
+    // 名字规范化为 NVS 键（转小写）；非法返回 false
+    static bool normalizeName(const char* name, size_t len, char* key);
+
+    // extra/extraLen：板子自定义的附加段（可为空）
+    ParamStoreResult save(const char* name, const uint8_t* extra = nullptr, uint16_t extraLen = 0);
+    // 加载并立即写入参数；extra 不为空时把附加段拷出（extraLen 入参为容量，出参为实际长度）
+    ParamStoreResult load(const char* name, uint8_t* extra = nullptr, uint16_t* extraLen = nullptr);
+    // 开机恢复：加载 "_active" 指向的配置（没有则 "default"）
+    ParamStoreResult restore(uint8_t* extra = nullptr, uint16_t* extraLen = nullptr);
+    ParamStoreResult remove(const char* name);
+
+    // 打印已存配置与当前内存中参数的差异，返回差异项数（出错返回 -1）
+    int diff(const char* name, Print& out);
+    void list(Print& out);
+
+    const char* activeProfile() const { return m_active; }
+    uint32_t getLoadUs() const { return m_loadUs; }
+    void printLoadInfo(Print& out) const;
+};
+
+const char* paramStoreResultName(ParamStoreResult r);
+
+#endif // PARAM_STORE_H
@@ -0,0 +1,153 @@
+// params.ino
+// Owner 可调参数表：巡墙（behavior-wall.ino）、手动规划（manual_planner.ino）、ToF 校准、测距配置与滤波的参数都登记在这里，
+// PARAM:/MP_PARAM: 文本命令与二进制 PARAM 帧都经由 ownerParams 修改，新值在 loop() 开头一次性生效；
+// 整张表（连同手动规划路线）可按名字存成配置，开机恢复上次使用的配置
+
+#include "param_registry.h"
+#include "param_store.h"
+
+constexpr ParamDesc OWNER_PARAMS[] = {
+  // 前方避障
+  PARAM_ENTRY( 0, FRONT_TURN_TH,          PARAM_U16,   PARAM_GROUP_WALL, 100, 500, 10),
+  PARAM_ENTRY( 1, FRONT_BACKUP_TH,        PARAM_U16,   PARAM_GROUP_WALL, 20, 150, 5),
+  // 巡墙距离
+  PARAM_ENTRY( 2, WALL_TOO_CLOSE,         PARAM_FLOAT, PARAM_GROUP_WALL, 20, 100, 5),
+  PARAM_ENTRY( 3, WALL_IDEAL,             PARAM_FLOAT, PARAM_GROUP_WALL, 50, 150, 5),
+  PARAM_ENTRY( 4, WALL_TOO_FAR,           PARAM_FLOAT, PARAM_GROUP_WALL, 80, 200, 5),
+  PARAM_ENTRY( 5, RIGHT_LOST_WALL,        PARAM_FLOAT, PARAM_GROUP_WALL, 150, 300, 10),
+  // 速度
+  PARAM_ENTRY( 6, SPEED_FWD,              PARAM_U8,    PARAM_GROUP_WALL, 20, 100, 5),
+  PARAM_ENTRY( 7, SPEED_BACK,             PARAM_U8,    PARAM_GROUP_WALL, 10, 50, 5),
+  // 转向力度
+  PARAM_ENTRY( 8, TURN_SPIN,              PARAM_U8,    PARAM_GROUP_WALL, 50, 200, 2),
+  PARAM_ENTRY( 9, TURN_CORRECT,           PARAM_U8,    PARAM_GROUP_WALL, 5, 50, 1),
+  PARAM_ENTRY(10, TURN_GENTLE,            PARAM_U8,    PARAM_GROUP_WALL, 5, 50, 1),
+  PARAM_ENTRY(11, TURN_HARD_FIND,         PARAM_U8,    PARAM_GROUP_WALL, 50, 200, 5),
+  PARAM_ENTRY(12, TURN_TINY,              PARAM_U8,    PARAM_GROUP_WALL, 5, 30, 1),
+  // 卡死检测
+  PARAM_ENTRY(13, STALL_CHECK_TIME,       PARAM_U32,   PARAM_GROUP_WALL, 500, 4000, 100),
+  PARAM_ENTRY(14, STALL_MOVE_TH,          PARAM_INT,   PARAM_GROUP_WALL, 0, 200, 5),
+  // 动作序列时间 (ms)
+  PARAM_ENTRY(15, MAX_BACKUP_MS,          PARAM_U32,   PARAM_GROUP_WALL, 100, 3000, 50),
+  PARAM_ENTRY(16, SEQ_EXIT_STRAIGHT_MS,   PARAM_U32,   PARAM_GROUP_WALL, 0, 2000, 50),
+  PARAM_ENTRY(17, SEQ_EXIT_TURN_MS,       PARAM_U32,   PARAM_GROUP_WALL, 50, 1500, 50),
+  PARAM_ENTRY(18, SEQ_EXIT_STOP_MS,       PARAM_U32,   PARAM_GROUP_WALL, 50, 1000, 50),
+  PARAM_ENTRY(19, SEQ_FRONT_PRE_STOP_MS,  PARAM_U32,   PARAM_GROUP_WALL, 50, 1000, 50),
+  PARAM_ENTRY(20, SEQ_FRONT_TURN_MS,      PARAM_U32,   PARAM_GROUP_WALL, 100, 2000, 50),
+  PARAM_ENTRY(21, SEQ_FRONT_POST_STOP_MS, PARAM_U32,   PARAM_GROUP_WALL, 50, 1000, 50),
+  PARAM_ENTRY(22, SEQ_STUCK_BACK_MS,      PARAM_U32,   PARAM_GROUP_WALL, 100, 2000, 50),
+  PARAM_ENTRY(23, SEQ_STUCK_TURN_MS,      PARAM_U32,   PARAM_GROUP_WALL, 50, 1000, 50),
+  // 手动规划
+  PARAM_ENTRY(24, MP_DIST_TOL,            PARAM_FLOAT, PARAM_GROUP_PLANNER, 20, 150, 5),
+  PARAM_ENTRY(25, MP_ANGLE_TOL,           PARAM_FLOAT, PARAM_GROUP_PLANNER, 5, 45, 1),
+  PARAM_ENTRY(26, MP_SPEED_FAR,           PARAM_FLOAT, PARAM_GROUP_PLANNER, 20, 100, 5),
+  PARAM_ENTRY(27, MP_SPEED_NEAR,          PARAM_FLOAT, PARAM_GROUP_PLANNER, 10, 80, 5),
+  PARAM_ENTRY(28, MP_TURN_RATE,           PARAM_FLOAT, PARAM_GROUP_PLANNER, 30, 150, 5),
+  PARAM_ENTRY(29, MP_BUMP_FWD_MS,         PARAM_U16,   PARAM_GROUP_PLANNER, 100, 1500, 50),
+  PARAM_ENTRY(30, MP_BUMP_STOP_MS,        PARAM_U16,   PARAM_GROUP_PLANNER, 50, 1000, 50),
+  // ToF 校准（每块传感器的偏移 mm 与比例）
+  PARAM_ENTRY(31, TOF_OFFSET_F,           PARAM_I16,   PARAM_GROUP_TOF, -100, 100, 1),
+  PARAM_ENTRY(32, TOF_OFFSET_R1,          PARAM_I16,   PARAM_GROUP_TOF, -100, 100, 1),
+  PARAM_ENTRY(33, TOF_OFFSET_R2,          PARAM_I16,   PARAM_GROUP_TOF, -100, 100, 1),
+  PARAM_ENTRY(34, TOF_SCALE_F,            PARAM_FLOAT, PARAM_GROUP_TOF, 0.8f, 1.2f, 0.01f),
+  PARAM_ENTRY(35, TOF_SCALE_R1,           PARAM_FLOAT, PARAM_GROUP_TOF, 0.8f, 1.2f, 0.01f),
+  PARAM_ENTRY(36, TOF_SCALE_R2,           PARAM_FLOAT, PARAM_GROUP_TOF, 0.8f, 1.2f, 0.01f),
+  // ToF 测距配置（距离模式 1=短 2=中 3=长，时间预算 ms，轮流测距的传感器位掩码）
+  PARAM_ENTRY(37, TOF_DIST_MODE,          PARAM_U8,    PARAM_GROUP_TOF, 1, 3, 1),
+  PARAM_ENTRY(38, TOF_BUDGET_F_MS,        PARAM_U16,   PARAM_GROUP_TOF, 10, 200, 1),
+  PARAM_ENTRY(39, TOF_BUDGET_R1_MS,       PARAM_U16,   PARAM_GROUP_TOF, 10, 200, 1),
+  PARAM_ENTRY(40, TOF_BUDGET_R2_MS,       PARAM_U16,   PARAM_GROUP_TOF, 10, 200, 1),
+  PARAM_ENTRY(41, TOF_STAGGER_MASK,       PARAM_U8,    PARAM_GROUP_TOF, 0, 7, 1),
+  // ToF 滤波（变化率门限 mm/s、最低置信度 0–100、可信样本的最长保持时间 ms）
+  PARAM_ENTRY(42, TOF_GATE_MM_S,          PARAM_U16,   PARAM_GROUP_TOF, 200, 5000, 100),
+  PARAM_ENTRY(43, TOF_MIN_CONF,           PARAM_U8,    PARAM_GROUP_TOF, 0, 100, 5),
+  PARAM_ENTRY(44, TOF_HOLD_MS,            PARAM_U16,   PARAM_GROUP_TOF, 50, 1000, 10),
+};
+const uint8_t OWNER_PARAM_COUNT = sizeof(OWNER_PARAMS) / sizeof(OWNER_PARAMS[0]);
+static_assert(paramIdsDense(OWNER_PARAMS, OWNER_PARAM_COUNT), "param id must equal its table index");
+ParamRegistry ownerParams(OWNER_PARAMS, OWNER_PARAM_COUNT);
+// 附加段存手动规划路线
+ParamStore ownerStore(ownerParams);
+
+// 向 Servant 逐项发送参数描述（网页滑块用），每次 loop 只发一项，不长时间占用串口
+static uint8_t paramDescCursor = OWNER_PARAM_COUNT;
+
+void requestParamDescriptors() {
+  paramDescCursor = 0;
+}
+
+void serviceParamDescriptors() {
+  if (paramDescCursor >= ownerParams.count()) return;
+  const ParamDesc& d = ownerParams.desc(paramDescCursor);
+  LinkParamDesc out;
+  out.index = paramDescCursor;
+  out.count = ownerParams.count();
+  out.type = d.type;
+  out.group = d.group;
+  out.value = ownerParams.get(paramDescCursor);
+  out.minVal = d.minVal;
+  out.maxVal = d.maxVal;
+  out.step = d.step;
+  strncpy(out.name, d.name, LINK_PARAM_NAME_LEN - 1);
+  out.name[LINK_PARAM_NAME_LEN - 1] = '\0';
+  servantLink.sendParamDesc(ServantSerial, out);
+  paramDescCursor++;
+}
+
+// "名字=值" 文本（PARAM:/MP_PARAM: 之后的部分）
+bool setParamText(const String& kv) {
+  char name[PARAM_NAME_MAX];
+  float value;
+  if (!paramParseAssignment(kv.c_str(), kv.length(), name, value)) return false;
+  return ownerParams.set(name, value);
+}
+
+// 开机恢复上次使用的配置（路线只装入，不启动规划）
+void restoreParamProfile() {
+  uint8_t extra[PARAM_STORE_MAX_EXTRA];
+  uint16_t extraLen = sizeof(extra);
+  ParamStoreResult r = ownerStore.restore(extra, &extraLen);
+  if (r == PSTORE_OK) {
+    if (extraLen > 0) mp_importRoute(extra, extraLen);
+    ownerStore.printLoadInfo(Serial);
+  } else {
+    Serial.printf("Param profile '%s': %s, using built-in defaults\n", ownerStore.activeProfile(), paramStoreResultName(r));
+  }
+}
+
+// 参数配置命令：PSAVE[:名字] / PLOAD:名字 / PDIFF[:名字] / PLIST / PDEL:名字（名字为空时用当前配置）
+// Servant 执行同一条命令后会转发过来；不是这几条命令时返回 false
+bool handleProfileCommand(const String& cmd) {
+  int colon = cmd.indexOf(':');
+  String op = colon < 0 ? cmd : cmd.substring(0, colon);
+  String name = colon < 0 ? String() : cmd.substring(colon + 1);
+  name.trim();
+  op.toUpperCase();
+  const char* profile = name.length() ? name.c_str() : ownerStore.activeProfile();
+
+  if (op == "PSAVE") {
+    uint8_t extra[PARAM_STORE_MAX_EXTRA];
+    uint16_t extraLen = mp_exportRoute(extra, sizeof(extra));
+    Serial.printf(">>> PSAVE %s: %s\n", profile, paramStoreResultName(ownerStore.save(profile, extra, extraLen)));
+  } else if (op == "PLOAD" && name.length()) {
+    uint8_t extra[PARAM_STORE_MAX_EXTRA];
+    uint16_t extraLen = sizeof(extra);
+    ParamStoreResult r = ownerStore.load(profile, extra, &extraLen);
+    if (r == PSTORE_OK) {
+      if (extraLen > 0) mp_importRoute(extra, extraLen);
+      ownerStore.printLoadInfo(Serial);
+      requestParamDescriptors();   // 网页滑块跟着刷新
+    } else {
+      Serial.printf(">>> PLOAD %s: %s\n", profile, paramStoreResultName(r));
+    }
+  } else if (op == "PDIFF") {
+    ownerStore.diff(profile, Serial);
+  } else if (op == "PLIST") {
+    ownerStore.list(Serial);
+  } else if (op == "PDEL" && name.length()) {
+    Serial.printf(">>> PDEL %s: %s\n", profile, paramStoreResultName(ownerStore.remove(profile)));
+  } else {
+    return false;
+  }
+  return true;
+}
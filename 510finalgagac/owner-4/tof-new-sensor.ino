@@ -1,6 +1,7 @@
 #include <Arduino.h>
 #include <Wire.h>
 #include <vl53l4cx_class.h>
+#include "tof.h"
 
 //pin
 constexpr uint8_t SDA_PIN = 8;
@@ -10,6 +11,24 @@ constexpr int XSHUT_PIN1 = 10;
 constexpr int XSHUT_PIN2 = 11;
 constexpr int XSHUT_PIN3 = 12;
 
+// GPIO1 of each sensor (data ready, active low, open drain; internal pull-up), wired as in the README pin table
+constexpr int INT_PIN1 = 4;
+constexpr int INT_PIN2 = 5;
+constexpr int INT_PIN3 = 6;
+
+// a sensor whose interrupt has been silent for TOF_RECOVER_BUDGETS timing budgets (+ slack) is polled once:
+// recovers a missed edge within about one measurement, and keeps a sensor with no GPIO1 wire running
+constexpr uint32_t TOF_RECOVER_BUDGETS = 2;
+constexpr uint32_t TOF_RECOVER_SLACK_MS = 5;
+// after this many fallback polls without a single interrupt, ToF_checkWiring() reports the sensor once
+constexpr uint32_t TOF_WIRING_CHECK_POLLS = 5;
+
+// acquisition task: core 0 (the Arduino loop runs on core 1), woken by the data-ready interrupts
+constexpr uint32_t TOF_I2C_HZ = 400000;
+constexpr BaseType_t TOF_TASK_CORE = 0;
+constexpr uint32_t TOF_TASK_STACK = 4096;
+constexpr UBaseType_t TOF_TASK_PRIORITY = 2;
+TaskHandle_t tofTaskHandle = NULL;
 
 uint8_t SENSOR_ADDR[3] = {0x2A << 1, 0x2B << 1, 0x2C << 1};
 
@@ -21,12 +40,89 @@ VL53L4CX sensor3(&Wire, XSHUT_PIN3);
 
 VL53L4CX *sensors[] = {&sensor1, &sensor2, &sensor3};
 int xshutPins[] = {XSHUT_PIN1, XSHUT_PIN2, XSHUT_PIN3};
+int intPins[] = {INT_PIN1, INT_PIN2, INT_PIN3};
+
+// latest readings of all sensors: the task fills tofWork and publishes it, readers never lock
+DoubleBuffer<ToFFrame> tofFrames;
+ToFFrame tofWork;   // ToF task only
+
+// set by the data-ready ISR, cleared by the ToF task before it reads the sensor
+volatile bool tofReady[NUM_SENSORS] = {false, false, false};
+volatile uint32_t tofReadyUs[NUM_SENSORS] = {0, 0, 0};
+bool tofOnline[NUM_SENSORS] = {false, false, false};
+
+struct ToFStats {
+  volatile uint32_t irqs;
+  uint32_t reads;        // measurements read over I2C
+  uint32_t invalid;      // measurements without a valid target
+  uint32_t recoveries;   // data found by the fallback poll (interrupt edge missed)
+  uint32_t errors;       // I2C / driver errors
+  uint32_t noTarget;     // measurements that saw nothing
+  uint32_t lowConf;      // measurements below the minimum confidence
+  uint32_t gated;        // measurements rejected by the rate-of-change gate
+  uint32_t steps;        // jumps confirmed by a second sample (corners, new obstacles)
+  uint32_t busUs;        // total time spent in I2C reads
+  uint32_t lastReadyMs;
+  uint32_t rateReads;    // reads at the start of the current rate window
+  float rateHz;          // achieved sample rate over the last window
+};
+ToFStats tofStats[NUM_SENSORS];
+constexpr uint32_t TOF_RATE_WINDOW_MS = 1000;
 
-// keeo last distance
-uint16_t last_distances[3] = {0, 0, 0};
+// ranging configuration: ToF_configure() posts, the ToF task applies (only it touches the bus)
+portMUX_TYPE tofCfgMux = portMUX_INITIALIZER_UNLOCKED;
+ToFConfig tofUserCfg;          // last ToF_configure() (the parameters)
+ToFConfig tofPendingCfg;       // waiting for the ToF task
+bool tofCfgPending = false;
+ToFConfig tofActiveCfg;        // what the sensors run now
+uint32_t tofCfgApplied = 0;    // configurations applied so far
 
-void ToF_init();
-bool ToF_read(uint16_t d[3]);
+// turn taking: sensors in tofRingMask range one at a time, the one whose turn it is passes it on after its read
+uint8_t tofRingMask = 0;       // ToF task only (copied into tofActiveCfg's mask under tofCfgMux)
+uint8_t tofTurn = 0;
+uint32_t tofTurnStartMs = 0;
+
+// filtering (ToF task only): confidence floor, rate-of-change gate, median of the last accepted samples
+struct ToFFilterConfig {
+  uint16_t gateMmPerS;   // fastest believable change of a range
+  uint8_t minConf;       // samples below this confidence are not used
+};
+ToFFilterConfig tofFilterUser = {1500, 40};   // last ToF_setFilter()
+ToFFilterConfig tofFilterCfg = {1500, 40};    // ToF task copy
+constexpr uint16_t TOF_GATE_SLACK_MM = 20;    // allowed on top of rate * dt (sensor noise)
+constexpr uint8_t TOF_MEDIAN_LEN = 3;
+
+struct ToFFilterState {
+  uint16_t win[TOF_MEDIAN_LEN];
+  uint8_t n;             // samples in win
+  uint8_t next;
+  uint32_t lastUs;       // last accepted sample
+  uint16_t jump;         // a gated sample waiting for confirmation
+  bool jumpPending;
+};
+ToFFilterState tofFilter[NUM_SENSORS];
+
+// per-setting accumulators for the measurement mode, reset after each configuration change
+struct ToFBenchAcc {
+  uint32_t reads;
+  uint32_t valid;
+  int32_t sum;       // mm
+  uint64_t sumSq;    // mm^2
+};
+portMUX_TYPE tofBenchMux = portMUX_INITIALIZER_UNLOCKED;
+ToFBenchAcc tofBenchAcc[NUM_SENSORS];
+
+void IRAM_ATTR tofDataReadyIsr(void *arg) {
+  uint8_t i = (uint8_t)(uintptr_t)arg;
+  tofReadyUs[i] = micros();
+  tofReady[i] = true;
+  tofStats[i].irqs++;
+  BaseType_t woken = pdFALSE;
+  if (tofTaskHandle) vTaskNotifyGiveFromISR(tofTaskHandle, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+void tofTask(void *);
 
 /*
 void setup() {
@@ -52,10 +148,12 @@ void loop() {
 
 // tof init
 
-void ToF_init() {
+static void tofApplyConfig(const ToFConfig &c);
+
+void ToF_init(const ToFConfig &cfg) {
   // 1. init I2C 
   Wire.begin(SDA_PIN, SCL_PIN);
-  Wire.setClock(100000); 
+  Wire.setClock(TOF_I2C_HZ);
 
   // 2.low
   Serial.println(">>> Resetting sensors...");
@@ -81,7 +179,9 @@ void ToF_init() {
       Serial.print(SENSOR_ADDR[i] >> 1, HEX); 
       Serial.println(")");
       
-      sensors[i]->VL53L4CX_StartMeasurement();
+      tofOnline[i] = true;
+      pinMode(intPins[i], INPUT_PULLUP);
+      attachInterruptArg(digitalPinToInterrupt(intPins[i]), tofDataReadyIsr, (void *)(uintptr_t)i, FALLING);
     } 
     else {
       Serial.print("Sensor "); Serial.print(i + 1);
@@ -92,40 +192,528 @@ void ToF_init() {
     delay(20); 
   }
   Serial.println(">>> All Sensors Ready.");
+
+  // ranging configuration and the first measurements (the task does not exist yet)
+  tofUserCfg = cfg;
+  tofApplyConfig(cfg);
+
+  // from here on only the ToF task touches the bus
+  xTaskCreatePinnedToCore(tofTask, "tof", TOF_TASK_STACK, NULL, TOF_TASK_PRIORITY, &tofTaskHandle, TOF_TASK_CORE);
+  Serial.printf(">>> ToF task on core %d, I2C %lu kHz\n", (int)TOF_TASK_CORE, (unsigned long)(TOF_I2C_HZ / 1000));
+}
+
+//tof configuration
+
+static const char *tofModeName(uint8_t mode) {
+  switch (mode) {
+    case TOF_MODE_SHORT: return "short";
+    case TOF_MODE_MEDIUM: return "medium";
+    case TOF_MODE_LONG: return "long";
+    default: return "?";
+  }
+}
+
+static bool tofInRing(uint8_t i) {
+  return (tofRingMask >> i) & 1;
+}
+
+// fallback poll period of sensor i under the active configuration (ToF task only)
+static uint32_t tofRecoverMs(uint8_t i) {
+  return TOF_RECOVER_BUDGETS * tofActiveCfg.budgetMs[i] + TOF_RECOVER_SLACK_MS;
+}
+
+static uint8_t tofNextInRing(uint8_t i) {
+  for (uint8_t k = 1; k <= NUM_SENSORS; k++) {
+    uint8_t n = (i + k) % NUM_SENSORS;
+    if (tofInRing(n)) return n;
+  }
+  return i;
+}
+
+static void tofStartTurn(uint8_t i) {
+  tofTurn = i;
+  tofTurnStartMs = millis();
+  tofStats[i].lastReadyMs = tofTurnStartMs;
+  if (sensors[i]->VL53L4CX_StartMeasurement() != 0) tofStats[i].errors++;
+}
+
+// stop sensor i and start the next one in the ring; returns the driver status of the stop
+static int tofPassTurn(uint8_t i) {
+  int status = sensors[i]->VL53L4CX_StopMeasurement();
+  tofStartTurn(tofNextInRing(i));
+  return status;
+}
+
+// stop everything, set mode and budgets, restart (free running sensors together, the ring from its first member)
+static void tofApplyConfig(const ToFConfig &c) {
+  uint8_t online = 0;
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (!tofOnline[i]) continue;
+    online |= 1 << i;
+    if (sensors[i]->VL53L4CX_StopMeasurement() != 0) tofStats[i].errors++;
+  }
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (!tofOnline[i]) continue;
+    tofReady[i] = false;
+    // the distance mode resets the timing budget, so the budget goes second
+    if (sensors[i]->VL53L4CX_SetDistanceMode((VL53L4CX_DistanceModes)c.distMode) != 0 ||
+        sensors[i]->VL53L4CX_SetMeasurementTimingBudgetMicroSeconds(c.budgetMs[i] * 1000UL) != 0) {
+      tofStats[i].errors++;
+    }
+  }
+
+  uint8_t ring = c.staggerMask & online;
+  tofRingMask = __builtin_popcount(ring) >= 2 ? ring : 0;
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (!tofOnline[i] || tofInRing(i)) continue;
+    tofStats[i].lastReadyMs = millis();
+    if (sensors[i]->VL53L4CX_StartMeasurement() != 0) tofStats[i].errors++;
+  }
+  if (tofRingMask) tofStartTurn(__builtin_ctz(tofRingMask));
+
+  portENTER_CRITICAL(&tofCfgMux);
+  tofActiveCfg = c;
+  tofActiveCfg.staggerMask = tofRingMask;
+  tofCfgApplied++;
+  portEXIT_CRITICAL(&tofCfgMux);
+
+  portENTER_CRITICAL(&tofBenchMux);
+  memset(tofBenchAcc, 0, sizeof(tofBenchAcc));
+  portEXIT_CRITICAL(&tofBenchMux);
+}
+
+static void tofPost(const ToFConfig &c) {
+  portENTER_CRITICAL(&tofCfgMux);
+  tofPendingCfg = c;
+  tofCfgPending = true;
+  portEXIT_CRITICAL(&tofCfgMux);
+  if (tofTaskHandle) xTaskNotifyGive(tofTaskHandle);
+}
+
+// ToF task: apply a posted configuration, if any
+static void tofTakeConfig() {
+  portENTER_CRITICAL(&tofCfgMux);
+  bool pending = tofCfgPending;
+  ToFConfig c = tofPendingCfg;
+  tofCfgPending = false;
+  tofFilterCfg = tofFilterUser;
+  portEXIT_CRITICAL(&tofCfgMux);
+  if (pending) tofApplyConfig(c);
+}
+
+void ToF_configure(const ToFConfig &cfg) {
+  if (tofConfigEquals(cfg, tofUserCfg)) return;
+  tofUserCfg = cfg;
+  if (!ToF_benchActive()) tofPost(cfg);
+}
+
+void ToF_setFilter(uint16_t gateMmPerS, uint8_t minConf) {
+  portENTER_CRITICAL(&tofCfgMux);
+  tofFilterUser.gateMmPerS = gateMmPerS;
+  tofFilterUser.minConf = minConf;
+  portEXIT_CRITICAL(&tofCfgMux);
 }
 
 //tof reading
 
-bool ToF_read(uint16_t d[3]) {
+// RangeStatus: 0 valid, 6 valid without wrap check, 11 valid merged pulse; 2/12/255 no usable echo;
+// the rest (sigma, phase, wrap, ...) a target is there but its range cannot be trusted
+static bool tofIsNoTarget(uint8_t status) {
+  return status == 2 || status == 12 || status == 255;
+}
+
+// 0-100 from the range status, scaled by how much of the return is signal rather than ambient light
+static uint8_t tofConfidence(uint8_t status, uint32_t signalRate, uint32_t ambientRate) {
+  uint32_t base;
+  switch (status) {
+    case 0: base = 100; break;
+    case 6:
+    case 11: base = 70; break;
+    default: return 0;
+  }
+  uint64_t den = (uint64_t)signalRate + ambientRate / 2;
+  if (den == 0) return 0;
+  // signal only -> base; ambient = 2 x signal -> base / 2
+  return (uint8_t)(base * signalRate / den);
+}
+
+static uint16_t tofMedian(uint8_t i) {
+  const ToFFilterState &f = tofFilter[i];
+  uint16_t a = f.win[0], b = f.win[1], c = f.win[2];
+  if (f.n == 1) return f.win[(f.next + TOF_MEDIAN_LEN - 1) % TOF_MEDIAN_LEN];
+  if (f.n == 2) return (uint16_t)(((uint32_t)f.win[(f.next + 1) % TOF_MEDIAN_LEN] + f.win[(f.next + 2) % TOF_MEDIAN_LEN]) / 2);
+  return max(min(a, b), min(max(a, b), c));
+}
+
+// rate-of-change gate; returns true if the sample went into the median window
+static bool tofFilterAccept(uint8_t i, uint16_t mm, uint32_t us) {
+  ToFFilterState &f = tofFilter[i];
+  if (f.n > 0) {
+    uint32_t dtMs = (us - f.lastUs) / 1000;
+    uint32_t allowed = (uint32_t)tofFilterCfg.gateMmPerS * dtMs / 1000 + TOF_GATE_SLACK_MM;
+    uint16_t ref = tofMedian(i);
+    if ((uint32_t)abs((int32_t)mm - (int32_t)ref) > allowed) {
+      // a glitch comes once; a real step (corner, something new in front) is seen again at the same place
+      bool confirmed = f.jumpPending && (uint32_t)abs((int32_t)mm - (int32_t)f.jump) <= allowed;
+      if (!confirmed) {
+        f.jump = mm;
+        f.jumpPending = true;
+        return false;
+      }
+      tofStats[i].steps++;
+      f.n = 0;   // restart the window at the new level
+    }
+  }
+  f.jumpPending = false;
+  f.win[f.next] = mm;
+  f.next = (f.next + 1) % TOF_MEDIAN_LEN;
+  if (f.n < TOF_MEDIAN_LEN) f.n++;
+  f.lastUs = us;
+  return true;
+}
+
+// read one finished measurement into tofWork and restart the sensor (ToF task only)
+static void tofReadOne(uint8_t i, uint32_t readyUs) {
   VL53L4CX_MultiRangingData_t MultiRangingData;
-  uint8_t NewDataReady = 0;
-  int status = 0;
-  
+  uint32_t t0 = micros();
+  int status = sensors[i]->VL53L4CX_GetMultiRangingData(&MultiRangingData);
+  // in the ring the next sensor only starts once this one has stopped, so they never range together
+  int restartStatus = tofInRing(i) ? tofPassTurn(i) : sensors[i]->VL53L4CX_ClearInterruptAndStartMeasurement();
+  tofStats[i].busUs += micros() - t0;
+  tofStats[i].reads++;
+  if (status != 0 || restartStatus != 0) tofStats[i].errors++;
+
+  // targets are reported nearest first: take the nearest one worth using (a weak near echo is skipped)
+  uint8_t found = status == 0 ? MultiRangingData.NumberOfObjectsFound : 0;
+  uint8_t conf = 0;
+  uint8_t pick = 0;
+  constexpr uint8_t maxTargets = sizeof(MultiRangingData.RangeData) / sizeof(MultiRangingData.RangeData[0]);
+  for (uint8_t k = 0; k < found && k < maxTargets; k++) {
+    const VL53L4CX_TargetRangeData_t &t = MultiRangingData.RangeData[k];
+    uint8_t c = tofConfidence(t.RangeStatus, t.SignalRateRtnMegaCps, t.AmbientRateRtnMegaCps);
+    if (c > conf) {
+      conf = c;
+      pick = k;
+    }
+    if (c >= tofFilterCfg.minConf) break;
+  }
+
+  uint8_t flags = tofWork.flags[i] & TOF_FLAG_FILTERED;
+  if (found > 1) flags |= TOF_FLAG_MULTI;
+  tofWork.status[i] = found ? MultiRangingData.RangeData[pick].RangeStatus : 255;
+  tofWork.raw[i] = conf ? MultiRangingData.RangeData[pick].RangeMilliMeter : 0;
+  tofWork.conf[i] = conf;
+  tofWork.valid[i] = 0;
+  if (!found || tofIsNoTarget(tofWork.status[i])) {
+    flags |= TOF_FLAG_NO_TARGET;
+    tofStats[i].noTarget++;
+  } else if (conf < tofFilterCfg.minConf || conf == 0) {
+    flags |= TOF_FLAG_LOW_CONF;
+    tofStats[i].lowConf++;
+  } else if (tofFilterAccept(i, tofWork.raw[i], readyUs)) {
+    // mm keeps the previous filtered range when this measurement is not used
+    tofWork.mm[i] = tofMedian(i);
+    tofWork.goodUs[i] = readyUs;
+    tofWork.valid[i] = 1;
+    flags |= TOF_FLAG_FILTERED;
+  } else {
+    flags |= TOF_FLAG_GATED;
+    tofStats[i].gated++;
+  }
+  tofWork.flags[i] = flags;
+  if (!tofWork.valid[i]) tofStats[i].invalid++;
+  tofWork.us[i] = readyUs;
+  tofWork.seq[i]++;
+
+  portENTER_CRITICAL(&tofBenchMux);
+  ToFBenchAcc &acc = tofBenchAcc[i];
+  acc.reads++;
+  // the raw range: the bench measures the sensor, not the filter
+  if (tofWork.conf[i] && !(tofWork.flags[i] & TOF_FLAG_NO_TARGET)) {
+    acc.valid++;
+    acc.sum += tofWork.raw[i];
+    acc.sumSq += (uint32_t)tofWork.raw[i] * tofWork.raw[i];
+  }
+  portEXIT_CRITICAL(&tofBenchMux);
+}
+
+// read every sensor that signalled ready; returns true if anything new was read
+static bool tofService() {
+  uint32_t nowMs = millis();
+  bool updated = false;
   for (uint8_t i = 0; i < NUM_SENSORS; i++) {
-    if (digitalRead(xshutPins[i]) == HIGH) {
-      status = sensors[i]->VL53L4CX_GetMeasurementDataReady(&NewDataReady);
-  
-      if (NewDataReady) {
-        status = sensors[i]->VL53L4CX_GetMultiRangingData(&MultiRangingData);
-        sensors[i]->VL53L4CX_ClearInterruptAndStartMeasurement();
-  
-        if (status == 0 && MultiRangingData.NumberOfObjectsFound > 0) {
-           uint8_t rangeStatus = MultiRangingData.RangeData[0].RangeStatus;
-           if (rangeStatus == 0) {
-              last_distances[i] = MultiRangingData.RangeData[0].RangeMilliMeter;
-           }
+    if (!tofOnline[i]) continue;
+    // ring members wait for their turn (they are stopped)
+    if (tofInRing(i) && i != tofTurn) continue;
+
+    if (!tofReady[i]) {
+      if (nowMs - tofStats[i].lastReadyMs < tofRecoverMs(i)) continue;
+      // no interrupt for a while: ask the sensor once (at most every tofRecoverMs)
+      tofStats[i].lastReadyMs = nowMs;
+      uint8_t NewDataReady = 0;
+      if (sensors[i]->VL53L4CX_GetMeasurementDataReady(&NewDataReady) != 0 || !NewDataReady) {
+        // a ring member that never finishes would stall the others: pass the turn on
+        if (tofInRing(i) && nowMs - tofTurnStartMs >= tofRecoverMs(i) + tofActiveCfg.budgetMs[i]) {
+          tofStats[i].errors++;
+          tofPassTurn(i);
         }
+        continue;
       }
+      tofStats[i].recoveries++;
+      tofReadyUs[i] = micros();
     }
+    // clear the flag first: the next edge can only come after ClearInterruptAndStartMeasurement
+    tofReady[i] = false;
+    tofStats[i].lastReadyMs = nowMs;
+    tofReadOne(i, tofReadyUs[i]);
+    updated = true;
   }
+  return updated;
+}
+
+static void tofUpdateRates() {
+  static uint32_t windowStartMs = 0;
+  uint32_t nowMs = millis();
+  uint32_t dt = nowMs - windowStartMs;
+  if (dt < TOF_RATE_WINDOW_MS) return;
+  windowStartMs = nowMs;
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    tofStats[i].rateHz = (tofStats[i].reads - tofStats[i].rateReads) * 1000.0f / dt;
+    tofStats[i].rateReads = tofStats[i].reads;
+  }
+}
+
+// sleeps until a data-ready interrupt (or half the shortest recovery poll period), reads, publishes one frame
+void tofTask(void *) {
+  for (;;) {
+    uint32_t waitMs = tofRecoverMs(0);
+    for (uint8_t i = 1; i < NUM_SENSORS; i++) waitMs = min(waitMs, tofRecoverMs(i));
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs / 2));
+    tofTakeConfig();
+    if (tofService()) tofFrames.publish(tofWork);
+    tofUpdateRates();
+  }
+}
+
+bool ToF_frame(ToFFrame &out) {
+  return tofFrames.read(out);
+}
 
-  d[0] = last_distances[0];
-  d[1] = last_distances[1];
-  d[2] = last_distances[2];
+bool ToF_latest(uint8_t i, ToFSample &out) {
+  ToFFrame f;
+  if (i >= NUM_SENSORS || !tofFrames.read(f) || f.seq[i] == 0) return false;
+  out = ToFSample{f.mm[i], f.raw[i], f.status[i], f.valid[i], f.conf[i], f.flags[i], f.us[i], f.goodUs[i], f.seq[i]};
+  return true;
+}
 
-  Serial.print("F: ");  Serial.print(d[0]); 
-  Serial.print(" mm   R1: "); Serial.print(d[1]); 
-  Serial.print(" mm   R2: "); Serial.print(d[2]); Serial.println(" mm");
+bool ToF_read(uint16_t d[3]) {
+  ToFFrame f;
+  bool have = tofFrames.read(f);
+  bool any = false;
+  bool all = true;
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    d[i] = have ? f.mm[i] : 0;
+    if (!tofOnline[i]) continue;
+    any = true;
+    if (!have || f.seq[i] == 0) all = false;
+  }
+  return any && all;
+}
 
+bool ToF_readings(uint32_t holdMs, ToFReading r[TOF_COUNT]) {
+  ToFFrame f;
+  if (!tofFrames.read(f)) return false;
+  uint32_t nowUs = micros();
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    r[i] = ToFReading{f.mm[i], f.conf[i], TOF_UNKNOWN, UINT32_MAX};
+    if (!tofOnline[i] || f.seq[i] == 0) continue;
+    if (f.flags[i] & TOF_FLAG_FILTERED) r[i].ageMs = (nowUs - f.goodUs[i]) / 1000;
+    if (r[i].ageMs <= holdMs) r[i].state = TOF_OK;
+    // nothing trusted lately, but the sensor is measuring and sees nothing there
+    else if ((f.flags[i] & TOF_FLAG_NO_TARGET) && (nowUs - f.us[i]) / 1000 <= holdMs) r[i].state = TOF_OPEN;
+  }
   return true;
 }
+
+static const char *const TOF_NAMES[NUM_SENSORS] = {"F", "R1", "R2"};
+
+// "R1+R2", "none" when no sensors take turns
+static void tofMaskText(uint8_t mask, char *buf, size_t len) {
+  size_t n = 0;
+  buf[0] = '\0';
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (mask & (1 << i)) n += snprintf(buf + n, len - n, "%s%s", n ? "+" : "", TOF_NAMES[i]);
+    if (n >= len) break;
+  }
+  if (!n) snprintf(buf, len, "none");
+}
+
+void ToF_printStats(Print &out) {
+  const char *const *names = TOF_NAMES;
+  uint32_t nowUs = micros();
+  portENTER_CRITICAL(&tofCfgMux);
+  ToFConfig c = tofActiveCfg;
+  uint32_t applied = tofCfgApplied;
+  ToFFilterConfig f = tofFilterUser;
+  portEXIT_CRITICAL(&tofCfgMux);
+  char turns[12];
+  tofMaskText(c.staggerMask, turns, sizeof(turns));
+  out.printf("ToF cfg: mode=%s budget F/R1/R2=%u/%u/%u ms turns=%s applied=%lu%s gate=%u mm/s min_conf=%u\n",
+             tofModeName(c.distMode), c.budgetMs[0], c.budgetMs[1], c.budgetMs[2], turns, (unsigned long)applied,
+             ToF_benchActive() ? " (bench)" : "", f.gateMmPerS, f.minConf);
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (!tofOnline[i]) {
+      out.printf("ToF %-2s: offline\n", names[i]);
+      continue;
+    }
+    const ToFStats &st = tofStats[i];
+    ToFSample s;
+    bool have = ToF_latest(i, s);
+    out.printf("ToF %-2s: %u mm (raw %u conf %u%s) age=%.1f ms rate=%.1f Hz irq=%lu read=%lu invalid=%lu "
+               "(none=%lu lowconf=%lu gated=%lu) steps=%lu recovered=%lu err=%lu i2c=%.2f ms/read\n",
+               names[i], have ? s.mm : 0, have ? s.raw : 0, have ? s.conf : 0,
+               have && (s.flags & TOF_FLAG_MULTI) ? " multi" : "",
+               have && (s.flags & TOF_FLAG_FILTERED) ? (nowUs - s.goodUs) / 1000.0 : -1.0, st.rateHz,
+               (unsigned long)st.irqs, (unsigned long)st.reads, (unsigned long)st.invalid,
+               (unsigned long)st.noTarget, (unsigned long)st.lowConf, (unsigned long)st.gated,
+               (unsigned long)st.steps, (unsigned long)st.recoveries, (unsigned long)st.errors,
+               st.reads ? st.busUs / 1000.0 / st.reads : 0.0);
+  }
+}
+
+void ToF_checkWiring(Print &out) {
+  static bool reported[NUM_SENSORS] = {false, false, false};
+  portENTER_CRITICAL(&tofCfgMux);
+  ToFConfig c = tofActiveCfg;
+  portEXIT_CRITICAL(&tofCfgMux);
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (reported[i] || !tofOnline[i] || tofStats[i].irqs != 0) continue;
+    if (tofStats[i].recoveries < TOF_WIRING_CHECK_POLLS) continue;
+    reported[i] = true;
+    out.printf(">>> ToF %s: no data-ready interrupt on GPIO%d after %lu polled reads, check its GPIO1 wire "
+               "(polling every %u ms meanwhile)\n", TOF_NAMES[i], intPins[i], (unsigned long)tofStats[i].recoveries,
+               (unsigned)(TOF_RECOVER_BUDGETS * c.budgetMs[i] + TOF_RECOVER_SLACK_MS));
+  }
+}
+
+void ToF_printRates(Print &out) {
+  out.printf("ToF rate: F=%.1f R1=%.1f R2=%.1f Hz\n", tofStats[0].rateHz, tofStats[1].rateHz, tofStats[2].rateHz);
+}
+
+//measurement mode
+
+// every distance mode x budget, same budget on all sensors, turn taking as configured
+constexpr uint8_t TOF_BENCH_MODES[] = {TOF_MODE_SHORT, TOF_MODE_MEDIUM, TOF_MODE_LONG};
+constexpr uint16_t TOF_BENCH_BUDGETS_MS[] = {10, 15, 20, 33, 50, 100};
+constexpr uint8_t TOF_BENCH_STEPS = sizeof(TOF_BENCH_MODES) * (sizeof(TOF_BENCH_BUDGETS_MS) / sizeof(TOF_BENCH_BUDGETS_MS[0]));
+constexpr uint32_t TOF_BENCH_SETTLE_MS = 300;   // first measurements after a restart are dropped
+
+enum ToFBenchPhase : uint8_t { TOF_BENCH_IDLE, TOF_BENCH_APPLY, TOF_BENCH_SETTLE, TOF_BENCH_MEASURE };
+
+struct ToFBench {
+  ToFBenchPhase phase;
+  uint8_t step;
+  uint32_t windowMs;
+  uint32_t applied;    // tofCfgApplied when the step's configuration was posted
+  uint32_t t0;
+  ToFConfig cfg;
+};
+ToFBench tofBench = {TOF_BENCH_IDLE, 0, 0, 0, 0, {}};
+
+bool ToF_benchActive() {
+  return tofBench.phase != TOF_BENCH_IDLE;
+}
+
+bool ToF_benchStart(uint32_t windowMs) {
+  if (ToF_benchActive() || !tofTaskHandle) return false;
+  tofBench.windowMs = constrain(windowMs, 500UL, 10000UL);
+  tofBench.step = 0;
+  tofBench.phase = TOF_BENCH_APPLY;
+  return true;
+}
+
+void ToF_benchStop(Print &out) {
+  if (!ToF_benchActive()) return;
+  tofBench.phase = TOF_BENCH_IDLE;
+  tofPost(tofUserCfg);
+  out.println("ToF bench: stopped, configuration restored");
+}
+
+void ToF_benchService(Print &out) {
+  uint32_t nowMs = millis();
+  switch (tofBench.phase) {
+    case TOF_BENCH_IDLE:
+      return;
+
+    case TOF_BENCH_APPLY: {
+      if (tofBench.step >= TOF_BENCH_STEPS) {
+        tofBench.phase = TOF_BENCH_IDLE;
+        tofPost(tofUserCfg);
+        out.println("ToF bench: done, configuration restored");
+        return;
+      }
+      if (tofBench.step == 0) {
+        char turns[12];
+        tofMaskText(tofUserCfg.staggerMask, turns, sizeof(turns));
+        out.printf("ToF bench: %u settings x %lu ms, turns=%s; keep a static target in front of each sensor\n",
+                   TOF_BENCH_STEPS, (unsigned long)tofBench.windowMs, turns);
+        out.println("mode   budget | sensor rate, mean, noise (sd), valid");
+      }
+      constexpr uint8_t nBudgets = sizeof(TOF_BENCH_BUDGETS_MS) / sizeof(TOF_BENCH_BUDGETS_MS[0]);
+      ToFConfig c = tofUserCfg;
+      c.distMode = TOF_BENCH_MODES[tofBench.step / nBudgets];
+      for (uint8_t i = 0; i < NUM_SENSORS; i++) c.budgetMs[i] = TOF_BENCH_BUDGETS_MS[tofBench.step % nBudgets];
+      portENTER_CRITICAL(&tofCfgMux);
+      tofBench.applied = tofCfgApplied;
+      portEXIT_CRITICAL(&tofCfgMux);
+      tofBench.cfg = c;
+      tofPost(c);
+      tofBench.t0 = nowMs;
+      tofBench.phase = TOF_BENCH_SETTLE;
+      return;
+    }
+
+    case TOF_BENCH_SETTLE: {
+      portENTER_CRITICAL(&tofCfgMux);
+      bool applied = tofCfgApplied != tofBench.applied;
+      portEXIT_CRITICAL(&tofCfgMux);
+      if (!applied) {
+        tofBench.t0 = nowMs;
+        return;
+      }
+      if (nowMs - tofBench.t0 < TOF_BENCH_SETTLE_MS) return;
+      portENTER_CRITICAL(&tofBenchMux);
+      memset(tofBenchAcc, 0, sizeof(tofBenchAcc));
+      portEXIT_CRITICAL(&tofBenchMux);
+      tofBench.t0 = nowMs;
+      tofBench.phase = TOF_BENCH_MEASURE;
+      return;
+    }
+
+    case TOF_BENCH_MEASURE: {
+      if (nowMs - tofBench.t0 < tofBench.windowMs) return;
+      ToFBenchAcc acc[NUM_SENSORS];
+      portENTER_CRITICAL(&tofBenchMux);
+      memcpy(acc, tofBenchAcc, sizeof(acc));
+      portEXIT_CRITICAL(&tofBenchMux);
+      uint32_t dtMs = nowMs - tofBench.t0;
+      const ToFConfig &c = tofBench.cfg;
+      out.printf("%-6s %3u ms |", tofModeName(c.distMode), c.budgetMs[0]);
+      for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+        if (!tofOnline[i]) {
+          out.printf(" %-2s offline                          |", TOF_NAMES[i]);
+          continue;
+        }
+        const ToFBenchAcc &a = acc[i];
+        double mean = a.valid ? (double)a.sum / a.valid : 0.0;
+        double var = a.valid > 1 ? ((double)a.sumSq - (double)a.sum * mean) / (a.valid - 1) : 0.0;
+        out.printf(" %-2s %5.1f Hz %6.1f mm sd %5.2f ok %3u%% |", TOF_NAMES[i], a.reads * 1000.0 / dtMs, mean,
+                   sqrt(var > 0.0 ? var : 0.0), a.reads ? (unsigned)(a.valid * 100 / a.reads) : 0);
+      }
+      out.println();
+      tofBench.step++;
+      tofBench.phase = TOF_BENCH_APPLY;
+      return;
+    }
+  }
+}
@@ -0,0 +1,145 @@
+/*
+ * ToF（3 × VL53L4CX）读数接口，实现在 tof-new-sensor.ino
+ * - 采集在核 0 的 ToF 任务中进行（I2C 400 kHz）：各传感器 GPIO1（数据就绪，低有效）的中断唤醒任务，
+ *   任务只读取发过中断的传感器；读取路径上没有串口输出
+ * - 三个传感器的最新读数放在一个双缓冲的 ToFFrame 里：任务写另一半再切换，
+ *   巡墙（loop，核 1）读取不加锁、不等待，也没有 I2C 访问
+ * - 测距配置（距离模式、每块传感器的时间预算、轮流测距的传感器）由 ToF_configure() 交给 ToF 任务，
+ *   任务停下传感器、改配置再重新启动；轮流测距的传感器同一时刻只有一块在发射（读完一块才启动下一块）
+ * - 每次测量取最近的有效目标（多目标时跳过无效的近目标），按测距状态与信噪比（环境光/信号）给出置信度；
+ *   置信度够的样本先过变化率门限（一次跳变超过门限先不信，连续两次落在新位置才接受，例如过墙角），
+ *   再取最近 3 个样本的中值；没有新样本时保持上一个值并记下它的时刻，读者据此算“年龄”
+ * - ToF_readings() 给巡墙用：新鲜且可信 = TOF_OK，最近的测量明确没有目标 = TOF_OPEN（没有墙），
+ *   其余（太久没有可信样本、传感器不出数）= TOF_UNKNOWN，不能当作“没有墙”
+ * - ToF_bench*：依次试各种距离模式 × 时间预算，测每块传感器的采样率与噪声（静止目标的标准差）
+ */
+
+#ifndef TOF_H
+#define TOF_H
+
+#include <Arduino.h>
+#include <atomic>
+
+#define TOF_COUNT  3
+
+// ToFSample/ToFFrame 的 flags
+#define TOF_FLAG_NO_TARGET  0x01   // 本次测量没有目标（无回波/信号不足）：前方是空的
+#define TOF_FLAG_LOW_CONF   0x02   // 本次测量置信度不够，没有用
+#define TOF_FLAG_GATED      0x04   // 本次测量被变化率门限挡掉
+#define TOF_FLAG_MULTI      0x08   // 本次测量看到不止一个目标
+#define TOF_FLAG_FILTERED   0x10   // mm 里有滤波值（至少接受过一个样本）
+
+// 某个传感器的一次读数（ToF_latest）
+struct ToFSample {
+    uint16_t mm;        // 滤波后的距离（本次没被接受时保持上一次的值）
+    uint16_t raw;       // 本次测量选中的目标距离（0 = 没有）
+    uint8_t status;     // 选中目标的 RangeStatus（0 = 有效，没有目标时为 255）
+    uint8_t valid;      // 本次测量是否被滤波器接受
+    uint8_t conf;       // 本次测量的置信度 0–100
+    uint8_t flags;      // TOF_FLAG_*
+    uint32_t us;        // 数据就绪中断时刻 micros()
+    uint32_t goodUs;    // mm 最后一次更新（接受样本）的时刻
+    uint32_t seq;       // 第几次测量（0 = 还没有数据）
+};
+
+// 三个传感器（F, R1, R2）的最新读数，字段含义同 ToFSample
+struct ToFFrame {
+    uint16_t mm[TOF_COUNT];
+    uint16_t raw[TOF_COUNT];
+    uint8_t status[TOF_COUNT];
+    uint8_t valid[TOF_COUNT];
+    uint8_t conf[TOF_COUNT];
+    uint8_t flags[TOF_COUNT];
+    uint32_t us[TOF_COUNT];
+    uint32_t goodUs[TOF_COUNT];
+    uint32_t seq[TOF_COUNT];
+};
+
+enum ToFState : uint8_t {
+    TOF_OK = 0,      // mm 是新鲜、可信的距离
+    TOF_OPEN,        // 最近的测量明确没有目标（没有墙/前方空）
+    TOF_UNKNOWN      // 不知道：可信样本太旧、传感器不出数或离线
+};
+
+// 巡墙用的读数（ToF_readings）
+struct ToFReading {
+    uint16_t mm;     // 滤波后的距离（TOF_UNKNOWN 时为最后一个可信值，仅供参考）
+    uint8_t conf;    // 最近一次测量的置信度
+    ToFState state;
+    uint32_t ageMs;  // mm 的年龄（从没有过可信样本时为 UINT32_MAX）
+};
+
+// 距离模式（与 VL53L4CX_DISTANCEMODE_* 相同）
+#define TOF_MODE_SHORT   1   // < 1.3 m，抗环境光最好
+#define TOF_MODE_MEDIUM  2
+#define TOF_MODE_LONG    3
+
+struct ToFConfig {
+    uint8_t distMode;              // TOF_MODE_*
+    uint16_t budgetMs[TOF_COUNT];  // 每次测量的时间预算
+    uint8_t staggerMask;           // 轮流测距的传感器（位 0=F 1=R1 2=R2），少于两块时都连续测距
+};
+
+inline bool tofConfigEquals(const ToFConfig& a, const ToFConfig& b) {
+    for (uint8_t i = 0; i < TOF_COUNT; i++) {
+        if (a.budgetMs[i] != b.budgetMs[i]) return false;
+    }
+    return a.distMode == b.distMode && a.staggerMask == b.staggerMask;
+}
+
+// 单写者双缓冲：写者写不在用的那一半后切换，读者读当前这一半，写者从不等待；
+// 只有读者拷贝期间写者又发布了两次（第二次写到读者正在读的那一半）才重试
+template <typename T>
+class DoubleBuffer {
+private:
+    std::atomic<uint32_t> m_seq{0};   // 第 n 次发布：写入时为 2n-1，写完为 2n；当前一半 = (m_seq / 2) & 1
+    T m_buf[2]{};
+
+public:
+    void publish(const T& v) {
+        uint32_t s = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_buf[((s >> 1) + 1) & 1] = v;
+        m_seq.store(s + 2, std::memory_order_release);
+    }
+
+    // 从未发布过也返回 false
+    bool read(T& out) const {
+        for (uint8_t attempt = 0; attempt < 8; attempt++) {
+            uint32_t s = m_seq.load(std::memory_order_acquire);
+            out = m_buf[(s >> 1) & 1];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_seq.load(std::memory_order_relaxed) - (s & ~1u) <= 2) return s >= 2;
+        }
+        return false;
+    }
+};
+
+// 初始化传感器（按 cfg 配置）并启动 ToF 任务
+void ToF_init(const ToFConfig& cfg);
+// 配置变了才交给 ToF 任务重新配置传感器；每个 loop 调用即可，测量模式进行中只记下，结束后生效
+void ToF_configure(const ToFConfig& cfg);
+// 以下都不访问 I2C，可在任何任务中调用
+bool ToF_frame(ToFFrame& out);
+bool ToF_latest(uint8_t i, ToFSample& out);
+// 最近的滤波距离（F, R1, R2）；所有在线传感器都出过数据后返回 true
+bool ToF_read(uint16_t d[TOF_COUNT]);
+// 每个传感器的距离、置信度、年龄与状态；mm 比 holdMs 旧就不再是 TOF_OK；ToF 任务还没发布过数据时返回 false
+bool ToF_readings(uint32_t holdMs, ToFReading r[TOF_COUNT]);
+// 滤波参数（变化率门限 mm/s、接受样本的最低置信度），下一次测量起生效；每个 loop 调用即可
+void ToF_setFilter(uint16_t gateMmPerS, uint8_t minConf);
+void ToF_printStats(Print& out);
+void ToF_printRates(Print& out);
+// 在 loop 中调用：某个传感器一直靠补读出数据、从没来过中断时打印一次（GPIO1 没接或接错）
+void ToF_checkWiring(Print& out);
+
+// 测量模式：每种设置先等 ToF 任务完成配置并稳定，再统计 windowMs；结束后恢复 ToF_configure 的配置
+// 测量时每块传感器前方放静止目标，噪声才有意义
+bool ToF_benchStart(uint32_t windowMs);
+void ToF_benchStop(Print& out);
+bool ToF_benchActive();
+// 在 loop 中调用：推进测量并打印每种设置的结果
+void ToF_benchService(Print& out);
+
+#endif // TOF_H
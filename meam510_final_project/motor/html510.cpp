@@ -11,78 +11,268 @@
   
 void HTML510Server::begin(int port){
     server.begin(port);
+    server.setNoDelay(true);   // responses are one write each; do not let Nagle hold them back
 }
   
-void HTML510Server::attachHandler( String key, void (*handler)() ) {
-  char lastchar = key[key.length()-1];
-  if (lastchar != ' ' && lastchar != '=') 
-    key = key + " ";
+int HTML510Server::findChild(int node, char c) {
+  for (int k = trie[node].child; k >= 0; k = trie[k].sibling) {
+    if (trie[k].c == c) return k;
+  }
+  return -1;
+}
+
+// Insert the key into the trie once; matching a request is then a single walk
+// over its target instead of startsWith() against every key per byte.
+bool HTML510Server::attachHandler(const char* key, void (*handler)()) {
+  int len = strlen(key);
+  if (len == 0 || numHandler >= MAXHANDLERS) return false;
+  bool addSpace = key[len-1] != ' ' && key[len-1] != '=';
+  if (numNodes + len + 1 > HTML510_TRIE_NODES) return false;
+
+  int node = 0;
+  for (int i = 0; i < len + (addSpace ? 1 : 0); i++) {
+    char c = i < len ? key[i] : ' ';
+    int next = findChild(node, c);
+    if (next < 0) {
+      next = numNodes++;
+      trie[next] = {c, -1, -1, trie[node].child};
+      trie[node].child = next;
+    }
+    node = next;
+  }
+  if (trie[node].handler >= 0) return false;   // first registration wins, as before
   handlerptrs[numHandler] = handler;
-  handlerpars[numHandler] = "GET "+key;
-  numHandler++;
+  trie[node].handler = numHandler++;
+  return true;
+}
+
+// Shortest key that prefixes target (the old loop fired on the first key the
+// growing line started with, which is the shortest one). Returns handler or -1.
+int HTML510Server::match(const char* target, int len, int* keyLen) {
+  int node = 0;
+  for (int i = 0; i < len; i++) {
+    node = findChild(node, target[i]);
+    if (node < 0) return -1;
+    if (trie[node].handler >= 0) {
+      *keyLen = i + 1;
+      return trie[node].handler;
+    }
+  }
+  return -1;
 }
 
 //*** HTML text handling routines ****
-void HTML510Server::sendhtml(String data) {
-  String s = HTMLtext;
-  s = s+data;
-  client.print(s);
+static const char* statusText(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 304: return "Not Modified";
+    case 404: return "Not Found";
+    default:  return "";
+  }
+}
+
+// Status line and headers go into a stack buffer; small bodies are appended
+// so the whole response leaves in one write (one TCP segment).
+void HTML510Server::respond(int code, const char* type, const uint8_t* body, size_t len, const char* extra) {
+  if (!cur) return;
+  char buf[HTML510_INLINE_MAX];
+  char length[32] = "";   // a 304 has no body and no Content-Length
+  if (code != 304) snprintf(length, sizeof(length), "Content-Length: %u\r\n", (unsigned)len);
+  int n = snprintf(buf, sizeof(buf), "HTTP/1.1 %d %s\r\n%s%s%s%sConnection: %s\r\n%s\r\n",
+                   code, statusText(code), type ? "Content-Type: " : "", type ? type : "", type ? "\r\n" : "",
+                   length, cur->keepAlive ? "keep-alive" : "close", extra);
+  if (n < 0 || n >= (int)sizeof(buf)) return;
+  if (n + len <= sizeof(buf)) {
+    if (len) memcpy(buf + n, body, len);
+    cur->client.write((const uint8_t*)buf, n + len);
+  } else {
+    cur->client.write((const uint8_t*)buf, n);
+    cur->client.write(body, len);
+  }
+  cur->responded = true;
+}
+
+void HTML510Server::send(int code, const char* type, const char* data, size_t len) {
+  respond(code, type, (const uint8_t*)data, len);
+}
+
+void HTML510Server::sendhtml(const char* data) {
+  send(200, "text/html", data, strlen(data));
+}
+
+void HTML510Server::sendplain(const char* data) {
+  send(200, "text/plain", data, strlen(data));
+}
+
+void HTML510Server::sendplain(int val) {
+  sendplain((long)val);
+}
+
+void HTML510Server::sendplain(long val) {
+  char num[16];
+  int n = snprintf(num, sizeof(num), "%ld", val);
+  send(200, "text/plain", num, n);
+}
+
+void HTML510Server::sendplain(double val, int decimals) {
+  char num[24];
+  int n = snprintf(num, sizeof(num), "%.*f", decimals, val);
+  send(200, "text/plain", num, n);
+}
+
+void HTML510Server::sendjson(const char* data) {
+  send(200, "application/json", data, strlen(data));
+}
+
+// Headers were collected while the request was parsed; If-None-Match may hold a list of tags.
+bool HTML510Server::etagMatches(const char* etag) {
+  return cur && cur->ifNoneMatch[0] && strstr(cur->ifNoneMatch, etag) != NULL;
 }
 
-void HTML510Server::sendplain(String data) {
-  String s = plaintext;
-  s = s+data;
-  client.print(s);
+void HTML510Server::sendgzip(const uint8_t* data, size_t len, const char* etag, const char* type) {
+  char extra[HTML510_ETAG_MAX + 48];
+  snprintf(extra, sizeof(extra), "ETag: %s\r\nCache-Control: no-cache\r\n", etag);
+  if (etagMatches(etag)) {
+    respond(304, NULL, NULL, 0, extra);
+    return;
+  }
+  char gz[sizeof(extra) + 32];
+  snprintf(gz, sizeof(gz), "Content-Encoding: gzip\r\n%s", extra);
+  respond(200, type, data, len, gz);
 }
 
+// Arguments come from the buffered request line, right after the matched key.
 String HTML510Server::getText(){
   String txt = "";
-  while (client.connected()) {
-    if (client.available())  {
-      char c = client.read();
-      if (c<=' ') break;
-      txt += c;
-    }        
-  }
+  if (!cur) return txt;
+  while (cur->argPos < cur->lineLen && cur->line[cur->argPos] > ' ') txt += cur->line[cur->argPos++];
   return txt;
 }
 
 int HTML510Server::getVal(){
-  String num = "";
-  while (client.connected()) {
-    if (client.available())  {
-      char d = client.read();
-      num += d;
-      if (d !='-' && (d<'0' || d>'9') ) break;
-    }        
-  }
-  return num.toInt();
+  if (!cur) return 0;
+  Slot& s = *cur;
+  int val = atoi(s.line + s.argPos);
+  if (s.argPos < s.lineLen && s.line[s.argPos] == '-') s.argPos++;
+  while (s.argPos < s.lineLen && s.line[s.argPos] >= '0' && s.line[s.argPos] <= '9') s.argPos++;
+  return val;
 }
   
 //*** web server hack ***
 // Could use Webserver.h routines, but they are  slower, so use a faster hack
-// looks for key parameter at beginning of header, ignores everything else
+// looks for key parameter at beginning of header, ignores everything else.
+// Non-blocking: each call accepts new connections into free slots, takes
+// whatever bytes have arrived on each, and returns. A handler runs once its
+// request (line + headers) is complete; HTTP/1.1 connections then stay open
+// for the next request.
 void HTML510Server::serve() { 
-  client = server.accept();
-  if (client)  {
-    String currentLine = "";
-
-    while (client.connected()) {
-      if (client.available())  {
-        char c = client.read();
-        //Serial.write(c);
-        if (c== '\n') break; // only read 1st line, break & close connection 
-        
-        currentLine += c;
-        for (int i=0;i<numHandler; i++){
-          if(currentLine.startsWith(handlerpars[i])) {
-            (*handlerptrs[i])(); 
-            client.stop();    // found one, so close the connection
-            return ;
-          }
-        }
+  acceptClients();
+  for (int i = 0; i < HTML510_MAX_CLIENTS; i++) {
+    if (slots[i].client) serviceSlot(slots[i]);
+  }
+}
+
+void HTML510Server::acceptClients() {
+  for (;;) {
+    int freeSlot = -1, idlest = -1;
+    for (int i = 0; i < HTML510_MAX_CLIENTS; i++) {
+      Slot& s = slots[i];
+      if (!s.client) { freeSlot = i; break; }
+      bool idle = !s.inHeaders && s.lineLen == 0;
+      if (idle && (idlest < 0 || s.lastMs < slots[idlest].lastMs)) idlest = i;
+    }
+    if (freeSlot < 0 && idlest < 0) return;   // all busy mid-request; new ones wait in the backlog
+    WiFiClient c = server.accept();
+    if (!c) return;
+    if (freeSlot < 0) {
+      slots[idlest].client.stop();   // make room by closing the longest-idle keep-alive connection
+      freeSlot = idlest;
+    }
+    Slot& s = slots[freeSlot];
+    s.client = c;
+    resetRequest(s);
+  }
+}
+
+void HTML510Server::resetRequest(Slot& s) {
+  s.inHeaders = false;
+  s.keepAlive = false;
+  s.responded = false;
+  s.lineLen = 0;
+  s.headerLen = 0;
+  s.ifNoneMatch[0] = '\0';
+  s.lastMs = millis();
+}
+
+void HTML510Server::serviceSlot(Slot& s) {
+  while (s.client.available()) {
+    char c = s.client.read();
+    if (c == '\r') continue;
+    s.lastMs = millis();
+    if (!s.inHeaders) {
+      if (c != '\n') {
+        if (s.lineLen < HTML510_LINE_MAX - 1) s.line[s.lineLen++] = c;
+        continue;
       }
+      if (s.lineLen == 0) continue;   // stray CRLF between requests
+      s.line[s.lineLen] = '\0';
+      s.inHeaders = true;
+      s.keepAlive = strstr(s.line, "HTTP/1.1") != NULL;   // 1.1 defaults to persistent
+      continue;
+    }
+    if (c != '\n') {
+      if (s.headerLen < HTML510_HEADER_MAX - 1) s.header[s.headerLen++] = c;
+      continue;
+    }
+    if (s.headerLen > 0) {
+      parseHeader(s);
+      continue;
     }
-    client.stop();    // Close the connection
+    // blank line: request complete
+    dispatch(s);
+    if (!s.keepAlive) {
+      s.client.stop();
+      return;
+    }
+    resetRequest(s);
+  }
+
+  unsigned long limit = (s.inHeaders || s.lineLen) ? HTML510_REQUEST_TIMEOUT_MS : HTML510_KEEPALIVE_MS;
+  if (!s.client.connected() || millis() - s.lastMs > limit) {
+    s.client.stop();    // closed, stalled mid-request, or idle too long
+  }
+}
+
+void HTML510Server::parseHeader(Slot& s) {
+  s.header[s.headerLen] = '\0';
+  s.headerLen = 0;
+  if (strncasecmp(s.header, "If-None-Match:", 14) == 0) {
+    const char* v = s.header + 14;
+    while (*v == ' ') v++;
+    strncpy(s.ifNoneMatch, v, HTML510_ETAG_MAX - 1);
+    s.ifNoneMatch[HTML510_ETAG_MAX - 1] = '\0';
+  } else if (strncasecmp(s.header, "Connection:", 11) == 0) {
+    const char* v = s.header + 11;
+    while (*v == ' ') v++;
+    if (strncasecmp(v, "close", 5) == 0) s.keepAlive = false;
+    else if (strncasecmp(v, "keep-alive", 10) == 0) s.keepAlive = true;
+  }
+}
+
+// Requests that match no key get a 404, handlers that send nothing (the
+// /hitW style commands) an empty 200, so the browser never waits on an open
+// connection for a reply that will not come.
+void HTML510Server::dispatch(Slot& s) {
+  cur = &s;
+  int keyLen = 0;
+  int h = -1;
+  if (s.lineLen >= 4 && strncmp(s.line, "GET ", 4) == 0) h = match(s.line + 4, s.lineLen - 4, &keyLen);
+  if (h >= 0) {
+    s.argPos = 4 + keyLen;
+    (*handlerptrs[h])();
+    if (!s.responded) respond(200, "text/plain", NULL, 0);
+  } else {
+    respond(404, "text/plain", NULL, 0);
   }
+  cur = nullptr;
 }
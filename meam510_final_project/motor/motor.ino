@@ -1,6 +1,7 @@
-#include "webpage.h"
+#include "webpage.gz.h"  // generated from webpage.h by tools/build_web_assets.py
 #include "html510.h"
 #include "Wire.h"
+#include "i2c_packet.h"
 #include <ESP32Servo.h>
 
 #define LEDC_RESOLUTION_BITS 12
@@ -25,100 +26,192 @@
 #define SDA 0
 #define SCL 9
 
+// control loop paced by a hardware timer, independent of loop()/web/Serial timing
+#define CONTROL_PERIOD_US 10000
+// encoder speed estimation: median of the last N edge periods, zero if no edge for a while
+#define EDGE_PERIOD_SAMPLES 5
+#define SPEED_TIMEOUT_US 100000
+#define EDGES_PER_RPM 12  // edges/s per "rpm" unit (thx cole)
+#define RPM_GLITCH_LIMIT 110
+#define PRINT_PERIOD_MS 100
+// setpoint packets must keep arriving, otherwise the wheels are stopped
+#define SETPOINT_TIMEOUT_MS 200
+
 const char* ssid = "ben_is_mad";
 
 HTML510Server htmlServer(80);
 Servo servo1;
 
-float Kp = 0.5, Ki = 0, Kd = 0;  // 0.7 //0.033
-float previousError = 0;
+// the wheel PID is incremental (its output is added to dutySave every tick), so the gains are per
+// second and scaled by the tick period: Kp 250 duty/s per rpm of error is the old Kp 0.5 per pass of
+// loop(), which ran at ~500 Hz paced by the 22-byte debug line at 112500 baud
+float Kp = 250, Ki = 0, Kd = 0;
 
-int lastPositionL = 0;
-int lastRpmL = 0;
-int lastPositionR = 0;
-int lastRpmR = 0;
+volatile int lastRpmL = 0;
+volatile int lastRpmR = 0;
 
 volatile uint8_t receivedData[32];
 volatile uint8_t dataLength = 0;
 volatile bool dataReceived = false;
 
+// latest valid setpoint packet, picked up by the control task on its next tick
+volatile int16_t pendingLeft = 0;
+volatile int16_t pendingRight = 0;
+volatile bool setpointReceived = false;
+volatile uint8_t lastSetpointSeq = 0;
+volatile uint32_t setpointCount = 0;
+volatile uint32_t setpointCrcErrors = 0;
+volatile uint32_t setpointDropped = 0;  // gaps in the sequence number
+portMUX_TYPE setpointMux = portMUX_INITIALIZER_UNLOCKED;
+
+// controller, one state per wheel (the types sit above every function: the Arduino builder
+// inserts its generated prototypes ahead of the first one)
+struct WheelController {
+  float integral;
+  float previousError;
+  float lastOutput;
+  int dutySave;  // last signed duty written, the PID output is added on top of it
+};
+
+WheelController ctrlL = { 0, 0, 0, 0 };
+WheelController ctrlR = { 0, 0, 0, 0 };
+
+// the ISRs only capture integer edge periods (us) and direction, speed is computed in the control task
+struct EncoderCapture {
+  volatile uint32_t periods[EDGE_PERIOD_SAMPLES];
+  volatile uint8_t head;
+  volatile uint8_t count;
+  volatile uint32_t lastEdgeUs;
+  volatile int8_t direction;
+};
+
+EncoderCapture encL = { {}, 0, 0, 0, 1 };
+EncoderCapture encR = { {}, 0, 0, 0, 1 };
+portMUX_TYPE encoderMux = portMUX_INITIALIZER_UNLOCKED;
+
 void receiveEvent(int bytesin) {
+  uint8_t buf[sizeof(receivedData)];
   uint8_t len = 0;
 
   while (Wire.available()) {
-    if (len < sizeof(receivedData)) {
-      receivedData[len++] = Wire.read();
+    if (len < sizeof(buf)) {
+      buf[len++] = Wire.read();
     } else {
       Wire.read();  // Discard excess data
     }
   }
+  if (len == 0) return;
+
+  if (buf[0] == I2C_PACKET_START) {
+    SetpointPacket p;
+    if (!decodeSetpointPacket(buf, len, p)) {
+      setpointCrcErrors++;
+      return;
+    }
+    portENTER_CRITICAL(&setpointMux);
+    if (setpointCount > 0) {
+      uint8_t gap = (uint8_t)(p.seq - lastSetpointSeq);
+      if (gap == 0) {  // repeated frame
+        portEXIT_CRITICAL(&setpointMux);
+        return;
+      }
+      setpointDropped += gap - 1;
+    }
+    lastSetpointSeq = p.seq;
+    setpointCount++;
+    pendingLeft = constrain(p.left, -I2C_SETPOINT_MAX, I2C_SETPOINT_MAX);
+    pendingRight = constrain(p.right, -I2C_SETPOINT_MAX, I2C_SETPOINT_MAX);
+    setpointReceived = true;
+    portEXIT_CRITICAL(&setpointMux);
+    return;
+  }
+
+  // legacy single-byte opcode
+  for (uint8_t i = 0; i < len; i++) receivedData[i] = buf[i];
   dataLength = len;
   dataReceived = true;
 }
 
-// controller
-int lastOutput = 0;
-float pidControl(int setpoint, int measuredValue) {
-  static float integral;
+float pidControl(WheelController &c, int setpoint, int measuredValue) {
   int error = setpoint - measuredValue;
-  integral = 0;// += error;
-  float derivative = 0; //error - previousError;
-  float output = Kp * error + Ki * integral + Kd * derivative;
+  c.integral = 0;  // += error;
+  float derivative = 0;  //error - c.previousError;
+  float output = (Kp * error + Ki * c.integral + Kd * derivative) * (CONTROL_PERIOD_US / 1000000.0f);
 
-  if (integral > LEDC_RESOLUTION) integral = LEDC_RESOLUTION;
+  if (c.integral > LEDC_RESOLUTION) c.integral = LEDC_RESOLUTION;
 
   if (output > LEDC_RESOLUTION || output < -LEDC_RESOLUTION) {
-    output = lastOutput;
+    output = c.lastOutput;
   }
 
-  previousError = error;
-  lastOutput = output;
+  c.previousError = error;
+  c.lastOutput = output;
   return output;
 }
 
 
 // encoder reading
-int encoderL;
-volatile int positionL = 0;
-volatile float changeInPositionPerSecondL = 0;
-volatile unsigned long lastTimeL = 0;
-unsigned long timeDifferenceL;
-volatile float speedL = 0;
-void updateEncoderL() {
-  encoderL = digitalRead(LEFTENCODERPINB);
-  positionL = (encoderL > 0) ? -1 : 1;
-
-  unsigned long currentTimeL = micros();
-  if (lastTimeL > 0) {
-    timeDifferenceL = currentTimeL - lastTimeL;
-    speedL = 1000000.0 / timeDifferenceL;
+static inline void IRAM_ATTR captureEdge(EncoderCapture &e, int8_t dir) {
+  uint32_t now = micros();
+  portENTER_CRITICAL_ISR(&encoderMux);
+  if (e.lastEdgeUs != 0) {
+    // a direction change invalidates the old periods
+    if (dir != e.direction) {
+      e.count = 0;
+      e.head = 0;
+    }
+    e.periods[e.head] = now - e.lastEdgeUs;
+    e.head = (e.head + 1) % EDGE_PERIOD_SAMPLES;
+    if (e.count < EDGE_PERIOD_SAMPLES) e.count++;
   }
-  changeInPositionPerSecondL = positionL * speedL;
-  lastTimeL = currentTimeL;
+  e.direction = dir;
+  e.lastEdgeUs = now;
+  portEXIT_CRITICAL_ISR(&encoderMux);
+}
+
+void IRAM_ATTR updateEncoderL() {
+  captureEdge(encL, digitalRead(LEFTENCODERPINB) ? -1 : 1);
 }
 
-int encoderR;
-volatile int positionR = 0;
-volatile float changeInPositionPerSecondR = 0;
-volatile unsigned long lastTimeR = 0;
-unsigned long timeDifferenceR;
-volatile float speedR = 0;
-void updateEncoderR() {
-  encoderR = digitalRead(RIGHTENCODERPINB);
-  positionR = (encoderR > 0) ? 1 : -1;
-
-  unsigned long currentTimeR = micros();
-  if (lastTimeR > 0) {
-    timeDifferenceR = currentTimeR - lastTimeR;
-    speedR = 1000000.0 / timeDifferenceR;
+void IRAM_ATTR updateEncoderR() {
+  captureEdge(encR, digitalRead(RIGHTENCODERPINB) ? 1 : -1);
+}
+
+// median edge period -> signed rpm, 0 when the wheel has not ticked within SPEED_TIMEOUT_US
+int estimateRpm(EncoderCapture &e) {
+  uint32_t p[EDGE_PERIOD_SAMPLES];
+  uint8_t n;
+  uint32_t lastEdge;
+  int8_t dir;
+
+  portENTER_CRITICAL(&encoderMux);
+  n = e.count;
+  for (uint8_t i = 0; i < n; i++) p[i] = e.periods[i];
+  lastEdge = e.lastEdgeUs;
+  dir = e.direction;
+  portEXIT_CRITICAL(&encoderMux);
+
+  if (n == 0 || lastEdge == 0 || (uint32_t)(micros() - lastEdge) > SPEED_TIMEOUT_US) return 0;
+
+  // insertion sort, n <= EDGE_PERIOD_SAMPLES
+  for (uint8_t i = 1; i < n; i++) {
+    uint32_t v = p[i];
+    int8_t j = i - 1;
+    while (j >= 0 && p[j] > v) {
+      p[j + 1] = p[j];
+      j--;
+    }
+    p[j + 1] = v;
   }
-  changeInPositionPerSecondR = positionR * speedR;
-  lastTimeR = currentTimeR;
+  uint32_t median = p[n / 2];
+  if (median == 0) return 0;
+
+  return dir * (int)(1000000UL / median / EDGES_PER_RPM);
 }
 
 // html getting
 void handleRoot() {
-  htmlServer.sendhtml(body);
+  htmlServer.sendgzip(body_gz, body_gz_len, body_etag);
 }
 
 // sending the keystroke to motor
@@ -128,7 +221,7 @@ enum Direction { NONE,
                  S,
                  D,
                  SPACE };
-Direction currentDirection = NONE;
+volatile Direction currentDirection = NONE;
 
 void handleHitW() {
   currentDirection = W;
@@ -156,17 +249,15 @@ void handleHitSpace() {
 }
 
 void handleLeftEncoder() {
-  String s = String(lastRpmL);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain((int)lastRpmL);
 }
 
 
 void handleRightEncoder() {
-  String s = String(lastRpmR);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain((int)lastRpmR);
 }
 
-int left = 1, right = 1;
+volatile int left = 1, right = 1;
 bool servoOn = 0;
 void keyTranslator(int speed = 90) {
   if (currentDirection == 0) {
@@ -215,53 +306,107 @@ void keyTranslator(int speed = 90) {
 }
 
 // converting to duty cycle
-int duty_left_save;
 int duty_left = 0;
-float rpmL = 0;
+int rpmL = 0;
 void leftyFunction() {
   int targetRPM = map(left, -100, 100, -99, 99);
   int measuredRPM = rpmL;
 
-  int pidOutputL = (int)pidControl(targetRPM, measuredRPM);
-  pidOutputL += duty_left_save;
+  int pidOutputL = (int)pidControl(ctrlL, targetRPM, measuredRPM);
+  pidOutputL += ctrlL.dutySave;
   duty_left = min(abs(pidOutputL), LEDC_RESOLUTION-1);
 
   if (pidOutputL >= 0) {
     ledcWrite(LEFTMOTORPINA, 0);
     ledcWrite(LEFTMOTORPINB, duty_left);
-    duty_left_save = duty_left;
+    ctrlL.dutySave = duty_left;
   } else if (pidOutputL < 0) {
     ledcWrite(LEFTMOTORPINA, duty_left);
     ledcWrite(LEFTMOTORPINB, 0);
-    duty_left_save = -duty_left;
+    ctrlL.dutySave = -duty_left;
   }
   // Serial.print("Left PID: ");
   // Serial.print(pidOutputL);
 }
 
-int duty_right_save;
 int duty_right = 0;
-float rpmR = 0;
+int rpmR = 0;
 void rightyFunction() {
   int targetRPM = map(right, -100, 100, -99, 99);
   int measuredRPM = rpmR;
 
-  int pidOutputR = (int)pidControl(targetRPM, measuredRPM);
-  pidOutputR += duty_right_save;
+  int pidOutputR = (int)pidControl(ctrlR, targetRPM, measuredRPM);
+  pidOutputR += ctrlR.dutySave;
   duty_right = min(abs(pidOutputR), LEDC_RESOLUTION-1);
 
   if (pidOutputR >= 0) {
     ledcWrite(RIGHTMOTORPINA, duty_right);
     ledcWrite(RIGHTMOTORPINB, 0);
-    duty_right_save = duty_right;
+    ctrlR.dutySave = duty_right;
   } else if (pidOutputR < 0) {
     ledcWrite(RIGHTMOTORPINA, 0);
     ledcWrite(RIGHTMOTORPINB, duty_right);
-    duty_right_save = -duty_right;
+    ctrlR.dutySave = -duty_right;
   }
   // Serial.print(" | Right PID: ");
   // Serial.println(pidOutputR);
 }
+
+// speed update with the old glitch guard: hold the last value on implausible readings
+void updateSpeeds() {
+  int rpm = estimateRpm(encL);
+  if (rpm <= RPM_GLITCH_LIMIT && rpm >= -RPM_GLITCH_LIMIT) rpmL = rpm;
+  lastRpmL = rpmL;
+
+  rpm = estimateRpm(encR);
+  if (rpm <= RPM_GLITCH_LIMIT && rpm >= -RPM_GLITCH_LIMIT) rpmR = rpm;
+  lastRpmR = rpmR;
+}
+
+// control task: woken by the hardware timer every CONTROL_PERIOD_US
+hw_timer_t *controlTimer = NULL;
+TaskHandle_t controlTaskHandle = NULL;
+
+// true while the wheels follow setpoint packets instead of keyTranslator() presets
+bool setpointMode = false;
+unsigned long lastSetpointMs = 0;
+
+void IRAM_ATTR onControlTimer() {
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(controlTaskHandle, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+void controlTask(void *arg) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    if (dataReceived) {
+      currentDirection = static_cast<Direction>(receivedData[0]);
+      dataReceived = false;  // Clear flag
+      setpointMode = false;  // an opcode hands control back to the presets
+    }
+    if (setpointReceived) {
+      portENTER_CRITICAL(&setpointMux);
+      left = pendingLeft;
+      right = pendingRight;
+      setpointReceived = false;
+      portEXIT_CRITICAL(&setpointMux);
+      setpointMode = true;
+      lastSetpointMs = millis();
+    }
+
+    // sender went quiet: stop and fall back to the presets
+    if (setpointMode && millis() - lastSetpointMs > SETPOINT_TIMEOUT_MS) {
+      setpointMode = false;
+      currentDirection = NONE;
+    }
+    if (!setpointMode) keyTranslator(60);
+    updateSpeeds();
+    leftyFunction();
+    rightyFunction();
+  }
+}
 // setup/loop
 
 unsigned long previousMillis = 0;  // Store the last time the servo moved
@@ -330,46 +475,35 @@ void setup() {
 
   servo1.setPeriodHertz(50);
   servo1.attach(SERVOPIN, 1000, 2000);
+
+  // control task on the app core at a higher priority than loop(), paced by a 1 MHz timer
+  xTaskCreatePinnedToCore(controlTask, "control", 4096, NULL, 5, &controlTaskHandle, 1);
+  controlTimer = timerBegin(1000000);
+  timerAttachInterrupt(controlTimer, &onControlTimer);
+  timerAlarm(controlTimer, CONTROL_PERIOD_US, true, 0);
 }
 
 void loop() {
   // put your main code here, to run repeatedly:
+  // motor control runs in controlTask, loop() only serves the web page, servo and logging
   htmlServer.serve();
-
-  if (dataReceived) {
-    currentDirection = static_cast<Direction>(receivedData[0]);
-    dataReceived = false;  // Clear flag
-  }
-  keyTranslator(60);
-  leftyFunction();
-  rightyFunction();
-
-  rpmL = changeInPositionPerSecondL / 12 * 60 / 60;  // thx cole
-  if (rpmL > 110 || rpmL < -110) {
-    positionL = lastPositionL;
-    rpmL = lastRpmL;
-  }
-
-  lastPositionL = positionL;
-  lastRpmL = rpmL;
-
-  rpmR = changeInPositionPerSecondR / 12 * 60 / 60;  // thx cole
-  if (rpmR > 110 || rpmR < -110) {
-    positionR = lastPositionR;
-    rpmR = lastRpmR;
-  }
-
-  lastPositionR = positionR;
-  lastRpmR = rpmR;
-  
   updateServo();
 
-  // DO NOT DELETE THESE PRINT STATEMENTS OR EVERYTHING BREAKS
-  Serial.print(left);
-  Serial.print(", ");
-  Serial.print(right);
-  Serial.print(", ");
-  Serial.print(lastRpmL);
-  Serial.print(", ");
-  Serial.println(lastRpmR);
+  static unsigned long lastPrintMs = 0;
+  if (millis() - lastPrintMs >= PRINT_PERIOD_MS) {
+    lastPrintMs = millis();
+    Serial.print(left);
+    Serial.print(", ");
+    Serial.print(right);
+    Serial.print(", ");
+    Serial.print(lastRpmL);
+    Serial.print(", ");
+    Serial.print(lastRpmR);
+    Serial.print(" | pkt ");
+    Serial.print(setpointCount);
+    Serial.print(" crc ");
+    Serial.print(setpointCrcErrors);
+    Serial.print(" drop ");
+    Serial.println(setpointDropped);
+  }
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Generated by tools/build_web_assets.py from webpage.h (4338 bytes minified, 1309 bytes gzip). Do not edit.
+#ifndef WEBPAGE_GZ_H
+#define WEBPAGE_GZ_H
+
+#include <Arduino.h>
+
+const char body_etag[] = "\"70d6f927b9937ad5\"";
+const size_t body_gz_len = 1309;
+const uint8_t body_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x58, 0xdb, 0x6e, 0xe3, 0x36,
+  0x10, 0x7d, 0xd7, 0x57, 0xb0, 0x5a, 0x74, 0xd7, 0x06, 0x2c, 0x47, 0x49, 0x36, 0x97, 0xda, 0x71,
+  0x80, 0x34, 0x49, 0xbb, 0x01, 0x1c, 0x74, 0x11, 0xbb, 0xb7, 0x47, 0x5a, 0xa4, 0x2d, 0x76, 0x25,
+  0x52, 0x25, 0x29, 0x5f, 0x5a, 0xe4, 0xb5, 0xef, 0x45, 0x7f, 0xa4, 0xfd, 0xa5, 0x7e, 0x49, 0x87,
+  0x94, 0x64, 0xc9, 0x96, 0xed, 0xd8, 0x0d, 0x0a, 0x14, 0x49, 0x6c, 0x8b, 0x9a, 0x39, 0x73, 0xc8,
+  0x99, 0x33, 0x23, 0xe7, 0xea, 0xb3, 0xbb, 0x6f, 0x6e, 0x87, 0x3f, 0x7e, 0xbc, 0x47, 0xa1, 0x8e,
+  0xa3, 0x6b, 0xe7, 0xaa, 0x78, 0xa3, 0x98, 0xc0, 0x5b, 0x4c, 0x35, 0x46, 0x41, 0x88, 0xa5, 0xa2,
+  0xba, 0xe7, 0x7e, 0x3b, 0xfc, 0xca, 0xbb, 0x74, 0x8b, 0x65, 0x8e, 0x63, 0xda, 0x73, 0xa7, 0x8c,
+  0xce, 0x12, 0x21, 0xb5, 0x8b, 0x02, 0xc1, 0x35, 0xe5, 0x60, 0x36, 0x63, 0x44, 0x87, 0x3d, 0x42,
+  0xa7, 0x2c, 0xa0, 0x9e, 0xbd, 0x68, 0x21, 0xc6, 0x99, 0x66, 0x38, 0xf2, 0x54, 0x80, 0x23, 0xda,
+  0x3b, 0x6e, 0xfb, 0x06, 0x46, 0xe9, 0x45, 0x44, 0xaf, 0x9d, 0x91, 0x20, 0x0b, 0xf4, 0xab, 0x43,
+  0x98, 0x4a, 0x22, 0xbc, 0xe8, 0xa0, 0x71, 0x44, 0xe7, 0x5d, 0xc7, 0xbc, 0x7a, 0x84, 0x49, 0x1a,
+  0x68, 0x26, 0x78, 0x07, 0xe0, 0xa3, 0x34, 0xe6, 0x5d, 0xe7, 0xa7, 0x54, 0x69, 0x36, 0x5e, 0x78,
+  0x79, 0x38, 0xb8, 0x01, 0xaf, 0x54, 0x76, 0x1d, 0x1c, 0xb1, 0x09, 0xf7, 0x98, 0xa6, 0xb1, 0x2a,
+  0x17, 0x43, 0xca, 0x26, 0x21, 0x18, 0x1d, 0xfb, 0xfe, 0x34, 0xec, 0x3a, 0x31, 0x96, 0x13, 0x06,
+  0x60, 0x7e, 0xd7, 0x19, 0xe1, 0xe0, 0xd3, 0x44, 0x8a, 0x94, 0x13, 0x80, 0x8a, 0x84, 0xec, 0xa0,
+  0x37, 0x63, 0xdf, 0xfc, 0x40, 0x68, 0x80, 0xf6, 0xc6, 0x38, 0x66, 0x11, 0xb0, 0xf9, 0x8e, 0x4a,
+  0x82, 0x39, 0x6e, 0x21, 0x85, 0xb9, 0xf2, 0x14, 0x95, 0x6c, 0xdc, 0x75, 0x9e, 0x9d, 0xb6, 0xc6,
+  0x23, 0x55, 0x67, 0xbd, 0x95, 0x9d, 0x3d, 0x07, 0xcb, 0xe3, 0x73, 0x43, 0x63, 0xee, 0xe5, 0x0b,
+  0xe7, 0xbe, 0x9f, 0xcc, 0x0b, 0x62, 0xde, 0x48, 0x68, 0x2d, 0xe2, 0x0e, 0x3a, 0xb1, 0x8b, 0x23,
+  0x21, 0x09, 0x95, 0xe5, 0x62, 0x32, 0x47, 0x4a, 0x44, 0x8c, 0xa0, 0x37, 0x84, 0x90, 0x82, 0x04,
+  0x70, 0x30, 0xa1, 0x01, 0xba, 0xeb, 0x68, 0x3a, 0xd7, 0x9e, 0x3d, 0x87, 0x32, 0x70, 0x82, 0x09,
+  0x61, 0x7c, 0x62, 0x42, 0x83, 0x7f, 0x06, 0x1c, 0xa4, 0x52, 0x99, 0x1d, 0x27, 0x82, 0x65, 0x46,
+  0x76, 0xc7, 0x8a, 0xfd, 0x42, 0xc1, 0xec, 0xd2, 0x86, 0xde, 0x7e, 0x3a, 0x19, 0xab, 0x0e, 0xe2,
+  0x82, 0xd3, 0xae, 0x23, 0x52, 0x1d, 0x31, 0x4e, 0x8b, 0x4b, 0x2d, 0xe1, 0x94, 0x58, 0x96, 0xb1,
+  0x75, 0x0c, 0xe4, 0xb7, 0x4f, 0x55, 0x0b, 0x95, 0x9f, 0x8b, 0x2d, 0xb4, 0x31, 0xe4, 0x78, 0x4a,
+  0x61, 0x27, 0x1b, 0xc2, 0xfa, 0xfe, 0xc5, 0x68, 0x0c, 0x47, 0x9e, 0x5f, 0xcf, 0x42, 0xc8, 0xf0,
+  0xae, 0xa3, 0x29, 0xec, 0x33, 0xe8, 0x22, 0x11, 0xd5, 0x4c, 0x65, 0x4c, 0xb7, 0xd5, 0xd7, 0xc6,
+  0x32, 0x7a, 0x21, 0x7b, 0xab, 0xb1, 0xca, 0xed, 0xac, 0x15, 0x07, 0x98, 0x51, 0x1e, 0x08, 0x43,
+  0x3c, 0xc2, 0x23, 0x1a, 0xed, 0x53, 0x3f, 0x2a, 0xc1, 0xa0, 0xa2, 0x11, 0xd5, 0x33, 0x4a, 0xf9,
+  0x76, 0x22, 0x67, 0x3b, 0xca, 0x68, 0x53, 0x55, 0xd4, 0x12, 0xbe, 0xce, 0xad, 0x5a, 0x56, 0x70,
+  0x4f, 0x69, 0xac, 0x59, 0x50, 0xde, 0x2a, 0xdd, 0x4f, 0x36, 0x05, 0x3e, 0xcb, 0x21, 0xc9, 0x02,
+  0xba, 0x04, 0xf8, 0x4d, 0x71, 0x94, 0xd2, 0x55, 0xbf, 0x2c, 0xec, 0x7a, 0x96, 0x9f, 0x9d, 0x51,
+  0x0a, 0x10, 0x1c, 0x6c, 0x97, 0x85, 0x6b, 0x22, 0xa0, 0x53, 0x1b, 0xa6, 0x16, 0x77, 0x45, 0xaa,
+  0x8c, 0x87, 0x20, 0x4f, 0x5d, 0xca, 0xfc, 0xb8, 0x22, 0xa3, 0x22, 0xef, 0x79, 0xe5, 0x48, 0x4c,
+  0x58, 0x0a, 0x19, 0xbe, 0xdc, 0xa8, 0x87, 0x3d, 0xca, 0xd8, 0x9a, 0x8c, 0x85, 0x8c, 0xe1, 0xfa,
+  0x58, 0x19, 0xdc, 0xb9, 0xa7, 0x42, 0x4c, 0xc4, 0x0c, 0xda, 0x0b, 0x7a, 0x0f, 0x94, 0xcf, 0xe1,
+  0x4f, 0x4e, 0x46, 0xb8, 0xe1, 0xb7, 0x50, 0xfe, 0xdb, 0x3e, 0x6e, 0x96, 0x7b, 0xec, 0x2c, 0xeb,
+  0x64, 0x89, 0x05, 0xf9, 0x36, 0x0d, 0xb2, 0xe1, 0xb7, 0xbf, 0x38, 0x6b, 0x6e, 0x54, 0xe1, 0x79,
+  0x70, 0x71, 0x76, 0x41, 0xd6, 0xe5, 0xb0, 0x84, 0x0c, 0xc5, 0x94, 0xca, 0x43, 0x84, 0x04, 0x49,
+  0xca, 0x5c, 0x6d, 0xc9, 0x61, 0x90, 0xb2, 0xfc, 0xaf, 0x7a, 0x31, 0x84, 0x92, 0x62, 0x76, 0x40,
+  0xcf, 0x34, 0x75, 0x97, 0x95, 0x7f, 0x51, 0x13, 0x79, 0xb5, 0x9f, 0xae, 0x54, 0xbb, 0x16, 0x49,
+  0x51, 0x0e, 0xcf, 0xce, 0xd5, 0x51, 0x3e, 0x55, 0xae, 0x8e, 0xf2, 0x19, 0x66, 0xc6, 0x0b, 0xbc,
+  0x11, 0x36, 0x45, 0x41, 0x84, 0x95, 0xea, 0xb9, 0xa6, 0x75, 0x9b, 0xf9, 0x93, 0xc3, 0x96, 0xab,
+  0x28, 0xcb, 0x88, 0x8b, 0x04, 0x0f, 0x22, 0x16, 0x7c, 0xea, 0xb9, 0x6a, 0xc6, 0x74, 0x10, 0x0e,
+  0xf1, 0xa8, 0xf1, 0x2e, 0xc6, 0x3c, 0xc5, 0xd1, 0xbb, 0xa6, 0x7b, 0x7d, 0x2b, 0x62, 0xb8, 0x20,
+  0x57, 0x47, 0x19, 0xc0, 0x26, 0xa4, 0xcd, 0x10, 0x38, 0x05, 0x75, 0x18, 0x21, 0x19, 0x94, 0x47,
+  0x9c, 0x54, 0x10, 0x8e, 0x80, 0x5f, 0xce, 0x92, 0x91, 0x9e, 0x9b, 0x05, 0x73, 0x2b, 0x88, 0xcb,
+  0x4e, 0x96, 0x73, 0x5c, 0xdd, 0xd2, 0x6a, 0x5f, 0xd9, 0x75, 0x73, 0xed, 0x5e, 0x55, 0xd8, 0xee,
+  0x75, 0x9f, 0x8e, 0x35, 0xba, 0xcf, 0xcc, 0xd1, 0xd3, 0xc7, 0xc7, 0x2a, 0xad, 0xdc, 0x61, 0x45,
+  0xd2, 0xae, 0x25, 0x1b, 0x81, 0x57, 0xee, 0xd4, 0xcf, 0x70, 0xfc, 0xc2, 0xb1, 0xee, 0xbf, 0x3f,
+  0x99, 0x27, 0x33, 0xba, 0x0f, 0x67, 0x23, 0x8d, 0xdb, 0x6e, 0x3a, 0x75, 0x9c, 0x75, 0x0d, 0xac,
+  0x11, 0x83, 0xba, 0xad, 0x14, 0x8c, 0x5e, 0x24, 0xb4, 0x70, 0xa9, 0x24, 0x1a, 0x04, 0xf5, 0x7d,
+  0x03, 0x12, 0x8b, 0xfe, 0xfe, 0xed, 0x77, 0xb4, 0x39, 0xb5, 0x07, 0xc2, 0xdd, 0xe4, 0x70, 0x7f,
+  0xa2, 0x7a, 0xad, 0x6d, 0xf7, 0x1a, 0xe4, 0x5e, 0x7f, 0x1c, 0xe4, 0x75, 0x97, 0x7b, 0xfd, 0x75,
+  0x08, 0xf5, 0x22, 0x6f, 0x15, 0x95, 0xba, 0xbb, 0x98, 0x19, 0x3b, 0x1b, 0x67, 0x00, 0xa2, 0xdd,
+  0x10, 0x28, 0x7f, 0x53, 0x81, 0x64, 0x89, 0xbe, 0x76, 0xc6, 0x29, 0xb7, 0x1d, 0x07, 0x95, 0x1a,
+  0x02, 0x25, 0x3c, 0x90, 0x26, 0xb4, 0x02, 0x48, 0x95, 0xd2, 0xc8, 0x3e, 0x85, 0xf5, 0x10, 0x11,
+  0x41, 0x1a, 0x9b, 0xd1, 0xfb, 0x73, 0x4a, 0xe5, 0x62, 0x40, 0x23, 0xe8, 0x54, 0x42, 0xde, 0x44,
+  0x51, 0xc3, 0x35, 0x93, 0xd9, 0x6d, 0x76, 0x73, 0xfb, 0x5c, 0x44, 0x7b, 0xf8, 0x14, 0x7a, 0x33,
+  0xbe, 0x26, 0x4a, 0x1b, 0xfa, 0xf3, 0x3d, 0x0e, 0xc2, 0x86, 0xa1, 0xd0, 0x44, 0xbd, 0x6b, 0xe0,
+  0xc0, 0xc6, 0xc8, 0x5c, 0xb5, 0x19, 0x87, 0x92, 0x19, 0xc2, 0x98, 0x6d, 0x6b, 0xd1, 0x17, 0x33,
+  0x2a, 0x6f, 0xb1, 0x82, 0x7d, 0xa2, 0x5e, 0xaf, 0x87, 0x96, 0x84, 0x8d, 0xa1, 0x3d, 0xaf, 0x3e,
+  0x53, 0xf0, 0x8c, 0x40, 0x48, 0xc3, 0xcd, 0xa5, 0x6c, 0x66, 0x02, 0x02, 0xd9, 0xd2, 0x9a, 0x95,
+  0xa4, 0x31, 0x34, 0xf4, 0x15, 0x43, 0xe7, 0x39, 0xdb, 0x8c, 0xdd, 0x46, 0x49, 0x2a, 0x5f, 0xa9,
+  0x10, 0x2b, 0x9e, 0x46, 0xe0, 0xa1, 0x68, 0x85, 0x47, 0xb1, 0xfe, 0x32, 0x97, 0xba, 0xe5, 0x36,
+  0x3e, 0xcf, 0x65, 0xaa, 0x32, 0x15, 0x80, 0xf7, 0x14, 0x4b, 0x34, 0x0f, 0xb5, 0x4e, 0xe0, 0xac,
+  0x39, 0x9d, 0xa1, 0x1f, 0x1e, 0xfb, 0x1f, 0xe0, 0xea, 0x89, 0xc2, 0x79, 0x2b, 0xdd, 0x00, 0x2f,
+  0x7b, 0xb7, 0x2d, 0x12, 0xca, 0x1b, 0xee, 0xd7, 0xf7, 0x43, 0xb7, 0x85, 0xac, 0x86, 0x5c, 0x33,
+  0x5c, 0x53, 0xba, 0x34, 0x50, 0x94, 0x93, 0x46, 0x2d, 0xc8, 0xcd, 0xab, 0x82, 0xdc, 0xec, 0x17,
+  0x64, 0xf0, 0xaa, 0x20, 0x83, 0xfd, 0x82, 0xdc, 0xbd, 0x2a, 0xc8, 0xdd, 0x9e, 0x3b, 0xc9, 0xa4,
+  0xf7, 0x9a, 0xdd, 0x18, 0x84, 0xed, 0xc1, 0xe0, 0x1b, 0xe2, 0x83, 0x19, 0xdb, 0xd0, 0x89, 0x1b,
+  0x69, 0x42, 0xb0, 0xa6, 0xfd, 0x72, 0x2c, 0xb4, 0xd0, 0xc9, 0x99, 0x0f, 0x66, 0x4b, 0x46, 0x35,
+  0x8b, 0x92, 0xda, 0x4e, 0x66, 0x96, 0x18, 0x97, 0x30, 0xd9, 0x17, 0x66, 0x58, 0x50, 0xf8, 0x6e,
+  0xca, 0x27, 0x14, 0xec, 0x97, 0xc8, 0x16, 0xc8, 0x0a, 0x33, 0x64, 0xaa, 0x6d, 0x2d, 0x07, 0xc6,
+  0x12, 0x44, 0x80, 0xde, 0xa3, 0xb7, 0x6f, 0x91, 0x5d, 0x37, 0xce, 0xa9, 0x32, 0x6b, 0x27, 0xbe,
+  0x6f, 0x3c, 0x96, 0xdd, 0x60, 0x42, 0xf5, 0x7d, 0x44, 0xcd, 0xc7, 0x2f, 0x17, 0x0f, 0xa0, 0x8b,
+  0xda, 0x70, 0x6b, 0x66, 0x72, 0xff, 0x30, 0x7c, 0xec, 0x43, 0xdc, 0x3c, 0x8a, 0x4a, 0xa0, 0xbd,
+  0x50, 0xd3, 0x02, 0xac, 0x24, 0x0a, 0xa6, 0xd5, 0x23, 0xac, 0x00, 0x55, 0x4e, 0xf1, 0xa5, 0x43,
+  0x7c, 0xaa, 0x4c, 0xb3, 0x2d, 0xa7, 0x58, 0x35, 0xf9, 0xdf, 0x1e, 0x63, 0x7d, 0x2a, 0xff, 0xdb,
+  0x73, 0xac, 0x22, 0x6d, 0x3d, 0x48, 0x78, 0x0c, 0xcc, 0x67, 0x08, 0x0c, 0x99, 0xec, 0x01, 0xf0,
+  0x28, 0xfb, 0xd7, 0xc6, 0x3f, 0xcf, 0xba, 0x95, 0x9e, 0xf2, 0x10, 0x00, 0x00,
+};
+
+#endif // WEBPAGE_GZ_H
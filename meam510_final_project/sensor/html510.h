@@ -14,37 +14,88 @@
 
 #include <WiFi.h>
 #include <WiFiClient.h>
-const char HTMLtext[] PROGMEM = R"===(HTTP/1.1 200 OK
-Content-type:text/html
-
-)==="; // note last newline is important  
-
-const char plaintext[] PROGMEM = R"===(HTTP/1.1 200 OK
-Content-type:text/plain
-
-)==="; // note last newline is important  
 
+// Request limits. Handler keys are matched with a prefix trie over the
+// request target, built once in attachHandler(); serve() never waits for bytes.
+#define MAXHANDLERS 30
+#define HTML510_LINE_MAX 192          // longer request lines are truncated
+#define HTML510_HEADER_MAX 128        // longer header lines are truncated
+#define HTML510_ETAG_MAX 48
+#define HTML510_TRIE_NODES 512        // total key characters across all handlers
+#define HTML510_REQUEST_TIMEOUT_MS 1000  // drop a client that stalls mid-request
+// HTTP/1.1 keep-alive: a browser polls over a few persistent connections
+// instead of opening one per request
+#define HTML510_MAX_CLIENTS 4
+#define HTML510_KEEPALIVE_MS 5000     // close a persistent connection idle this long
+#define HTML510_INLINE_MAX 512        // header + body up to this size go out in one write
 
 class HTML510Server
 {
 private:
-  WiFiClient client;
   WiFiServer server; 
   
-  #define MAXHANDLERS 30
+  // trie node: first-child / next-sibling lists, one character per node
+  struct TrieNode {
+    char c;
+    int8_t handler;     // index into handlerptrs, -1 = no key ends here
+    int16_t child;      // -1 = none
+    int16_t sibling;
+  };
+  TrieNode trie[HTML510_TRIE_NODES];
+  int numNodes=1;       // node 0 is the root
   int numHandler=0;
   void (*handlerptrs[MAXHANDLERS])();
-  String handlerpars[MAXHANDLERS];
+
+  // one connection; parse state is kept across serve() calls
+  struct Slot {
+    WiFiClient client;
+    bool inHeaders;     // request line done, reading headers up to the blank line
+    bool keepAlive;
+    bool responded;     // the handler sent a response
+    char line[HTML510_LINE_MAX];
+    int lineLen;
+    char header[HTML510_HEADER_MAX];
+    int headerLen;
+    char ifNoneMatch[HTML510_ETAG_MAX];
+    int argPos;         // getVal()/getText() read from here (just after the matched key)
+    unsigned long lastMs;
+  };
+  Slot slots[HTML510_MAX_CLIENTS];
+  Slot* cur=nullptr;    // slot whose handler is running
+
+  int findChild(int node, char c);
+  int match(const char* target, int len, int* keyLen);
+  void acceptClients();
+  void serviceSlot(Slot& s);
+  void resetRequest(Slot& s);
+  void parseHeader(Slot& s);
+  void dispatch(Slot& s);
+  void respond(int code, const char* type, const uint8_t* body, size_t len, const char* extra = "");
+  bool etagMatches(const char* etag);
   
 public:
   HTML510Server(int port): server(port) // default constructor
   {    
+    trie[0] = {0, -1, -1, -1};
   }
   void begin(int port=80);
-  void attachHandler(String key, void (*handler)());
+  // key is the path, e.g. "/hitW"; a trailing space is added unless the key
+  // ends in ' ' or '=' (then the value follows, read it with getVal()/getText())
+  bool attachHandler(const char* key, void (*handler)());
   void serve();
-  void sendhtml(String data) ;
-  void sendplain(String data);
+  // responses carry Content-Length so the connection can stay open; the
+  // header is formatted on the stack, no String is built
+  void send(int code, const char* type, const char* data, size_t len);
+  void sendhtml(const char* data);
+  void sendhtml(const String& data) { sendhtml(data.c_str()); }
+  void sendplain(const char* data);
+  void sendplain(const String& data) { sendplain(data.c_str()); }
+  void sendplain(int val);
+  void sendplain(long val);
+  void sendplain(double val, int decimals = 2);
+  void sendjson(const char* data);
+  // pre-gzipped asset (see tools/build_web_assets.py); answers 304 when If-None-Match matches etag
+  void sendgzip(const uint8_t* data, size_t len, const char* etag, const char* type = "text/html");
   String getText();
   int getVal();
 };
@@ -0,0 +1,52 @@
+#ifndef I2C_PACKET
+#define I2C_PACKET
+
+#include <stdint.h>
+
+// framed wheel setpoint packet sent from the sensor board to the motor board
+// [0xA5][seq][left lo][left hi][right lo][right hi][crc8]
+// left/right are signed wheel setpoints in the same -100..100 units keyTranslator() uses
+// single-byte transfers are still the legacy opcodes (0-9, 98, 99), 0xA5 never collides with them
+#define I2C_PACKET_START 0xA5
+#define I2C_PACKET_LENGTH 7
+#define I2C_SETPOINT_MAX 100
+
+struct SetpointPacket {
+  uint8_t seq;
+  int16_t left;
+  int16_t right;
+};
+
+// CRC-8, polynomial 0x07, init 0x00
+static inline uint8_t i2cCrc8(const uint8_t *data, uint8_t len) {
+  uint8_t crc = 0;
+  for (uint8_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (uint8_t b = 0; b < 8; b++) {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static inline void encodeSetpointPacket(uint8_t *buf, const SetpointPacket &p) {
+  buf[0] = I2C_PACKET_START;
+  buf[1] = p.seq;
+  buf[2] = (uint8_t)(p.left & 0xFF);
+  buf[3] = (uint8_t)((uint16_t)p.left >> 8);
+  buf[4] = (uint8_t)(p.right & 0xFF);
+  buf[5] = (uint8_t)((uint16_t)p.right >> 8);
+  buf[6] = i2cCrc8(buf, I2C_PACKET_LENGTH - 1);
+}
+
+// returns false if the buffer is not a complete, valid setpoint packet
+static inline bool decodeSetpointPacket(const uint8_t *buf, uint8_t len, SetpointPacket &p) {
+  if (len != I2C_PACKET_LENGTH || buf[0] != I2C_PACKET_START) return false;
+  if (i2cCrc8(buf, I2C_PACKET_LENGTH - 1) != buf[6]) return false;
+  p.seq = buf[1];
+  p.left = (int16_t)((uint16_t)buf[2] | ((uint16_t)buf[3] << 8));
+  p.right = (int16_t)((uint16_t)buf[4] | ((uint16_t)buf[5] << 8));
+  return true;
+}
+
+#endif
@@ -1,8 +1,9 @@
 #include "vive510.h"
 #include "vivelib.h"
 #include "Wire.h"
-#include "webpage.h"
+#include "webpage.gz.h"  // generated from webpage.h by tools/build_web_assets.py
 #include "html510.h"
+#include "i2c_packet.h"
 #include <vl53l4cx_class.h>
 
 #define I2CFREQ 40000
@@ -22,6 +23,17 @@
 #define SLAVEADDRESS 0x50
 #define TOPHATADDRESS 0x28
 
+// wall following: proportional wheel setpoints sent at a fixed rate
+#define WF_SEND_PERIOD_MS 20
+#define WF_BASE_SPEED 60
+#define WF_OFFSET 40       // front-left reads this much more than back-left when parallel
+#define WF_MIN_DISTANCE 90  // closer than this to the wall, steer away
+#define WF_KP 0.3
+#define WF_KP_CLOSE 0.5
+#define WF_MAX_STEER 45
+
+#define TOF_MIN_CONF 40  // ranges scoring below this (see tofConfidence) are not used
+
 #define VIVEPIN1 18  // front
 #define VIVEPIN2 19  // back
 
@@ -63,6 +75,28 @@ void send_I2C_byte(int data) {
   }
 }
 
+uint8_t setpointSeq = 0;
+
+void send_I2C_setpoint(int left, int right) {
+  SetpointPacket p;
+  p.seq = setpointSeq++;
+  p.left = constrain(left, -I2C_SETPOINT_MAX, I2C_SETPOINT_MAX);
+  p.right = constrain(right, -I2C_SETPOINT_MAX, I2C_SETPOINT_MAX);
+
+  uint8_t buf[I2C_PACKET_LENGTH];
+  encodeSetpointPacket(buf, p);
+
+  Wire.beginTransmission(SLAVEADDRESS);
+  Wire.write(buf, I2C_PACKET_LENGTH);
+  uint8_t error = Wire.endTransmission();
+
+  if (error == 0) {
+    rgbLedWrite(2, 0, 20, 0);  // green
+  } else {
+    rgbLedWrite(2, 20, 0, 0);  // red
+  }
+}
+
 void send_I2C_byte_tophat(uint8_t data) {
   // Send data to slave
   Wire.beginTransmission(TOPHATADDRESS);
@@ -106,37 +140,40 @@ uint8_t topHatSubroutine() {
 int buttonState = 0;
 
 void handleRoot() {
-  htmlServer.sendhtml(body);
+  htmlServer.sendgzip(body_gz, body_gz_len, body_etag);
 }
 
 void handleFrontLeftToF() {
-  String s = String(distance1);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain(distance1);
 }
 
 void handleFrontRightToF() {
-  String s = String(distance2);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain(distance2);
 }
 
 void handleBackLeftToF() {
-  String s = String(distance3);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain(distance3);
 }
 
 void handleViveX() {
-  String s = String(viveX);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain(viveX);
 }
 
 void handleViveY() {
-  String s = String(viveY);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain(viveY);
 }
 
 void handleViveTheta() {
-  String s = String(angle);
-  htmlServer.sendplain(s);
+  htmlServer.sendplain(angle);
+}
+
+// everything the page shows, in one response (replaces six 100 ms polls)
+void handleState() {
+  char json[160];
+  const char* mode = wallFollowing ? "wall" : autoNavigationRed ? "red" : autoNavigationBlue ? "blue" : "manual";
+  snprintf(json, sizeof(json), "{\"x\":%.2f,\"y\":%.2f,\"theta\":%.2f,\"tof\":[%d,%d,%d],\"mode\":\"%s\"}",
+           viveX, viveY, angle, distance1, distance2, distance3, mode);
+  htmlServer.sendjson(json);
 }
 
 int buttonStates[] = { 40, 50, 60, 70 };  // random numbers, disregard
@@ -243,34 +280,61 @@ void handleServoOff() {
   Serial.println("SERVO OFF");
 }
 
-void wallFollow(int tofFL, int tofBL, int tofFR, bool hardcode = 0, int tolerance = 40.0) {
-  if (abs(tofFL - tofBL - 40) < tolerance) {
-    // Serial.println("wf:forward");
-    // send_I2C_byte(3);
-    // delay(1);
-    send_I2C_byte(1);
-    delay(5);
-  } else if (tofFL > tofBL + 40) {
-    // Serial.println("wf:turn left");
-    // send_I2C_byte(3);
-    // delay(1);
-    send_I2C_byte(6);
-    delay(0.1);
-  } else if (tofBL + 40 > tofFL) {
-    if (tofFL < 90) {
-      // Serial.println("wf:turn right");
-      // send_I2C_byte(3);
-      // delay(1);
-      send_I2C_byte(5);
-      delay(0.1);
-    } else {
-      // Serial.println("wf:turn right");
-      // send_I2C_byte(3);
-      // delay(1);
-      send_I2C_byte(7);
-      delay(0.1);
+// steer on the left wall: the heading error is how far front-left and back-left are from
+// reading WF_OFFSET apart, plus a push away from the wall when front-left gets too close
+unsigned long lastWallFollowSendMs = 0;
+
+// Same score as tofConfidence() on owner-4: the range status gives the base
+// (0 -> 100, 6/11 wrap-around/merged pulse -> 70), which drops as the ambient
+// rate approaches the return signal rate (ambient = 2 x signal -> half)
+uint8_t tofConfidence(uint8_t status, uint32_t signalRate, uint32_t ambientRate) {
+  uint32_t base;
+  switch (status) {
+    case 0: base = 100; break;
+    case 6:
+    case 11: base = 70; break;
+    default: return 0;
+  }
+  uint64_t den = (uint64_t)signalRate + ambientRate / 2;
+  if (den == 0) return 0;
+  return (uint8_t)(base * signalRate / den);
+}
+
+// Same pick as tofReadOne() on owner-4: targets are reported nearest first, so take the
+// nearest one with confidence >= TOF_MIN_CONF (a weak near echo is skipped); when none
+// qualifies, or no new data is ready, distance keeps its last value
+void readTof(VL53L4CX &tof, int &distance) {
+  uint8_t newDataReady = 0;
+  int status = tof.VL53L4CX_GetMeasurementDataReady(&newDataReady);
+  if ((!status) && (newDataReady != 0)) {
+    VL53L4CX_MultiRangingData_t multiRangingData;
+    status = tof.VL53L4CX_GetMultiRangingData(&multiRangingData);
+    uint8_t found = status == 0 ? multiRangingData.NumberOfObjectsFound : 0;
+    constexpr uint8_t maxTargets = sizeof(multiRangingData.RangeData) / sizeof(multiRangingData.RangeData[0]);
+    for (uint8_t k = 0; k < found && k < maxTargets; k++) {
+      const VL53L4CX_TargetRangeData_t &t = multiRangingData.RangeData[k];
+      if (tofConfidence(t.RangeStatus, t.SignalRateRtnMegaCps, t.AmbientRateRtnMegaCps) >= TOF_MIN_CONF) {
+        distance = t.RangeMilliMeter;
+        break;
+      }
     }
   }
+  if (status == 0) {
+    tof.VL53L4CX_ClearInterruptAndStartMeasurement();
+  }
+}
+
+void wallFollow(int tofFL, int tofBL, int tofFR) {
+  if (millis() - lastWallFollowSendMs < WF_SEND_PERIOD_MS) return;
+  lastWallFollowSendMs = millis();
+
+  float steer = WF_KP * (tofFL - tofBL - WF_OFFSET);  // > 0: turn left
+  if (tofFL < WF_MIN_DISTANCE) {
+    steer -= WF_KP_CLOSE * (WF_MIN_DISTANCE - tofFL);
+  }
+  steer = constrain(steer, -WF_MAX_STEER, WF_MAX_STEER);
+
+  send_I2C_setpoint((int)(WF_BASE_SPEED - steer), (int)(WF_BASE_SPEED + steer));
 }
 
 bool gotoPoint(float xDesired, float yDesired) {
@@ -320,6 +384,7 @@ void setup() {
   htmlServer.attachHandler("/frontLeftTof", handleFrontLeftToF);
   htmlServer.attachHandler("/frontRightTof", handleFrontRightToF);
   htmlServer.attachHandler("/backLeftTof", handleBackLeftToF);
+  htmlServer.attachHandler("/state", handleState);
   htmlServer.attachHandler("/setServoOn", handleServoOn);
   htmlServer.attachHandler("/setServoOff", handleServoOff);
 
@@ -390,69 +455,9 @@ void loop() {
     angle -= 360.0;
   }
 
-  VL53L4CX_MultiRangingData_t MultiRangingData1, MultiRangingData2, MultiRangingData3;
-  VL53L4CX_MultiRangingData_t *pMultiRangingData1 = &MultiRangingData1;
-  VL53L4CX_MultiRangingData_t *pMultiRangingData2 = &MultiRangingData2;
-  VL53L4CX_MultiRangingData_t *pMultiRangingData3 = &MultiRangingData3;
-
-  int status1, status2, status3;
-  uint8_t NewDataReady1 = 0, NewDataReady2 = 0, NewDataReady3 = 0;
-  int no_of_object_found1 = 0, no_of_object_found2 = 0, no_of_object_found3 = 0;
-  int objStatus1, objStatus2, objStatus3;
-  float noise1, noise2, noise3;
-
-  status1 = tof1.VL53L4CX_GetMeasurementDataReady(&NewDataReady1);
-  if ((!status1) && (NewDataReady1 != 0)) {
-    status1 = tof1.VL53L4CX_GetMultiRangingData(pMultiRangingData1);
-    no_of_object_found1 = pMultiRangingData1->NumberOfObjectsFound;
-
-    for (int i = 0; i < no_of_object_found1; i++) {
-      objStatus1 = pMultiRangingData1->RangeData[i].RangeStatus;
-      if (objStatus1 == 0) {
-        distance1 = pMultiRangingData1->RangeData[i].RangeMilliMeter;
-        noise1 = (float)pMultiRangingData1->RangeData[i].AmbientRateRtnMegaCps / 65536.0;
-      }
-    }
-  }
-  if (status1 == 0) {
-    status1 = tof1.VL53L4CX_ClearInterruptAndStartMeasurement();
-  }
-
-  // Read data from TOF2
-  status2 = tof2.VL53L4CX_GetMeasurementDataReady(&NewDataReady2);
-  if ((!status2) && (NewDataReady2 != 0)) {
-    status2 = tof2.VL53L4CX_GetMultiRangingData(pMultiRangingData2);
-    no_of_object_found2 = pMultiRangingData2->NumberOfObjectsFound;
-
-    for (int i = 0; i < no_of_object_found2; i++) {
-      objStatus2 = pMultiRangingData2->RangeData[i].RangeStatus;
-      if (objStatus2 == 0) {
-        distance2 = pMultiRangingData2->RangeData[i].RangeMilliMeter;
-        noise2 = (float)pMultiRangingData2->RangeData[i].AmbientRateRtnMegaCps / 65536.0;
-      }
-    }
-  }
-  if (status2 == 0) {
-    status2 = tof2.VL53L4CX_ClearInterruptAndStartMeasurement();
-  }
-
-  // Read data from TOF3
-  status3 = tof3.VL53L4CX_GetMeasurementDataReady(&NewDataReady3);
-  if ((!status3) && (NewDataReady3 != 0)) {
-    status3 = tof3.VL53L4CX_GetMultiRangingData(pMultiRangingData3);
-    no_of_object_found3 = pMultiRangingData3->NumberOfObjectsFound;
-
-    for (int i = 0; i < no_of_object_found3; i++) {
-      objStatus3 = pMultiRangingData3->RangeData[i].RangeStatus;
-      if (objStatus3 == 0) {
-        distance3 = pMultiRangingData3->RangeData[i].RangeMilliMeter;
-        noise3 = (float)pMultiRangingData3->RangeData[i].AmbientRateRtnMegaCps / 65536.0;
-      }
-    }
-  }
-  if (status3 == 0) {
-    status3 = tof3.VL53L4CX_ClearInterruptAndStartMeasurement();
-  }
+  readTof(tof1, distance1);
+  readTof(tof2, distance2);
+  readTof(tof3, distance3);
 
   if (autoNavigationRed) {
     Serial.println("autored");
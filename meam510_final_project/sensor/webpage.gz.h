@@ -0,0 +1,141 @@
+// Generated by tools/build_web_assets.py from webpage.h (8302 bytes minified, 2055 bytes gzip). Do not edit.
+#ifndef WEBPAGE_GZ_H
+#define WEBPAGE_GZ_H
+
+#include <Arduino.h>
+
+const char body_etag[] = "\"6c6876f6088ff828\"";
+const size_t body_gz_len = 2055;
+const uint8_t body_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5a, 0xeb, 0x73, 0xda, 0x48,
+  0x12, 0xff, 0xce, 0x5f, 0x31, 0xab, 0xd4, 0x6e, 0xa0, 0xca, 0x80, 0x8c, 0x83, 0x63, 0x83, 0xf1,
+  0x9d, 0x1d, 0xc7, 0x97, 0x5c, 0x39, 0x9b, 0x2d, 0xc3, 0xde, 0x26, 0x75, 0xb5, 0x1f, 0x06, 0x69,
+  0x84, 0xe6, 0x22, 0x69, 0x38, 0xcd, 0x88, 0xc7, 0x5d, 0xe5, 0x7f, 0xdf, 0xee, 0xd1, 0x03, 0xbd,
+  0xc0, 0x22, 0x4e, 0x42, 0x6c, 0xd0, 0xd0, 0xdd, 0xbf, 0x7e, 0x4d, 0x77, 0xcf, 0x24, 0x57, 0x3f,
+  0xdd, 0x7d, 0x7c, 0x33, 0xfb, 0xfc, 0xdb, 0x5b, 0xe2, 0x2a, 0xdf, 0xbb, 0x6e, 0x5d, 0xa5, 0x6f,
+  0x8c, 0xda, 0xf0, 0xe6, 0x33, 0x45, 0x89, 0xe5, 0xd2, 0x50, 0x32, 0x35, 0x31, 0x7e, 0x9f, 0xdd,
+  0x77, 0x2f, 0x8c, 0x74, 0x39, 0xa0, 0x3e, 0x9b, 0x18, 0x2b, 0xce, 0xd6, 0x4b, 0x11, 0x2a, 0x83,
+  0x58, 0x22, 0x50, 0x2c, 0x00, 0xb2, 0x35, 0xb7, 0x95, 0x3b, 0xb1, 0xd9, 0x8a, 0x5b, 0xac, 0xab,
+  0x1f, 0x4e, 0x08, 0x0f, 0xb8, 0xe2, 0xd4, 0xeb, 0x4a, 0x8b, 0x7a, 0x6c, 0x72, 0xda, 0x33, 0x4f,
+  0x88, 0x4f, 0x37, 0xdc, 0x8f, 0xfc, 0xfc, 0x52, 0x24, 0x59, 0xa8, 0x9f, 0xe9, 0x1c, 0x96, 0x02,
+  0x81, 0x58, 0x1e, 0x0f, 0xbe, 0x10, 0x37, 0x64, 0xce, 0xc4, 0x70, 0x95, 0x5a, 0xca, 0x51, 0xbf,
+  0xef, 0x00, 0x92, 0xec, 0x2d, 0x84, 0x58, 0x78, 0x8c, 0x2e, 0xb9, 0xec, 0x59, 0xc2, 0xef, 0x5b,
+  0x52, 0x0e, 0xfe, 0xe6, 0x50, 0x9f, 0x7b, 0xdb, 0xc9, 0xa3, 0x98, 0x0b, 0x25, 0x46, 0xeb, 0x85,
+  0xab, 0xfe, 0xfe, 0xca, 0x34, 0xc7, 0x43, 0xf8, 0x79, 0x6d, 0x9a, 0xbf, 0xd8, 0x5c, 0x2e, 0x3d,
+  0xba, 0x9d, 0xc8, 0x35, 0x5d, 0x1a, 0x24, 0x64, 0xde, 0xc4, 0x90, 0x6a, 0xeb, 0x31, 0xe9, 0x32,
+  0xa6, 0x10, 0x4c, 0x3f, 0x5d, 0xb7, 0xe6, 0xc2, 0xde, 0x92, 0xff, 0xb7, 0x12, 0xf2, 0x11, 0x71,
+  0x3c, 0xb6, 0x19, 0xb7, 0xf0, 0x77, 0xd7, 0xe6, 0x21, 0xb3, 0x14, 0x17, 0xc1, 0x08, 0x0c, 0xf6,
+  0x22, 0x3f, 0x18, 0xb7, 0xfe, 0x13, 0x49, 0xc5, 0x9d, 0x6d, 0x37, 0x71, 0x40, 0x4c, 0xde, 0x95,
+  0x8a, 0x86, 0x6a, 0xdc, 0xa2, 0x1e, 0x5f, 0x04, 0x5d, 0xae, 0x98, 0x2f, 0x81, 0x03, 0xbe, 0x66,
+  0xe1, 0xb8, 0xe5, 0x32, 0x0e, 0xaa, 0x8d, 0xc8, 0xa9, 0x69, 0xfe, 0x3c, 0x6e, 0xf9, 0x34, 0x5c,
+  0x70, 0x90, 0x67, 0x02, 0x04, 0x88, 0xe8, 0xc6, 0x46, 0x8c, 0xc8, 0xcb, 0xd8, 0x8c, 0x97, 0x27,
+  0x44, 0xd2, 0x40, 0x76, 0xc1, 0x37, 0xdc, 0x19, 0xb7, 0xc4, 0x8a, 0x85, 0x8e, 0x27, 0xd6, 0x23,
+  0xe2, 0x72, 0xdb, 0x66, 0x80, 0xff, 0xb5, 0xd5, 0x53, 0x74, 0x2e, 0xab, 0x0a, 0x57, 0x14, 0x4b,
+  0xf1, 0x75, 0x50, 0x8a, 0xf0, 0x5d, 0x80, 0x52, 0xc2, 0xc7, 0xc5, 0x25, 0xb0, 0xce, 0x45, 0x68,
+  0x43, 0x2c, 0xd2, 0xc5, 0x57, 0xcb, 0x0d, 0x91, 0xc2, 0xe3, 0x36, 0x79, 0x61, 0xdb, 0x76, 0x0a,
+  0x09, 0x88, 0x08, 0x04, 0x3c, 0xe3, 0x96, 0x62, 0x1b, 0xd5, 0xd5, 0xc6, 0xee, 0x60, 0x96, 0xd4,
+  0xb6, 0x79, 0xb0, 0x88, 0x65, 0xa2, 0x79, 0x56, 0x14, 0x4a, 0x11, 0x8e, 0xc8, 0x52, 0xf0, 0x98,
+  0x42, 0xdb, 0x2b, 0xf9, 0xff, 0x18, 0xd0, 0xbc, 0xd2, 0xb8, 0xd4, 0xfa, 0xb2, 0x08, 0x45, 0x14,
+  0xd8, 0xa0, 0xb5, 0x87, 0xb4, 0x2f, 0x1c, 0x13, 0x5f, 0xa9, 0x4a, 0x23, 0x12, 0x88, 0x80, 0x81,
+  0x1b, 0x22, 0x05, 0x99, 0xc1, 0xd2, 0x47, 0x15, 0x82, 0x8b, 0x78, 0x1c, 0x97, 0xb2, 0x0c, 0x62,
+  0xf6, 0xce, 0xe4, 0x09, 0xd9, 0x7d, 0x4e, 0xf5, 0x1f, 0xb9, 0xe8, 0x4c, 0xb0, 0xa2, 0x0e, 0xf5,
+  0x14, 0x5f, 0xa0, 0x72, 0xf2, 0x6c, 0x9a, 0xaf, 0xe7, 0x8e, 0x93, 0x72, 0xf6, 0x28, 0xe4, 0xc0,
+  0x8a, 0xd5, 0xb3, 0x9a, 0xe6, 0xf0, 0x7c, 0x7e, 0x96, 0xb1, 0xae, 0x5d, 0x88, 0xfe, 0x21, 0x8f,
+  0xa6, 0xf4, 0x73, 0x01, 0x59, 0xe3, 0x52, 0x1b, 0x63, 0x8b, 0x0e, 0x43, 0x92, 0x0b, 0xf8, 0x09,
+  0x17, 0x73, 0xda, 0x86, 0xdd, 0x91, 0xfc, 0xed, 0x9d, 0x76, 0x52, 0x35, 0xd2, 0xc8, 0xe6, 0x43,
+  0x1f, 0xfb, 0x63, 0x5f, 0xae, 0xd6, 0xa6, 0x63, 0x29, 0x1d, 0x36, 0xdd, 0x64, 0xe1, 0xdc, 0x34,
+  0xf7, 0xc5, 0x44, 0xff, 0xc9, 0x8c, 0x0a, 0xa9, 0xcd, 0x23, 0x99, 0xe6, 0x4e, 0x21, 0xec, 0xc7,
+  0x99, 0x95, 0xe4, 0xa2, 0x12, 0xcb, 0x11, 0x19, 0x68, 0xee, 0xa2, 0xa1, 0x3b, 0xbf, 0x97, 0x52,
+  0x1d, 0xc9, 0xc4, 0x02, 0xea, 0x41, 0x77, 0x1e, 0x81, 0x83, 0x83, 0x63, 0x76, 0x43, 0xed, 0x06,
+  0xd0, 0x0e, 0x5c, 0x87, 0x14, 0x14, 0xc1, 0xdf, 0x55, 0x04, 0x00, 0xc8, 0x0c, 0x45, 0x73, 0x4e,
+  0xcf, 0x91, 0x2d, 0xdd, 0xcb, 0x43, 0x2d, 0xa3, 0x92, 0xdd, 0x85, 0x14, 0x2e, 0x39, 0x4f, 0xb3,
+  0x54, 0x76, 0xc8, 0x81, 0x0d, 0xf1, 0x0d, 0x39, 0x9f, 0x37, 0xe0, 0x50, 0xf6, 0xdb, 0x16, 0xbe,
+  0xaa, 0x3c, 0x4f, 0xe4, 0x7d, 0xbc, 0x45, 0xca, 0x79, 0x7f, 0x4c, 0x56, 0xbb, 0x03, 0x2c, 0x2a,
+  0x3b, 0xbf, 0x0d, 0xb4, 0xdf, 0x52, 0x84, 0xb3, 0xb3, 0xb3, 0x3d, 0xe1, 0xaa, 0x2b, 0x3f, 0xa0,
+  0x3c, 0x34, 0x12, 0xe6, 0xc9, 0x3d, 0xa5, 0x3c, 0x1f, 0xdd, 0x4a, 0x72, 0xc8, 0x25, 0x85, 0xee,
+  0x45, 0xb5, 0x85, 0x4d, 0x0a, 0x66, 0x0a, 0xd6, 0xbc, 0x6d, 0xd4, 0x6e, 0xc5, 0xac, 0x9e, 0x96,
+  0x36, 0x51, 0x21, 0xaf, 0xea, 0x72, 0xe2, 0x12, 0x5f, 0xf5, 0x39, 0x55, 0x8e, 0xc0, 0x20, 0x89,
+  0xc2, 0x9e, 0xba, 0x02, 0x8d, 0x4b, 0x71, 0xab, 0x9b, 0x5a, 0x53, 0x49, 0xe2, 0x14, 0x72, 0x38,
+  0x1c, 0x56, 0x7c, 0x31, 0x4c, 0x5c, 0x61, 0x6f, 0x61, 0x3a, 0x00, 0x21, 0x2b, 0xea, 0x45, 0xac,
+  0x24, 0xe4, 0x3c, 0xdb, 0x1a, 0xeb, 0xa4, 0x0d, 0xce, 0x85, 0x67, 0x97, 0x82, 0x0c, 0x32, 0xe2,
+  0x8c, 0xd3, 0x11, 0xa1, 0x50, 0xe9, 0xc3, 0x67, 0x34, 0xe4, 0xd4, 0xbb, 0x4f, 0x57, 0x3f, 0xc0,
+  0x0d, 0xc5, 0xfa, 0xe8, 0xe2, 0xa1, 0x2d, 0xc7, 0x0e, 0x57, 0x16, 0x16, 0xa7, 0x51, 0xb5, 0x62,
+  0x60, 0x71, 0x83, 0xfa, 0x5a, 0xae, 0x12, 0x17, 0xf5, 0xe1, 0x5d, 0x84, 0x6c, 0xbb, 0xa7, 0x9f,
+  0x64, 0xa5, 0x77, 0x90, 0xb8, 0x3e, 0x8f, 0x78, 0x68, 0x8b, 0x5b, 0x96, 0x09, 0x7f, 0xaa, 0x2c,
+  0x87, 0x76, 0xf8, 0xe5, 0x65, 0xc6, 0x83, 0x5e, 0xda, 0x63, 0xd6, 0x59, 0xbd, 0x59, 0xc5, 0x14,
+  0x3e, 0x54, 0x09, 0x2f, 0x6a, 0x2b, 0x61, 0x83, 0x72, 0xa7, 0x49, 0x1c, 0x11, 0xfa, 0x98, 0xcd,
+  0xb2, 0x94, 0xf9, 0x3a, 0xe7, 0xcf, 0xf7, 0xe7, 0xfd, 0xce, 0xa2, 0x43, 0x6e, 0xab, 0x2f, 0x72,
+  0x45, 0xf6, 0xcc, 0x85, 0x99, 0x3e, 0x50, 0x4f, 0x70, 0xca, 0x6d, 0x9b, 0xbd, 0xcb, 0x61, 0xa7,
+  0x76, 0x03, 0x9f, 0x5b, 0xaf, 0x87, 0xaf, 0xf5, 0x64, 0x75, 0xd5, 0x4f, 0xa6, 0xd0, 0xab, 0x7e,
+  0x32, 0x85, 0xe3, 0x38, 0x0a, 0x6f, 0x36, 0x5f, 0x11, 0xcb, 0xa3, 0x52, 0x4e, 0x0c, 0x9c, 0xf7,
+  0x70, 0x5e, 0x4d, 0x22, 0xb0, 0x5b, 0x25, 0x31, 0xb6, 0x41, 0x44, 0x60, 0x79, 0xdc, 0xfa, 0x02,
+  0x03, 0xee, 0x9a, 0x2b, 0xcb, 0x9d, 0xd1, 0x79, 0xfb, 0x25, 0x8d, 0x60, 0x93, 0xe2, 0xe6, 0x7e,
+  0xd9, 0x31, 0xae, 0xdf, 0x08, 0xdf, 0xa7, 0x81, 0x7d, 0xd5, 0x8f, 0x65, 0xd4, 0x09, 0xab, 0x97,
+  0x02, 0x5c, 0x11, 0xf5, 0x50, 0xc4, 0x1d, 0x55, 0x34, 0xc7, 0xdf, 0x07, 0x05, 0x13, 0x35, 0xb9,
+  0x3d, 0x31, 0x62, 0x3a, 0x23, 0x27, 0x2f, 0xdd, 0x3d, 0xa8, 0xb9, 0x3b, 0xb8, 0x9e, 0x71, 0x9f,
+  0x11, 0xe1, 0x90, 0x7b, 0x0f, 0xcb, 0x00, 0x99, 0xb2, 0x00, 0x02, 0x2e, 0xc1, 0xea, 0x41, 0xd1,
+  0xd8, 0xb8, 0x88, 0x1b, 0x35, 0x8b, 0xa5, 0xb5, 0x7c, 0xe5, 0x32, 0xae, 0xef, 0x43, 0x40, 0x23,
+  0x0f, 0xcc, 0x51, 0x79, 0xcd, 0x12, 0xd2, 0x42, 0x81, 0x32, 0xb4, 0xbe, 0x0e, 0xd2, 0x23, 0xf9,
+  0x4c, 0x38, 0x0f, 0xb1, 0x08, 0x33, 0xe5, 0xac, 0x0a, 0x68, 0x8a, 0xff, 0x88, 0xb6, 0x1d, 0xa1,
+  0x80, 0xa6, 0xdf, 0xaf, 0xc1, 0x1e, 0x45, 0x8e, 0xf7, 0xce, 0x2d, 0xa4, 0xe0, 0x11, 0xce, 0xc1,
+  0x8c, 0xfd, 0x8e, 0xbe, 0xd1, 0xe8, 0xcd, 0x5c, 0x73, 0x4d, 0x3e, 0xd5, 0xfb, 0x00, 0xd2, 0xe4,
+  0x5f, 0xb8, 0xcd, 0x7e, 0x13, 0x71, 0x55, 0x20, 0x71, 0x3a, 0x7e, 0xa7, 0xec, 0xf9, 0xd4, 0xcc,
+  0x2f, 0x2b, 0xd0, 0xe0, 0xd3, 0xf7, 0xf0, 0xc8, 0xe7, 0xe6, 0x78, 0x9f, 0x7f, 0x74, 0x6e, 0xbc,
+  0x83, 0xb2, 0x03, 0xe5, 0xbc, 0xb9, 0x46, 0x33, 0x97, 0x29, 0x7a, 0x58, 0xab, 0x52, 0x71, 0xc8,
+  0x4a, 0x51, 0x5d, 0x7d, 0x48, 0x8b, 0x58, 0xa9, 0xe6, 0x15, 0xe6, 0xfb, 0x5c, 0xf5, 0xdb, 0x15,
+  0x9b, 0x0f, 0xc2, 0x66, 0x46, 0x2d, 0x7d, 0x4d, 0x5d, 0x64, 0xea, 0x43, 0xc6, 0xd4, 0x86, 0x6a,
+  0x16, 0x3f, 0x55, 0xeb, 0x21, 0x8a, 0x5f, 0x53, 0xcf, 0xbb, 0x17, 0x1e, 0x1c, 0xbb, 0xf7, 0x43,
+  0x14, 0x65, 0xff, 0x51, 0xe0, 0x40, 0xf9, 0xb8, 0x42, 0xe2, 0xa5, 0x7a, 0x10, 0xf4, 0xc9, 0xaf,
+  0x74, 0xf5, 0xc8, 0xec, 0x26, 0x00, 0x37, 0x19, 0x35, 0x0a, 0xc7, 0x27, 0xf8, 0x78, 0x50, 0xf0,
+  0xad, 0x8e, 0x59, 0x63, 0xc9, 0x48, 0x9e, 0x8a, 0xc6, 0xcf, 0xf5, 0x95, 0x3e, 0x11, 0x57, 0x1e,
+  0xd6, 0x4a, 0xb1, 0x83, 0xe6, 0x98, 0x0b, 0x98, 0xda, 0x2e, 0x59, 0xca, 0x92, 0x83, 0x86, 0x56,
+  0xfa, 0x07, 0x02, 0xfe, 0xf2, 0xe2, 0x62, 0x78, 0x79, 0x36, 0x3e, 0x88, 0xd7, 0x54, 0xe0, 0x4d,
+  0x2c, 0x70, 0x33, 0x38, 0xbd, 0x35, 0xc7, 0x55, 0xef, 0xec, 0x67, 0x9c, 0x66, 0x9a, 0x0c, 0x8f,
+  0xe2, 0xbb, 0xdb, 0x01, 0x9e, 0x1e, 0x63, 0x42, 0xba, 0x11, 0x73, 0xa3, 0x98, 0x71, 0x48, 0x3d,
+  0xa4, 0x43, 0xa8, 0x29, 0x9c, 0x95, 0x9f, 0xef, 0x29, 0x88, 0xfa, 0x94, 0x85, 0x2b, 0xf1, 0x31,
+  0xd0, 0x32, 0xf1, 0x23, 0xf9, 0x18, 0x34, 0xb6, 0x3b, 0x63, 0x77, 0x9c, 0x1c, 0xbf, 0xe3, 0x54,
+  0x15, 0x2b, 0xbe, 0x49, 0x2b, 0xe4, 0x4b, 0x75, 0xdd, 0x72, 0xa2, 0x40, 0x8f, 0xf0, 0x64, 0x37,
+  0x66, 0x40, 0x39, 0x78, 0x6f, 0x77, 0x60, 0x86, 0x82, 0x94, 0x92, 0x8a, 0xe8, 0x0b, 0xae, 0x09,
+  0xb1, 0x85, 0x15, 0xf9, 0x78, 0x0f, 0xf0, 0xdf, 0x88, 0x85, 0xdb, 0x29, 0xf3, 0x60, 0xf4, 0x17,
+  0xe1, 0x8d, 0xe7, 0xb5, 0x0d, 0xbc, 0x26, 0x30, 0x3a, 0xe3, 0x84, 0x3e, 0xa9, 0x24, 0x0d, 0x78,
+  0xb2, 0xa1, 0x04, 0x78, 0x11, 0xa5, 0x07, 0xf3, 0xda, 0x5b, 0x6a, 0xb9, 0x6d, 0x54, 0xa1, 0x43,
+  0x26, 0xd7, 0xa0, 0x03, 0x77, 0x08, 0x3e, 0xf5, 0x78, 0x00, 0xa9, 0x3d, 0x83, 0xa3, 0x26, 0x9c,
+  0x8a, 0x1f, 0xc4, 0x9a, 0x85, 0x6f, 0xa8, 0x84, 0x28, 0x90, 0xc9, 0x64, 0x42, 0x32, 0x85, 0x91,
+  0x50, 0xfb, 0xfe, 0x81, 0x4b, 0xd5, 0x83, 0xc9, 0xb8, 0x6d, 0x24, 0xc5, 0x07, 0xe7, 0x4c, 0x02,
+  0x05, 0x99, 0x55, 0xa8, 0x42, 0xe6, 0xc3, 0xc8, 0x59, 0x20, 0x6c, 0x7d, 0x8d, 0x8d, 0xd1, 0x66,
+  0xec, 0x94, 0x4a, 0x56, 0x72, 0x8a, 0xa5, 0x57, 0x23, 0xdc, 0x2e, 0xea, 0x91, 0xae, 0x3f, 0xad,
+  0x4b, 0x95, 0x72, 0x9f, 0x3e, 0x5f, 0x77, 0xa1, 0xb2, 0x3c, 0x46, 0xc3, 0x1b, 0xfd, 0xfd, 0xad,
+  0x0e, 0x72, 0x7b, 0x17, 0xad, 0xf4, 0x0e, 0xe6, 0x09, 0xe7, 0x17, 0x4a, 0x10, 0x8e, 0xc5, 0x31,
+  0xdb, 0xce, 0xd8, 0x78, 0x21, 0xb1, 0x35, 0xb9, 0x81, 0x38, 0xa0, 0x24, 0xe9, 0xf7, 0xc9, 0xa3,
+  0x5e, 0x4c, 0xca, 0x7d, 0xbc, 0x07, 0x08, 0x0c, 0x56, 0x3e, 0xc1, 0xea, 0x1b, 0x23, 0xa6, 0xea,
+  0x95, 0x2d, 0x2a, 0x75, 0x04, 0xb4, 0xa6, 0x6a, 0xe3, 0xb8, 0x95, 0x99, 0xb4, 0x60, 0xea, 0xad,
+  0xc7, 0xf0, 0xe3, 0xed, 0xf6, 0x3d, 0x78, 0x36, 0xd7, 0x83, 0x3a, 0xfb, 0xbd, 0xbe, 0xa2, 0x21,
+  0xd9, 0xe0, 0x4d, 0x36, 0x78, 0x27, 0x60, 0x6b, 0xf2, 0xe9, 0xc3, 0xc3, 0x3b, 0x78, 0x7a, 0x64,
+  0xe0, 0x21, 0xa9, 0x10, 0x40, 0x7f, 0xdb, 0x13, 0x4b, 0x16, 0xb4, 0x8d, 0x7f, 0xbc, 0x9d, 0x19,
+  0x27, 0xa4, 0xd8, 0xac, 0x0c, 0x3c, 0xe8, 0x44, 0x2c, 0xa3, 0x94, 0x2c, 0xb0, 0xdb, 0x15, 0x53,
+  0xca, 0x0d, 0xe8, 0x68, 0x73, 0x4a, 0x3d, 0xef, 0x07, 0x98, 0x54, 0x54, 0xb1, 0x99, 0x59, 0xf9,
+  0xb6, 0x77, 0xb4, 0x49, 0xb9, 0x0e, 0xfb, 0x03, 0xcc, 0xd9, 0xa9, 0x76, 0x94, 0x29, 0x71, 0x9f,
+  0xfd, 0x56, 0x5b, 0x74, 0x53, 0xff, 0x71, 0xc6, 0x68, 0xf1, 0x8d, 0xac, 0xc9, 0xfa, 0x07, 0x58,
+  0xf2, 0xad, 0xa0, 0x89, 0x8c, 0x63, 0x00, 0xb1, 0xe3, 0x3c, 0x1b, 0xd1, 0x71, 0x1a, 0x40, 0xc6,
+  0xe3, 0xc9, 0xb7, 0x62, 0x21, 0x77, 0x33, 0x90, 0x9b, 0x67, 0x81, 0xdc, 0x34, 0x03, 0x99, 0x3e,
+  0x0b, 0x64, 0xda, 0x0c, 0xe4, 0xee, 0x59, 0x20, 0x77, 0x0d, 0x2d, 0x89, 0x27, 0xa1, 0xe7, 0x58,
+  0x83, 0x12, 0xf6, 0x83, 0x41, 0x96, 0xbc, 0xc7, 0x1b, 0x28, 0x38, 0xf3, 0xb4, 0xa3, 0xa5, 0x4d,
+  0x15, 0x9b, 0xc2, 0x69, 0x89, 0x9d, 0xe0, 0x25, 0x5f, 0xb2, 0xc1, 0xf0, 0xf8, 0x04, 0x7b, 0x56,
+  0x6e, 0x01, 0xd9, 0xa1, 0xd0, 0x54, 0xc7, 0x3b, 0x15, 0x73, 0x2c, 0x5a, 0x4b, 0x6c, 0xd9, 0x19,
+  0x7d, 0x87, 0x84, 0x4c, 0x45, 0x61, 0x30, 0x26, 0x04, 0x9b, 0x97, 0x2d, 0x48, 0x20, 0x14, 0x8a,
+  0x83, 0xe3, 0x71, 0x18, 0xeb, 0x2d, 0x09, 0x70, 0x88, 0x80, 0x11, 0x2e, 0x89, 0x84, 0x52, 0xd9,
+  0xca, 0x83, 0xa1, 0xca, 0xc9, 0x1e, 0x3f, 0x68, 0xb7, 0x36, 0x3b, 0x08, 0xe1, 0x5c, 0xb7, 0xd5,
+  0xec, 0x96, 0x4b, 0x83, 0x05, 0x43, 0x6d, 0x53, 0x35, 0x33, 0xdd, 0x94, 0xcb, 0x65, 0x4f, 0x53,
+  0x6a, 0x9d, 0xc9, 0x4f, 0x13, 0xf2, 0x2a, 0x53, 0xb3, 0x55, 0x63, 0x69, 0xc6, 0x84, 0xdf, 0x45,
+  0x12, 0x19, 0x06, 0xe0, 0x99, 0x8c, 0x45, 0x3b, 0x08, 0xc8, 0xff, 0x39, 0xfd, 0xf8, 0x6b, 0x6f,
+  0x89, 0xff, 0x94, 0x9c, 0x62, 0xc8, 0x25, 0x74, 0x61, 0x86, 0xf3, 0xd4, 0xa1, 0x42, 0x97, 0x3b,
+  0x62, 0x77, 0xe2, 0x09, 0xec, 0xdd, 0xec, 0xc3, 0x03, 0x08, 0x94, 0xbd, 0x0d, 0xcc, 0x10, 0xf7,
+  0x7c, 0x03, 0xbd, 0x60, 0xf0, 0x94, 0x84, 0xcf, 0xf5, 0x12, 0xb6, 0xcd, 0x25, 0xe4, 0x0e, 0xb9,
+  0x65, 0x29, 0x0a, 0xbf, 0x6a, 0x26, 0xa9, 0x7a, 0xcb, 0x54, 0x11, 0x26, 0x9c, 0x7f, 0x9b, 0x7f,
+  0x3e, 0x25, 0xa2, 0x78, 0x4f, 0x54, 0x27, 0xe3, 0xf4, 0x90, 0x8c, 0xca, 0x7d, 0x4e, 0x9d, 0x84,
+  0x01, 0x48, 0xf8, 0x9a, 0x66, 0x4f, 0xa1, 0x70, 0x62, 0x16, 0xe4, 0x76, 0x4c, 0x71, 0xc3, 0x5c,
+  0xf5, 0xd3, 0xb9, 0x1e, 0xe6, 0xff, 0xf8, 0xea, 0xb2, 0x1f, 0xff, 0xb7, 0x82, 0xbf, 0x00, 0x6d,
+  0x8b, 0xd3, 0x92, 0x6e, 0x20, 0x00, 0x00,
+};
+
+#endif // WEBPAGE_GZ_H
@@ -373,76 +373,27 @@ const char body[] PROGMEM = R"===(
         xhttp.send();
       }
 
-      // Updating Vive X, Y, and Theta values
-      setInterval(updateViveX, 100);
-      function updateViveX() {
+      // Vive pose, ToF distances and mode in one request over a kept-alive
+      // connection (the single-value endpoints are still served)
+      setInterval(updateState, 100);
+      var stateBusy = false;
+      function updateState() {
+        if (stateBusy) return;   // do not stack requests if one is slow
+        stateBusy = true;
         var xttp = new XMLHttpRequest();
         xttp.onreadystatechange = function () {
-          if (this.readyState == 4 && this.status == 200) {
-            document.getElementById("viveXLabel").innerHTML = this.responseText;
-          }
-        };
-        xttp.open("GET", "viveX", true);
-        xttp.send();
-      }
-
-      setInterval(updateViveY, 100);
-      function updateViveY() {
-        var xttp = new XMLHttpRequest();
-        xttp.onreadystatechange = function () {
-          if (this.readyState == 4 && this.status == 200) {
-            document.getElementById("viveYLabel").innerHTML = this.responseText;
-          }
-        };
-        xttp.open("GET", "viveY", true);
-        xttp.send();
-      }
-
-      setInterval(updateViveTheta, 100);
-      function updateViveTheta() {
-        var xttp = new XMLHttpRequest();
-        xttp.onreadystatechange = function () {
-          if (this.readyState == 4 && this.status == 200) {
-            document.getElementById("viveThetaLabel").innerHTML = this.responseText;
-          }
-        };
-        xttp.open("GET", "viveTheta", true);
-        xttp.send();
-      }
-
-      setInterval(updateFrontLeftTof, 100);
-      function updateFrontLeftTof() {
-        var xttp = new XMLHttpRequest();
-        xttp.onreadystatechange = function () {
-          if (this.readyState == 4 && this.status == 200) {
-            document.getElementById("frontLeftTofLabel").innerHTML = this.responseText;
-          }
-        };
-        xttp.open("GET", "frontLeftTof", true);
-        xttp.send();
-      }
-
-      setInterval(updateFrontRightTof, 100);
-      function updateFrontRightTof() {
-        var xttp = new XMLHttpRequest();
-        xttp.onreadystatechange = function () {
-          if (this.readyState == 4 && this.status == 200) {
-            document.getElementById("frontRightTofLabel").innerHTML = this.responseText;
-          }
-        };
-        xttp.open("GET", "frontRightTof", true);
-        xttp.send();
-      }
-
-      setInterval(updateBackLeftTof, 100);
-      function updateBackLeftTof() {
-        var xttp = new XMLHttpRequest();
-        xttp.onreadystatechange = function () {
-          if (this.readyState == 4 && this.status == 200) {
-            document.getElementById("backLeftTofLabel").innerHTML = this.responseText;
-          }
+          if (this.readyState != 4) return;
+          stateBusy = false;
+          if (this.status != 200) return;
+          var s = JSON.parse(this.responseText);
+          document.getElementById("viveXLabel").innerHTML = s.x.toFixed(2);
+          document.getElementById("viveYLabel").innerHTML = s.y.toFixed(2);
+          document.getElementById("viveThetaLabel").innerHTML = s.theta.toFixed(2);
+          document.getElementById("frontLeftTofLabel").innerHTML = s.tof[0];
+          document.getElementById("frontRightTofLabel").innerHTML = s.tof[1];
+          document.getElementById("backLeftTofLabel").innerHTML = s.tof[2];
         };
-        xttp.open("GET", "backLeftTof", true);
+        xttp.open("GET", "state", true);
         xttp.send();
       }
     </script>
@@ -0,0 +1,162 @@
+/*
+ * Host test for the owner-4 motion arbiter (owner-4/motion_arbiter.cpp).
+ *
+ * Drives a scripted tick sequence through submit()/arbitrate() the way the
+ * owner loop does (behaviours submit, then one arbitrate per ~50 ms loop) and
+ * checks the command sent on each tick: priority conflicts, a higher-priority
+ * command holding its TTL against lower ones, the stop sent once everything
+ * has expired, the operator stop override, first-come on equal priority and
+ * the candidate limit. Every tick also counts heap allocations (operator new
+ * and malloc are replaced below), which must stay at zero: the arbiter is on
+ * the control path and must not touch the heap.
+ *
+ * Usage: make check   (exit status 1 on any mismatch)
+ */
+
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "motion_arbiter.h"
+
+// ---- allocation counting -------------------------------------------------
+
+static bool g_counting = false;
+static unsigned long g_allocs = 0;
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+extern "C" void __libc_free(void*);
+
+extern "C" void* malloc(size_t n) {
+    if (g_counting) g_allocs++;
+    return __libc_malloc(n);
+}
+extern "C" void* calloc(size_t n, size_t size) {
+    if (g_counting) g_allocs++;
+    return __libc_calloc(n, size);
+}
+extern "C" void* realloc(void* p, size_t n) {
+    if (g_counting) g_allocs++;
+    return __libc_realloc(p, n);
+}
+extern "C" void free(void* p) {
+    __libc_free(p);
+}
+
+void* operator new(size_t n) {
+    if (g_counting) g_allocs++;
+    void* p = __libc_malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new[](size_t n) {
+    return operator new(n);
+}
+void operator delete(void* p) noexcept {
+    __libc_free(p);
+}
+void operator delete[](void* p) noexcept {
+    __libc_free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+    __libc_free(p);
+}
+void operator delete[](void* p, size_t) noexcept {
+    __libc_free(p);
+}
+
+// ---- script ----------------------------------------------------------------
+
+struct Tick {
+    uint32_t nowMs;
+    const char* note;
+    MotionCommand submits[MOTION_MAX_CANDIDATES + 2];
+    int count;
+    const char* expect;   // formatted command, or "-" when nothing is sent
+};
+
+static const Tick SCRIPT[] = {
+    { 0, "wall vs goto: goto wins",
+      { motionCommand(MOTION_FORWARD, 50, MOTION_PRIO_WALL), motionCommand(MOTION_FORWARD, 30, MOTION_PRIO_GOTO) }, 2, "F30" },
+    { 50, "wall alone: goto still inside its TTL",
+      { motionCommand(MOTION_FORWARD, 50, MOTION_PRIO_WALL) }, 1, "F30" },
+    { 100, "nothing submitted, goto live: no resend", {}, 0, "-" },
+    { 250, "goto TTL expired: one stop", {}, 0, "S" },
+    { 300, "still nothing: stays quiet", {}, 0, "-" },
+    { 350, "wall resumes",
+      { motionCommand(MOTION_LEFT, 40, MOTION_PRIO_WALL) }, 1, "L40" },
+    { 400, "operator stop overrides wall and planner",
+      { motionCommand(MOTION_RIGHT, 40, MOTION_PRIO_WALL), motionCommand(MOTION_FORWARD, 60, MOTION_PRIO_PLANNER),
+        motionStop(MOTION_PRIO_OPERATOR, 0) }, 3, "S" },
+    { 450, "operator stop had TTL 0: planner takes over",
+      { motionCommand(MOTION_FORWARD, 60, MOTION_PRIO_PLANNER) }, 1, "F60" },
+    { 500, "planner inside TTL beats goto",
+      { motionCommand(MOTION_BACKWARD, 20, MOTION_PRIO_GOTO) }, 1, "F60" },
+    { 700, "equal priority: first submitted wins",
+      { motionCommand(MOTION_FORWARD, 10, MOTION_PRIO_WALL), motionCommand(MOTION_FORWARD, 20, MOTION_PRIO_WALL) }, 2, "F10" },
+    { 750, "candidate array full: extras dropped",
+      { motionCommand(MOTION_LEFT, 1, MOTION_PRIO_WALL), motionCommand(MOTION_LEFT, 2, MOTION_PRIO_WALL),
+        motionCommand(MOTION_LEFT, 3, MOTION_PRIO_WALL), motionCommand(MOTION_LEFT, 4, MOTION_PRIO_WALL),
+        motionCommand(MOTION_LEFT, 5, MOTION_PRIO_WALL), motionCommand(MOTION_LEFT, 6, MOTION_PRIO_WALL),
+        motionCommand(MOTION_LEFT, 7, MOTION_PRIO_WALL), motionCommand(MOTION_LEFT, 8, MOTION_PRIO_WALL),
+        motionCommand(MOTION_RIGHT, 99, MOTION_PRIO_OPERATOR), motionCommand(MOTION_RIGHT, 98, MOTION_PRIO_OPERATOR) },
+      10, "L1" },
+    { 1000, "wall went quiet: one stop", {}, 0, "S" },
+    { 1050, "wall submits its own stop",
+      { motionStop(MOTION_PRIO_WALL) }, 1, "S" },
+    { 1300, "a stop that expires is not repeated", {}, 0, "-" },
+    // millis() wraps after ~49.7 days; TTL must survive it
+    { 0xFFFFFFC0u, "goto just before millis() wraps",
+      { motionCommand(MOTION_FORWARD, 30, MOTION_PRIO_GOTO) }, 1, "F30" },
+    { 0x00000010u, "after the wrap: goto still holds",
+      { motionCommand(MOTION_FORWARD, 50, MOTION_PRIO_WALL) }, 1, "F30" },
+    { 0x00000200u, "after the wrap: expired, stop", {}, 0, "S" },
+};
+
+int main() {
+    MotionArbiter arbiter;
+    int failures = 0;
+    unsigned long totalAllocs = 0;
+
+    printf("%10s  %-4s %-6s %-6s %s\n", "now_ms", "cand", "sent", "allocs", "step");
+    for (const Tick& t : SCRIPT) {
+        MotionCommand out;
+        char sent[16] = "-";
+
+        g_allocs = 0;
+        g_counting = true;
+        for (int i = 0; i < t.count; i++) arbiter.submit(t.submits[i]);
+        bool send = arbiter.arbitrate(t.nowMs, out);
+        if (send) motionFormat(out, sent, sizeof(sent));
+        g_counting = false;
+        totalAllocs += g_allocs;
+
+        bool ok = !strcmp(sent, t.expect) && g_allocs == 0;
+        printf("%10lu  %-4d %-6s %-6lu %s%s\n", (unsigned long)t.nowMs, t.count, sent, g_allocs, t.note,
+               ok ? "" : "  <-- FAIL");
+        if (!ok) {
+            printf("            expected %s with 0 allocations\n", t.expect);
+            failures++;
+        }
+    }
+
+    char stats[160];
+    g_allocs = 0;
+    g_counting = true;
+    arbiter.formatStats(stats, sizeof(stats));
+    g_counting = false;
+    printf("\n%s", stats);
+
+    const char* expectStats =
+        "motion arbiter: ticks=17 submitted=22 conflicts=4 held_wins=3 expired_stops=3 dropped=2\n";
+    if (strcmp(stats, expectStats)) {
+        printf("expected %s", expectStats);
+        failures++;
+    }
+    printf("allocations: %lu in %zu ticks\n", totalAllocs + g_allocs, sizeof(SCRIPT) / sizeof(SCRIPT[0]));
+    printf("%s\n", failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Just enough of the Arduino-ESP32 core and FreeRTOS to build gagac-2 modules
+ * on a host (tools/link_test, tools/cmd_bench): Print, the String calls the
+ * on-board benchmarks make, micros(), a HardwareSerial that test code can push
+ * received bytes into, and a FreeRTOS queue on top of std::deque. Nothing here
+ * is used by the firmware build.
+ */
+
+#ifndef ARDUINO_HOST_ARDUINO_H
+#define ARDUINO_HOST_ARDUINO_H
+
+#include <chrono>
+#include <ctype.h>
+#include <deque>
+#include <functional>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+inline unsigned long micros() {
+    static const auto start = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() { return micros() / 1000; }
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t n) {
+        for (size_t i = 0; i < n; i++) write(buf[i]);
+        return n;
+    }
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t println(const char* s = "") { return print(s) + print("\n"); }
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[512];
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+        va_end(ap);
+        if (n < 0) return 0;
+        return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+    }
+};
+
+// heap-backed like the Arduino one, but std::string keeps short strings inline,
+// so the host ASCII path is if anything faster than on the ESP32
+class String {
+private:
+    std::string m_s;
+
+public:
+    String(const char* s = "") : m_s(s) {}
+    const char* c_str() const { return m_s.c_str(); }
+    bool operator==(const char* s) const { return m_s == s; }
+    bool startsWith(const char* s) const { return m_s.compare(0, strlen(s), s) == 0; }
+    void toUpperCase() {
+        for (char& c : m_s) c = (char)toupper((unsigned char)c);
+    }
+    void trim() {
+        size_t b = m_s.find_first_not_of(" \t\r\n");
+        size_t e = m_s.find_last_not_of(" \t\r\n");
+        m_s = (b == std::string::npos) ? std::string() : m_s.substr(b, e - b + 1);
+    }
+    int indexOf(char c, int from = 0) const {
+        size_t i = m_s.find(c, (size_t)from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    String substring(int from, int to = -1) const {
+        size_t end = (to < 0 || (size_t)to > m_s.size()) ? m_s.size() : (size_t)to;
+        return String(m_s.substr((size_t)from, end - (size_t)from).c_str());
+    }
+    float toFloat() const { return (float)atof(m_s.c_str()); }
+};
+
+// receive side only: push() stands in for the UART driver and runs the onReceive callback
+class HardwareSerial : public Print {
+private:
+    std::deque<uint8_t> m_rx;
+    std::function<void(void)> m_onReceive;
+
+public:
+    size_t write(uint8_t) override { return 1; }
+    using Print::write;
+    int available() { return (int)m_rx.size(); }
+    int read() {
+        if (m_rx.empty()) return -1;
+        int c = m_rx.front();
+        m_rx.pop_front();
+        return c;
+    }
+    void onReceive(std::function<void(void)> cb, bool = true) { m_onReceive = cb; }
+    void push(const uint8_t* buf, size_t n) {
+        m_rx.insert(m_rx.end(), buf, buf + n);
+        if (m_onReceive) m_onReceive();
+    }
+};
+
+// ---- FreeRTOS queue ----
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+#define pdTRUE  1
+#define pdFALSE 0
+
+struct HostQueue {
+    size_t depth;
+    size_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t depth, UBaseType_t itemSize) {
+    return new HostQueue{depth, itemSize, {}};
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t) {
+    if (q->items.size() >= q->depth) return pdFALSE;
+    const uint8_t* p = (const uint8_t*)item;
+    q->items.emplace_back(p, p + q->itemSize);
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t) {
+    if (q->items.empty()) return pdFALSE;
+    memcpy(item, q->items.front().data(), q->itemSize);
+    q->items.pop_front();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) { return (UBaseType_t)q->items.size(); }
+
+#endif // ARDUINO_HOST_ARDUINO_H
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""Minify and gzip the embedded web pages into PROGMEM byte arrays.
+
+Each page is still edited as a raw-string header (gagac-web.h, webpage.h).
+This script extracts the raw literal, strips comments and indentation,
+gzips the result, and writes <stem>.gz.h next to the source with:
+
+    <symbol>_gz[]   gzip bytes (PROGMEM), served with Content-Encoding: gzip
+    <symbol>_gz_len
+    <symbol>_etag[] quoted content hash, used for ETag / If-None-Match
+
+Usage:
+    python3 tools/build_web_assets.py          # regenerate all pages
+    python3 tools/build_web_assets.py --check  # exit 1 if any output is stale
+
+Re-run after every change to a page source; the sketches include only the
+generated headers.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# (page source, array name in the source)
+PAGES = [
+    ("510finalgagac/gagac-2/gagac-web.h", "webpage"),
+    ("meam510_final_project/motor/webpage.h", "body"),
+    ("meam510_final_project/sensor/webpage.h", "body"),
+]
+
+RAW_LITERAL = re.compile(r'R"([^(\s]*)\((.*)\)\1"', re.S)
+
+
+def extract(src):
+    m = RAW_LITERAL.search(src)
+    if not m:
+        raise ValueError("no raw string literal found")
+    return m.group(2)
+
+
+def minify(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    html = re.sub(r"(<style[^>]*>)(.*?)(</style>)",
+                  lambda m: m.group(1) + re.sub(r"/\*.*?\*/", "", m.group(2), flags=re.S) + m.group(3),
+                  html, flags=re.S)
+    out = []
+    in_script = False
+    for line in html.splitlines():
+        s = line.strip()
+        if re.search(r"<script[^>]*>", s):
+            in_script = True
+        if re.search(r"</script>", s):
+            in_script = False
+        # Only whole-line // comments are dropped, so "ws://" and trailing
+        # comments are left alone; line breaks are kept for ASI.
+        if not s or (in_script and s.startswith("//")):
+            continue
+        out.append(s)
+    return "\n".join(out) + "\n"
+
+
+def render(symbol, source_name, raw_len, data, etag):
+    guard = re.sub(r"\W", "_", os.path.splitext(os.path.basename(source_name))[0]).upper() + "_GZ_H"
+    lines = [
+        "// Generated by tools/build_web_assets.py from %s (%d bytes minified, %d bytes gzip). Do not edit."
+        % (os.path.basename(source_name), raw_len, len(data)),
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        "#include <Arduino.h>",
+        "",
+        'const char %s_etag[] = "\\"%s\\"";' % (symbol, etag),
+        "const size_t %s_gz_len = %d;" % (symbol, len(data)),
+        "const uint8_t %s_gz[] PROGMEM = {" % symbol,
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines += ["};", "", "#endif // %s" % guard, ""]
+    return "\n".join(lines)
+
+
+def build(rel, symbol):
+    path = os.path.join(ROOT, rel)
+    with open(path, encoding="utf-8") as f:
+        page = minify(extract(f.read())).encode("utf-8")
+    data = gzip.compress(page, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(page).hexdigest()[:16]
+    out = os.path.splitext(path)[0] + ".gz.h"
+    return out, render(symbol, rel, len(page), data, etag)
+
+
+def main():
+    check = "--check" in sys.argv[1:]
+    stale = 0
+    for rel, symbol in PAGES:
+        out, text = build(rel, symbol)
+        old = None
+        if os.path.exists(out):
+            with open(out, encoding="utf-8") as f:
+                old = f.read()
+        name = os.path.relpath(out, ROOT)
+        if old == text:
+            print("up to date  %s" % name)
+        elif check:
+            print("STALE       %s" % name)
+            stale += 1
+        else:
+            with open(out, "w", encoding="utf-8") as f:
+                f.write(text)
+            print("wrote       %s" % name)
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,152 @@
+/*
+ * Host check and benchmark for the servant text-command dispatcher
+ * (gagac-2/cmd_dispatch.cpp) over the real command table
+ * (gagac-2/servant_commands.h), both built unchanged against the shim in
+ * tools/arduino_host/. Handlers are replaced by one stub; each entry keeps the
+ * handler's name so mismatches are readable.
+ *
+ * The check builds one line per table entry (prefix plus an argument of the
+ * entry's type, upper and lower case) and requires it to resolve to that same
+ * entry, then runs a few lines the old first-match if chain got wrong and the
+ * source restrictions (owner lines must not reach local-only commands).
+ *
+ * The benchmark times resolve() over those lines (ns per lookup) and then runs
+ * the firmware's cmdBenchmark() (the CMD_BENCH serial command): the old String
+ * chain vs the dispatcher on the same sample lines.
+ *
+ * Usage:
+ *   make check                  # exit status 1 on any mismatch
+ *   make bench                  # ./cmd_bench --bench 200000
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "servant_commands.h"
+
+static void hostHandler(const CmdArgs&) {}
+
+#define HOST_CMD(prefix, argType, sources, handler) \
+    { prefix, sizeof(prefix) - 1, argType, sources, hostHandler, #handler },
+#define HOST_CMD_ARG(prefix, argType, sources, handler, target) \
+    { prefix, sizeof(prefix) - 1, argType, sources, hostHandler, #handler },
+
+static const CmdEntry table[] = { SERVANT_COMMAND_TABLE(HOST_CMD, HOST_CMD_ARG) };
+static const uint8_t tableCount = sizeof(table) / sizeof(table[0]);
+
+struct StdoutPrint : Print {
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+};
+
+static const char* handlerName(const CmdEntry* e) {
+    return e ? (const char*)e->target : "-";
+}
+
+// one line per entry, with an argument of the entry's type
+static std::vector<std::string> entryLines(bool lower) {
+    std::vector<std::string> lines;
+    for (uint8_t k = 0; k < tableCount; k++) {
+        std::string line = table[k].prefix;
+        if (lower) {
+            for (char& c : line) c = (char)tolower((unsigned char)c);
+        }
+        switch (table[k].argType) {
+            case CMD_ARG_FLOAT: line += "-1.5"; break;
+            case CMD_ARG_INT:   line += "3"; break;
+            case CMD_ARG_TEXT:  line += "x,1"; break;
+            default: break;
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static int g_failures = 0;
+
+static void expectResolve(const CmdDispatcher& d, const char* line, uint8_t source, CmdResult wantResult,
+                          const CmdEntry* want) {
+    CmdArgs args;
+    CmdResult r = d.resolve(line, source, args);
+    const CmdEntry* got = (r == CMD_OK) ? args.entry : nullptr;
+    if (r == wantResult && got == want) return;
+    g_failures++;
+    printf("  FAIL %-22s -> %s %s (want %s %s)\n", line, cmdResultName(r), handlerName(got),
+           cmdResultName(wantResult), handlerName(want));
+}
+
+static const CmdEntry* find(const char* prefix) {
+    for (uint8_t k = 0; k < tableCount; k++) {
+        if (!strcmp(table[k].prefix, prefix)) return &table[k];
+    }
+    printf("  no table entry %s\n", prefix);
+    g_failures++;
+    return nullptr;
+}
+
+static void check(const CmdDispatcher& d) {
+    for (int lower = 0; lower < 2; lower++) {
+        std::vector<std::string> lines = entryLines(lower);
+        for (uint8_t k = 0; k < tableCount; k++) {
+            expectResolve(d, lines[k].c_str(), CMD_SRC_SERIAL, CMD_OK, &table[k]);
+        }
+    }
+    printf("%-40s %s\n", "every entry resolves to itself", g_failures ? "FAIL" : "ok");
+
+    int before = g_failures;
+    // lines the first-match chain routed to a shorter prefix
+    expectResolve(d, "SV1", CMD_SRC_SERIAL, CMD_OK, find("SV"));
+    expectResolve(d, "SPEED=50", CMD_SRC_WEB, CMD_OK, find("SPEED="));
+    expectResolve(d, "LINK_TIMEOUT:800", CMD_SRC_SERIAL, CMD_OK, find("LINK_TIMEOUT:"));
+    expectResolve(d, "  s \r\n", CMD_SRC_SERIAL, CMD_OK, find("S"));
+    expectResolve(d, "FF1", CMD_SRC_SERIAL, CMD_OK, find("FF1"));
+    expectResolve(d, "FFA12", CMD_SRC_SERIAL, CMD_OK, find("FFA"));
+    expectResolve(d, "F70", CMD_SRC_SERIAL, CMD_OK, find("F"));
+    expectResolve(d, "F7x", CMD_SRC_SERIAL, CMD_BAD_ARG, nullptr);
+    expectResolve(d, "STOP", CMD_SRC_SERIAL, CMD_UNKNOWN, nullptr);
+    expectResolve(d, "", CMD_SRC_SERIAL, CMD_EMPTY, nullptr);
+    printf("%-40s %s\n", "longest prefix and argument parsing", g_failures > before ? "FAIL" : "ok");
+
+    before = g_failures;
+    for (uint8_t k = 0; k < tableCount; k++) {
+        if (table[k].sources & CMD_SRC_OWNER) continue;
+        std::string line = entryLines(false)[k];
+        expectResolve(d, line.c_str(), CMD_SRC_OWNER, CMD_DENIED, nullptr);
+    }
+    printf("%-40s %s\n", "owner lines denied local-only commands", g_failures > before ? "FAIL" : "ok");
+}
+
+static void bench(const CmdDispatcher& d, uint32_t iterations) {
+    std::vector<std::string> lines = entryLines(false);
+    volatile float sink = 0.0f;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (const std::string& line : lines) {
+            CmdArgs args;
+            if (d.resolve(line.c_str(), CMD_SRC_ALL, args) == CMD_OK) sink = sink + args.f + args.i;
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    (void)sink;
+    printf("resolve over the %u table lines x%lu: %.1f ns/lookup\n", (unsigned)tableCount,
+           (unsigned long)iterations, ns / ((double)iterations * tableCount));
+
+    StdoutPrint out;
+    cmdBenchmark(out, d, table, tableCount, iterations);
+}
+
+int main(int argc, char** argv) {
+    CmdDispatcher dispatcher(table, tableCount);
+    if (argc >= 2 && !strcmp(argv[1], "--bench")) {
+        bench(dispatcher, argc >= 3 ? (uint32_t)strtoul(argv[2], nullptr, 10) : 100000);
+        return 0;
+    }
+
+    printf("servant command table: %u entries\n", (unsigned)tableCount);
+    check(dispatcher);
+    printf("%s (%d failures)\n", g_failures ? "FAIL" : "ok", g_failures);
+    return g_failures ? 1 : 0;
+}
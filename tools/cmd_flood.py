@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Flood the servant's /cmd endpoint and compare loop-period histograms.
+
+Connect to the ESP32-MobileBase access point first. The run has two phases:
+
+  1. idle:  reset /loopStats, wait --seconds, read it back
+  2. flood: reset /loopStats, hammer /cmd from --threads connections for
+            --seconds (optionally also /viveData and the page itself),
+            read it back
+
+It then prints both histograms side by side. The control loop has a
+delay(5) at the end, so a healthy loop sits in the 5-6 ms bucket. The
+"over" column counts loop periods longer than one control period (20 ms),
+i.e. PID outputs that were late.
+
+Usage:
+    python3 tools/cmd_flood.py                      # 8 threads, 10 s, cmd "S"
+    python3 tools/cmd_flood.py --threads 16 --mix   # also fetch /viveData and /
+"""
+
+import argparse
+import http.client
+import json
+import threading
+import time
+import urllib.parse
+
+
+def get(conn, path):
+    conn.request("GET", path)
+    resp = conn.getresponse()
+    body = resp.read()
+    return resp.status, body
+
+
+def loop_stats(host, reset=False):
+    conn = http.client.HTTPConnection(host, timeout=5)
+    try:
+        status, body = get(conn, "/loopStats" + ("?reset=1" if reset else ""))
+        if status != 200:
+            raise RuntimeError("/loopStats returned %d" % status)
+        return json.loads(body)
+    finally:
+        conn.close()
+
+
+def flood(host, paths, seconds, counts, lock):
+    deadline = time.time() + seconds
+    conn = None
+    i = 0
+    while time.time() < deadline:
+        if conn is None:
+            conn = http.client.HTTPConnection(host, timeout=3)
+        path = paths[i % len(paths)]
+        i += 1
+        try:
+            status, _ = get(conn, path)
+            key = str(status)
+        except (OSError, http.client.HTTPException):
+            key = "error"
+            conn.close()
+            conn = None
+        with lock:
+            counts[key] = counts.get(key, 0) + 1
+    if conn is not None:
+        conn.close()
+
+
+def bucket_labels(edges):
+    labels = []
+    lo = 0
+    for e in edges:
+        labels.append("%5.1f-%5.1f ms" % (lo / 1000.0, e / 1000.0))
+        lo = e
+    labels.append("    >%5.1f ms" % (lo / 1000.0))
+    return labels
+
+
+def summary(s):
+    return "n=%d mean=%.2f p50<=%.1f p99<=%.1f max=%.2f ms over=%d" % (
+        s["n"], s["mean"] / 1000.0, s["p50"] / 1000.0, s["p99"] / 1000.0,
+        s["max"] / 1000.0, s["over"])
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--host", default="192.168.4.1")
+    ap.add_argument("--threads", type=int, default=8)
+    ap.add_argument("--seconds", type=float, default=10.0)
+    ap.add_argument("--cmd", default="S", help="command sent to /cmd (default: stop)")
+    ap.add_argument("--mix", action="store_true", help="also request /viveData and /")
+    args = ap.parse_args()
+
+    paths = ["/cmd?data=" + urllib.parse.quote(args.cmd)]
+    if args.mix:
+        paths += ["/viveData", "/"]
+
+    print("idle for %.0f s ..." % args.seconds)
+    loop_stats(args.host, reset=True)
+    time.sleep(args.seconds)
+    idle = loop_stats(args.host)
+
+    print("flooding %s with %d threads for %.0f s ..." % (", ".join(paths), args.threads, args.seconds))
+    loop_stats(args.host, reset=True)
+    counts = {}
+    lock = threading.Lock()
+    workers = [threading.Thread(target=flood, args=(args.host, paths, args.seconds, counts, lock))
+               for _ in range(args.threads)]
+    t0 = time.time()
+    for w in workers:
+        w.start()
+    for w in workers:
+        w.join()
+    elapsed = time.time() - t0
+    loaded = loop_stats(args.host)
+
+    total = sum(counts.values())
+    print("requests: %d (%.0f/s) %s" % (total, total / elapsed,
+          " ".join("%s=%d" % kv for kv in sorted(counts.items()))))
+    print()
+    print("%-16s %10s %10s" % ("loop period", "idle", "flood"))
+    for label, a, b in zip(bucket_labels(idle["edges"]), idle["hist"], loaded["hist"]):
+        if a or b:
+            print("%-16s %10d %10d" % (label, a, b))
+    print()
+    print("idle : " + summary(idle))
+    print("flood: " + summary(loaded))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,205 @@
+/*
+ * Host test and benchmark for the owner <-> servant UART message layer
+ * (gagac-2/link_proto.cpp, built unchanged against the shim in tools/arduino_host/).
+ *
+ * The test feeds byte streams through LinkPort::feed() and checks what comes
+ * out: every message type round-trips between ASCII lines, a frame that fails
+ * its CRC or is too long does not swallow the text line after it, a frame
+ * whose leading 0x00 was lost does not leak into the next line, and the same
+ * holds through LinkReceiver's queue.
+ *
+ * --bench runs the firmware's own linkBenchmark() (the LINK_BENCH serial
+ * command): bytes per pose message and encode+parse time, ASCII vs binary.
+ *
+ * Usage:
+ *   make check                  # exit status 1 on any mismatch
+ *   make bench                  # ./link_test --bench 200000
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "link_proto.h"
+
+struct StdoutPrint : Print {
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+};
+
+// collects what the firmware would put on the UART
+struct Wire : Print {
+    std::vector<uint8_t> bytes;
+    size_t write(uint8_t c) override {
+        bytes.push_back(c);
+        return 1;
+    }
+    using Print::write;
+    void text(const char* s) { bytes.insert(bytes.end(), s, s + strlen(s)); }
+};
+
+// what feed() produced for a stream: "M<type>" per message, "T<line>" per text line
+struct Received {
+    std::vector<LinkMessage> msgs;
+    std::vector<std::string> events;
+};
+
+static Received feedAll(LinkPort& port, const std::vector<uint8_t>& bytes) {
+    Received r;
+    for (uint8_t c : bytes) {
+        LinkRxResult res = port.feed(c);
+        if (res == LINK_RX_MESSAGE) {
+            r.msgs.push_back(port.message());
+            r.events.push_back("M" + std::to_string(port.message().type));
+        } else if (res == LINK_RX_TEXT) {
+            r.events.push_back(std::string("T") + port.text());
+        }
+    }
+    return r;
+}
+
+static int g_failures = 0;
+
+static void expectEvents(const char* name, const Received& r, const std::vector<std::string>& want) {
+    bool ok = r.events == want;
+    printf("%-40s %s\n", name, ok ? "ok" : "FAIL");
+    if (ok) return;
+    g_failures++;
+    printf("  want:");
+    for (const std::string& e : want) printf(" [%s]", e.c_str());
+    printf("\n  got: ");
+    for (const std::string& e : r.events) printf(" [%s]", e.c_str());
+    printf("\n");
+}
+
+static void expect(const char* what, bool ok) {
+    if (ok) return;
+    g_failures++;
+    printf("  FAIL: %s\n", what);
+}
+
+static void testRoundTrip() {
+    LinkPort tx, rx;
+    Wire w;
+    LinkParamDesc desc = {};
+    desc.index = 3;
+    desc.count = 9;
+    desc.type = 1;
+    desc.group = 'T';
+    desc.value = 0.5f;
+    desc.maxVal = 2.0f;
+    desc.step = 0.05f;
+    strcpy(desc.name, "SEQ_FRONT_POST_STOP_MS");
+
+    tx.sendPose(w, 4123.57f, 2987.12f, -123.45f, 1000);
+    w.text("MP_ROUTE:1,2,3,0;4,5,6,1\r\n");
+    tx.sendMotion(w, 'F', 70.0f, 2000);
+    tx.sendParam(w, LINK_PARAM_WALL, "SEQ_FRONT_POST_STOP_MS", 123.5f);
+    tx.sendMode(w, LINK_MODE_MP_ON);
+    w.text("STATUS\n");
+    tx.sendAck(w, LINK_PARAM, 7, 0);
+    tx.sendHeartbeat(w, 10, 20, 30);
+    tx.sendParamDesc(w, desc);
+
+    Received r = feedAll(rx, w.bytes);
+    expectEvents("round trip, all types and text", r,
+                 { "M1", "TMP_ROUTE:1,2,3,0;4,5,6,1", "M2", "M3", "M4", "TSTATUS", "M5", "M6", "M7" });
+    if (r.msgs.size() != 7) return;
+    expect("pose fields", r.msgs[0].pose.x == 4123.57f && r.msgs[0].pose.y == 2987.12f &&
+                              r.msgs[0].pose.angle == -123.45f && r.msgs[0].pose.stampUs == 1000);
+    expect("motion fields", r.msgs[1].motion.mode == 'F' && r.msgs[1].motion.value == 70.0f);
+    expect("param fields", r.msgs[2].param.target == LINK_PARAM_WALL &&
+                               !strcmp(r.msgs[2].param.name, "SEQ_FRONT_POST_STOP_MS") &&
+                               r.msgs[2].param.value == 123.5f);
+    expect("mode field", r.msgs[3].mode.mode == LINK_MODE_MP_ON);
+    expect("ack fields", r.msgs[4].ack.type == LINK_PARAM && r.msgs[4].ack.seq == 7);
+    expect("heartbeat fields", r.msgs[5].heartbeat.txUs == 10 && r.msgs[5].heartbeat.echoRxUs == 30);
+    expect("param desc fields", r.msgs[6].paramDesc.index == 3 && r.msgs[6].paramDesc.group == 'T' &&
+                                    !strcmp(r.msgs[6].paramDesc.name, "SEQ_FRONT_POST_STOP_MS"));
+    expect("no errors", rx.getCrcErrors() == 0 && rx.getFrameErrors() == 0 && rx.getOverruns() == 0);
+}
+
+// the frame is damaged in transit; the text line right after it must still arrive
+static void testCorruptFrameThenText() {
+    LinkPort tx, rx;
+    Wire w;
+    tx.sendPose(w, 1.0f, 2.0f, 3.0f, 0);
+    w.bytes[5] ^= 0x10;
+    w.text("STATUS\r\n");
+    tx.sendPose(w, 4.0f, 5.0f, 6.0f, 0);
+
+    Received r = feedAll(rx, w.bytes);
+    expectEvents("corrupt frame, then text", r, { "TSTATUS", "M1" });
+    expect("corrupt frame counted", rx.getCrcErrors() + rx.getFrameErrors() == 1);
+    expect("following frame intact", r.msgs.size() == 1 && r.msgs[0].pose.x == 4.0f);
+}
+
+// a start delimiter followed by more than a frame's worth of bytes (closing 0x00 lost):
+// the swallowed line is dropped, the next one arrives
+static void testOverlongFrameThenText() {
+    LinkPort tx, rx;
+    Wire w;
+    w.bytes.push_back(0x00);
+    for (int i = 0; i < LINK_MAX_WIRE + 10; i++) w.bytes.push_back('A');
+    w.text("\nSTATUS\n");
+    tx.sendMode(w, LINK_MODE_AUTO_ON);
+    w.text("LINK_STATS\n");
+
+    Received r = feedAll(rx, w.bytes);
+    expectEvents("overlong frame, then text", r, { "TSTATUS", "M4", "TLINK_STATS" });
+    expect("overrun counted once", rx.getOverruns() == 1);
+}
+
+// joining mid-frame (or losing the leading 0x00): the frame tail is not text
+static void testLostStartDelimiter() {
+    LinkPort tx, rx;
+    Wire w;
+    tx.sendPose(w, 1.0f, 2.0f, 3.0f, 0);
+    w.bytes.erase(w.bytes.begin());
+    tx.sendPose(w, 4.0f, 5.0f, 6.0f, 0);
+    w.text("STATUS\n");
+
+    Received r = feedAll(rx, w.bytes);
+    expectEvents("lost start delimiter", r, { "M1", "TSTATUS" });
+    expect("resynced on the next frame", r.msgs.size() == 1 && r.msgs[0].pose.x == 4.0f);
+}
+
+// the same stream through the UART event path and the queue the main loop polls
+static void testReceiverQueue() {
+    LinkPort tx, rxPort;
+    HardwareSerial serial;
+    LinkReceiver receiver(serial, rxPort);
+    expect("receiver begin", receiver.begin());
+
+    Wire w;
+    tx.sendPose(w, 1.0f, 2.0f, 3.0f, 0);
+    w.bytes[6] ^= 0x01;
+    w.text("STATUS\n");
+    tx.sendMotion(w, 'S', 0.0f, 0);
+    serial.push(w.bytes.data(), w.bytes.size());
+
+    Received r;
+    LinkRxItem item;
+    while (receiver.poll(item)) {
+        if (item.kind == LINK_RX_MESSAGE) r.events.push_back("M" + std::to_string(item.msg.type));
+        else r.events.push_back(std::string("T") + item.text);
+    }
+    expectEvents("receiver queue, corrupt frame then text", r, { "TSTATUS", "M2" });
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 2 && !strcmp(argv[1], "--bench")) {
+        StdoutPrint out;
+        linkBenchmark(out, argc >= 3 ? (uint32_t)strtoul(argv[2], nullptr, 10) : 100000);
+        return 0;
+    }
+
+    testRoundTrip();
+    testCorruptFrameThenText();
+    testOverlongFrameThenText();
+    testLostStartDelimiter();
+    testReceiverQueue();
+
+    printf("%s (%d failures)\n", g_failures ? "FAIL" : "ok", g_failures);
+    return g_failures ? 1 : 0;
+}
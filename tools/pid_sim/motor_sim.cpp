@@ -0,0 +1,76 @@
+/* JGA25-370 plant and encoder edge generator */
+
+#include "motor_sim.h"
+#include <math.h>
+
+static const float TWO_PI_F = 6.28318530718f;
+
+MotorPlant::MotorPlant(const MotorParams& p) : m_p(p) {
+    reset();
+}
+
+void MotorPlant::reset() {
+    m_current = 0.0f;
+    m_omega = 0.0f;
+    m_wheelRev = 0.0;
+}
+
+void MotorPlant::step(float duty, float dt) {
+    duty = duty > 1.0f ? 1.0f : (duty < -1.0f ? -1.0f : duty);
+    float mag = fabsf(duty);
+    bool driven = mag >= m_p.minDuty;
+
+    // electrical: semi-implicit in R so the 1 ms pole stays stable at any dt used here
+    float emf = m_p.ke * m_omega;
+    if (driven) {
+        float v = mag * m_p.supply - m_p.bridgeDrop;
+        if (v < 0.0f) v = 0.0f;
+        if (duty < 0.0f) v = -v;
+        m_current = (m_current * m_p.inductance + (v - emf) * dt) / (m_p.inductance + m_p.resistance * dt);
+    } else {
+        // bridge off: freewheel current is forced down through the supply and cannot reverse
+        float sign = m_current > 0.0f ? 1.0f : -1.0f;
+        float v = -sign * (m_p.supply + m_p.bridgeDrop);
+        float next = (m_current * m_p.inductance + (v - emf) * dt) / (m_p.inductance + m_p.resistance * dt);
+        m_current = (next * sign > 0.0f) ? next : 0.0f;
+    }
+
+    // mechanical
+    float j = m_p.inertia();
+    float kt = m_p.ke;
+    float drive = kt * m_current;
+    float load = m_p.loadTorque / (m_p.gearRatio * m_p.gearEfficiency);
+    float friction = m_p.coulomb + load;   // both oppose motion
+
+    if (m_omega == 0.0f) {
+        // stopped: stays put until the drive beats static friction plus load
+        float breakaway = m_p.coulomb * m_p.stictionRatio + load;
+        if (fabsf(drive) <= breakaway) return;
+        m_omega = (drive - (drive > 0.0f ? friction : -friction)) / j * dt;
+    } else {
+        float sign = m_omega > 0.0f ? 1.0f : -1.0f;
+        float accel = (drive - m_p.viscous * m_omega - sign * friction) / j;
+        float next = m_omega + accel * dt;
+        // friction can stop the rotor but never reverse it
+        m_omega = (next * sign < 0.0f) ? 0.0f : next;
+    }
+    m_wheelRev += (double)m_omega / TWO_PI_F / m_p.gearRatio * dt;
+}
+
+float MotorPlant::wheelRpm() const {
+    return m_omega / TWO_PI_F * 60.0f / m_p.gearRatio;
+}
+
+EncoderSim::EncoderSim(double countsPerRev) : m_countsPerRev(countsPerRev), m_count(0), m_edges(0) {}
+
+void EncoderSim::reset(double wheelRev) {
+    m_count = (int64_t)floor(wheelRev * m_countsPerRev);
+    m_edges = 0;
+}
+
+void EncoderSim::update(double wheelRev) {
+    int64_t now = (int64_t)floor(wheelRev * m_countsPerRev);
+    int64_t d = now - m_count;
+    m_edges += (uint64_t)(d < 0 ? -d : d);
+    m_count = now;
+}
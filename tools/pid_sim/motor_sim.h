@@ -0,0 +1,83 @@
+/*
+ * JGA25-370 gear motor + H-bridge + quadrature encoder plant for host-side
+ * PID regression (see pid_regress.cpp).
+ *
+ * Motor side (rotor speed w, armature current i):
+ *   L di/dt = V - R i - Ke w
+ *   J dw/dt = Kt i - b w - Tc sign(w) - Tload / (N eta)
+ * with static friction Ts holding the rotor until the drive torque exceeds it.
+ *
+ * The bridge is the EN-PWM / IN1-IN2 driver of gagac-2: PWM is modelled by its
+ * average voltage (700 Hz is slower than L/R, so the ripple is ignored), minus
+ * a fixed drop, and nothing below a minimum duty. With EN low the bridge is
+ * off: current only freewheels through the diodes, so it decays to zero but
+ * never reverses (the motor coasts, it is not braked).
+ *
+ * The default parameters are fitted so that the steady-state speed follows the
+ * firmware's feedforward line (PWM = 11 * RPM + 150 on the car, battery at
+ * 12 V), not the no-load datasheet figure.
+ */
+
+#ifndef MOTOR_SIM_H
+#define MOTOR_SIM_H
+
+#include <stdint.h>
+
+struct MotorParams {
+    float resistance = 8.0f;        // R, ohm
+    float inductance = 0.008f;      // L, H  (electrical time constant L/R = 1 ms)
+    float ke = 0.0263f;             // back EMF, V s/rad (motor side); Kt = Ke
+    float mechTau = 0.030f;         // J R / (Kt Ke), s; J is derived from it
+    float viscous = 2.0e-6f;        // b, N m s/rad
+    float coulomb = 0.0016f;        // Tc, N m (motor side, gearbox friction)
+    float stictionRatio = 1.3f;     // Ts = ratio * Tc while the rotor is stopped
+    float gearRatio = 46.8f;        // N
+    float gearEfficiency = 0.8f;    // eta, applied to the load torque
+    float loadTorque = 0.06f;       // Tload, N m at the wheel (rolling resistance)
+    float bridgeDrop = 0.8f;        // V lost in the H-bridge
+    float minDuty = 0.02f;          // below this the bridge does not conduct
+    float supply = 12.0f;           // battery, V
+
+    float inertia() const { return mechTau * ke * ke / resistance; }
+};
+
+class MotorPlant {
+private:
+    MotorParams m_p;
+    float m_current;     // A
+    float m_omega;       // rotor rad/s
+    double m_wheelRev;   // output shaft position, revolutions
+
+public:
+    explicit MotorPlant(const MotorParams& p = MotorParams());
+
+    void reset();
+    // advance dt seconds with a signed PWM duty in [-1, 1]
+    void step(float duty, float dt);
+
+    float current() const { return m_current; }
+    float wheelRpm() const;
+    double wheelRev() const { return m_wheelRev; }
+    const MotorParams& params() const { return m_p; }
+};
+
+// Edge generator: turns the output shaft position into the signed count the
+// firmware's encoder ISR accumulates, countsPerRev edges per wheel revolution
+class EncoderSim {
+private:
+    double m_countsPerRev;
+    int64_t m_count;
+    uint64_t m_edges;
+
+public:
+    explicit EncoderSim(double countsPerRev);
+
+    void reset(double wheelRev);
+    // emit every edge crossed since the last update
+    void update(double wheelRev);
+
+    long count() const { return (long)m_count; }
+    uint64_t edges() const { return m_edges; }
+};
+
+#endif // MOTOR_SIM_H
@@ -0,0 +1,395 @@
+/*
+ * Step/ramp regression for the wheel speed controller (gagac-2/motor_pid.cpp)
+ * against the JGA25-370 plant in motor_sim.h.
+ *
+ * Each scenario replays the firmware's timing: the plant runs at 20 kHz, the
+ * encoder edge generator feeds a count that is turned into RPM every
+ * SPEED_CALC_PERIOD exactly like calculateSpeed(), and motorPidStep() runs
+ * every CONTROL_PERIOD_MS with that (stale, quantised) speed. The controller
+ * first settles at the start speed, then the target steps or ramps to the end
+ * speed and the true wheel speed is scored:
+ *
+ *   rise       10 % -> 90 % of the change (ms), "-" if 90 % is never reached
+ *   overshoot  past the end speed, % of the change
+ *   settle     last time outside +-5 % of the change (at least +-SETTLE_FLOOR_RPM), ms
+ *   sse        |mean error| over the last 500 ms, RPM
+ *   rms        RMS tracking error while a ramp is running, RPM (only where
+ *              |target| >= MIN_TRACK_RPM: inside the dead zone speed cannot be held;
+ *              a ramp through zero is only scored on the side it starts from)
+ *
+ * Targets stay inside the envelope the wheel can actually hold over the whole
+ * load / battery range: the minimum PWM (deadZonePWM 400) already runs the
+ * wheel at ~23 RPM, and at 11.1 V with 1.5x load the bridge saturates near
+ * 68 RPM, so non-zero targets are 25..60 RPM in either direction.
+ *
+ * The summary groups scenarios by kind and prints median / p95 / max. The
+ * --req-* options are per-scenario requirements: every step must settle within
+ * --req-settle ms, overshoot by no more than --req-overshoot % of the change
+ * (or OVERSHOOT_FLOOR_RPM, whichever is larger: a few RPM is one or two
+ * encoder counts per speed window), end within --req-sse RPM, and every ramp
+ * must track within --req-ramp-rms RPM on top of the lag the speed window
+ * itself adds (slope x SPEED_CALC_PERIOD / 2). Any violation fails the run (exit 1)
+ * and is listed; `make check` applies the requirements below. --csv writes one
+ * row per scenario for plotting, --trace prints one scenario tick by tick.
+ *
+ * Usage:
+ *   make check                                  # current firmware gains vs the requirements
+ *   ./pid_regress --kp 1 --ki 15 --label kp1    # another controller build
+ *   ./pid_regress --quick --csv runs.csv
+ *   ./pid_regress --trace 60,25,0,1.5,12.6      # from,to[,ramp_ms,load,supply]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "motor_pid.h"
+#include "motor_sim.h"
+
+// mirror gagac-2.ino
+static const int PWM_MAX = 1023;
+static const int CONTROL_PERIOD_MS = 20;
+static const int SPEED_CALC_PERIOD = 100;
+static const double PULSES_PER_REV = 11 * 46.8 * 2;
+
+static const int SIM_STEPS_PER_MS = 20;        // 50 us plant step
+static const int PREROLL_MS = 1500;            // settle at the start speed
+static const int STEP_WINDOW_MS = 2000;
+static const int RAMP_TAIL_MS = 1500;          // after the ramp ends
+static const int SSE_WINDOW_MS = 500;
+static const float MIN_TRACK_RPM = 25.0f;      // smallest non-zero target (see above)
+static const float SETTLE_FLOOR_RPM = 2.0f;
+static const float OVERSHOOT_FLOOR_RPM = 4.0f;
+
+enum Kind { STEP_UP = 0, STEP_DOWN, REVERSE, TO_ZERO, RAMP, KIND_COUNT };
+static const char* const KIND_NAMES[KIND_COUNT] = { "step up", "step down", "reverse", "to zero", "ramp" };
+
+struct Scenario {
+    Kind kind;
+    float from, to;     // RPM
+    int rampMs;         // 0 = step
+    float loadScale;
+    float supply;
+};
+
+struct Result {
+    float riseMs;       // NAN = never reached 90 %
+    float overshootPct;
+    float overshootRpm;
+    float settleMs;
+    float sseRpm;
+    float rmsRpm;       // ramps only
+    float satPct;       // control ticks at +-PWM_MAX
+};
+
+struct Options {
+    MotorPidConfig pid;
+    MotorParams plant;
+    double cpr = PULSES_PER_REV;
+    bool quick = false;
+    const char* csv = nullptr;
+    const char* label = "firmware";
+    bool trace = false;
+    Scenario traceScenario = { STEP_UP, 0, 0, 0, 1.0f, 12.0f };
+    float reqSettle = NAN, reqOvershoot = NAN, reqSse = NAN, reqRampRms = NAN;
+};
+
+static Kind classify(float from, float to) {
+    if (to == 0.0f) return TO_ZERO;
+    if (from * to < 0.0f) return REVERSE;
+    return fabsf(to) > fabsf(from) ? STEP_UP : STEP_DOWN;
+}
+
+static Result runScenario(const Scenario& s, const Options& o, FILE* trace = nullptr) {
+    MotorParams mp = o.plant;
+    mp.loadTorque *= s.loadScale;
+    mp.supply = s.supply;
+    MotorPlant plant(mp);
+    EncoderSim enc(o.cpr);
+    MotorPidState st;
+    memset(&st, 0, sizeof(st));
+    motorPidReset(st);
+    enc.reset(plant.wheelRev());
+
+    long lastCount = 0;
+    int lastCalcMs = 0;
+    float measured = 0.0f;
+    float duty = 0.0f;
+
+    int windowMs = s.rampMs ? s.rampMs + RAMP_TAIL_MS : STEP_WINDOW_MS;
+    int totalMs = PREROLL_MS + windowMs;
+    std::vector<float> rpm(windowMs), target(windowMs);
+    int ticks = 0, satTicks = 0;
+
+    for (int ms = 0; ms < totalMs; ms++) {
+        int t = ms - PREROLL_MS;
+        float tgt = s.from;
+        if (t >= 0) {
+            tgt = s.rampMs && t < s.rampMs ? s.from + (s.to - s.from) * (float)t / s.rampMs : s.to;
+        }
+
+        if (ms % CONTROL_PERIOD_MS == 0) {
+            // calculateSpeed(): counts over at least SPEED_CALC_PERIOD
+            if (ms - lastCalcMs >= SPEED_CALC_PERIOD) {
+                measured = (float)(enc.count() - lastCount) / (float)o.cpr * 60000.0f / (float)(ms - lastCalcMs);
+                lastCount = enc.count();
+                lastCalcMs = ms;
+            }
+            int pwm = motorPidStep(st, o.pid, tgt, measured);
+            pwm = std::max(-PWM_MAX, std::min(PWM_MAX, pwm));
+            duty = (float)pwm / PWM_MAX;
+            if (trace) {
+                fprintf(trace, "%d,%.1f,%.2f,%.2f,%d,%.1f\n", t, tgt, measured, plant.wheelRpm(), pwm,
+                        st.ki * st.integral);
+            }
+            if (t >= 0) {
+                ticks++;
+                if (abs(pwm) >= PWM_MAX) satTicks++;
+            }
+        }
+
+        for (int k = 0; k < SIM_STEPS_PER_MS; k++) {
+            plant.step(duty, 0.001f / SIM_STEPS_PER_MS);
+            enc.update(plant.wheelRev());
+        }
+        if (t >= 0) {
+            rpm[t] = plant.wheelRpm();
+            target[t] = tgt;
+        }
+    }
+
+    Result r;
+    float delta = s.to - s.from;
+    float t10 = NAN, t90 = NAN, peak = 0.0f;
+    for (int t = 0; t < windowMs; t++) {
+        float p = (rpm[t] - s.from) / delta;
+        if (std::isnan(t10) && p >= 0.1f) t10 = (float)t;
+        if (std::isnan(t90) && p >= 0.9f) t90 = (float)t;
+        if (t >= s.rampMs) peak = std::max(peak, p);
+    }
+    r.riseMs = std::isnan(t90) ? NAN : t90 - (std::isnan(t10) ? 0.0f : t10);
+    r.overshootPct = std::max(0.0f, peak - 1.0f) * 100.0f;
+    r.overshootRpm = r.overshootPct / 100.0f * fabsf(delta);
+
+    float band = std::max(SETTLE_FLOOR_RPM, 0.05f * fabsf(delta));
+    r.settleMs = 0.0f;
+    for (int t = windowMs - 1; t >= 0; t--) {
+        if (fabsf(rpm[t] - s.to) > band) {
+            r.settleMs = (float)(t + 1);
+            break;
+        }
+    }
+
+    double sum = 0.0;
+    for (int t = windowMs - SSE_WINDOW_MS; t < windowMs; t++) sum += rpm[t] - s.to;
+    r.sseRpm = (float)fabs(sum / SSE_WINDOW_MS);
+
+    double sq = 0.0;
+    int n = 0;
+    for (int t = 0; t < s.rampMs; t++) {
+        if (fabsf(target[t]) < MIN_TRACK_RPM) continue;
+        if (s.from * s.to < 0.0f && target[t] * s.from < 0.0f) break;   // past zero: see above
+        sq += (double)(rpm[t] - target[t]) * (rpm[t] - target[t]);
+        n++;
+    }
+    r.rmsRpm = n ? (float)sqrt(sq / n) : NAN;
+    r.satPct = ticks ? 100.0f * satTicks / ticks : 0.0f;
+    return r;
+}
+
+static std::vector<Scenario> buildScenarios(bool quick) {
+    std::vector<float> levels = quick ? std::vector<float>{ -60, -40, 0, 25, 40, 60 }
+                                      : std::vector<float>{ -60, -50, -40, -25, 0, 25, 40, 50, 60 };
+    std::vector<float> loads = quick ? std::vector<float>{ 1.0f } : std::vector<float>{ 0.5f, 1.0f, 1.5f };
+    std::vector<float> supplies = quick ? std::vector<float>{ 12.0f } : std::vector<float>{ 11.1f, 12.0f, 12.6f };
+    std::vector<int> ramps = quick ? std::vector<int>{ 1000 } : std::vector<int>{ 500, 1000, 2000 };
+
+    std::vector<Scenario> out;
+    for (float from : levels) {
+        for (float to : levels) {
+            if (from == to) continue;
+            for (float load : loads) {
+                for (float v : supplies) out.push_back(Scenario{ classify(from, to), from, to, 0, load, v });
+                // ramps do not start or end at rest (the dead zone makes those a step)
+                if (from == 0.0f || to == 0.0f) continue;
+                for (int ms : ramps) out.push_back(Scenario{ RAMP, from, to, ms, load, 12.0f });
+            }
+        }
+    }
+    return out;
+}
+
+static float percentile(std::vector<float> v, float p) {
+    v.erase(std::remove_if(v.begin(), v.end(), [](float x) { return std::isnan(x); }), v.end());
+    if (v.empty()) return NAN;
+    std::sort(v.begin(), v.end());
+    size_t k = std::min(v.size() - 1, (size_t)lround(p * (v.size() - 1)));
+    return v[k];
+}
+
+static void printStat(const char* name, const std::vector<float>& v, const char* unit) {
+    printf("  %-10s median %7.1f  p95 %7.1f  max %7.1f %s\n", name, percentile(v, 0.5f), percentile(v, 0.95f),
+           percentile(v, 1.0f), unit);
+}
+
+static bool parseArgs(int argc, char** argv, Options& o) {
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        bool hasValue = i + 1 < argc;
+        auto value = [&]() { return (float)atof(argv[++i]); };
+        if (!strcmp(a, "--quick")) o.quick = true;
+        else if (!strcmp(a, "--no-ff")) o.pid.useFeedforward = false;
+        else if (!hasValue) { fprintf(stderr, "missing value for %s\n", a); return false; }
+        else if (!strcmp(a, "--kp")) o.pid.kpBase = value();
+        else if (!strcmp(a, "--ki")) o.pid.kiBase = value();
+        else if (!strcmp(a, "--kd")) o.pid.kdBase = value();
+        else if (!strcmp(a, "--ffa")) o.pid.ffA = value();
+        else if (!strcmp(a, "--ffb")) o.pid.ffB = value();
+        else if (!strcmp(a, "--deadzone")) o.pid.deadZonePWM = (int)value();
+        else if (!strcmp(a, "--load")) o.plant.loadTorque = value();
+        else if (!strcmp(a, "--tau-m")) o.plant.mechTau = value();
+        else if (!strcmp(a, "--cpr")) o.cpr = value();
+        else if (!strcmp(a, "--req-settle")) o.reqSettle = value();
+        else if (!strcmp(a, "--req-overshoot")) o.reqOvershoot = value();
+        else if (!strcmp(a, "--req-sse")) o.reqSse = value();
+        else if (!strcmp(a, "--req-ramp-rms")) o.reqRampRms = value();
+        else if (!strcmp(a, "--csv")) o.csv = argv[++i];
+        else if (!strcmp(a, "--label")) o.label = argv[++i];
+        else if (!strcmp(a, "--trace")) {
+            Scenario& t = o.traceScenario;
+            if (sscanf(argv[++i], "%f,%f,%d,%f,%f", &t.from, &t.to, &t.rampMs, &t.loadScale, &t.supply) < 2) {
+                fprintf(stderr, "--trace from,to[,ramp_ms,load,supply]\n");
+                return false;
+            }
+            t.kind = t.rampMs ? RAMP : classify(t.from, t.to);
+            o.trace = true;
+        }
+        else { fprintf(stderr, "unknown option %s\n", a); return false; }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options o;
+    // firmware defaults (gagac-2.ino)
+    o.pid.kpBase = 0.25f;
+    o.pid.kiBase = 21.0f;
+    o.pid.kdBase = 0.1f;
+    o.pid.ffA = 11.0f;
+    o.pid.ffB = 150.0f;
+    o.pid.useFeedforward = true;
+    o.pid.deadZonePWM = 400;
+    o.pid.pwmMax = PWM_MAX;
+    o.pid.dtSec = CONTROL_PERIOD_MS / 1000.0f;
+    if (!parseArgs(argc, argv, o)) {
+        fprintf(stderr, "see the comment at the top of pid_regress.cpp for options\n");
+        return 2;
+    }
+
+    if (o.trace) {
+        printf("t_ms,target,measured,rpm,pwm,i_term\n");
+        runScenario(o.traceScenario, o, stdout);
+        return 0;
+    }
+
+    std::vector<Scenario> scenarios = buildScenarios(o.quick);
+    std::vector<Result> results(scenarios.size());
+    auto t0 = std::chrono::steady_clock::now();
+    double simSec = 0.0;
+    for (size_t i = 0; i < scenarios.size(); i++) {
+        results[i] = runScenario(scenarios[i], o);
+        int windowMs = scenarios[i].rampMs ? scenarios[i].rampMs + RAMP_TAIL_MS : STEP_WINDOW_MS;
+        simSec += (PREROLL_MS + windowMs) / 1000.0;
+    }
+    double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    if (o.csv) {
+        FILE* f = fopen(o.csv, "w");
+        if (!f) {
+            perror(o.csv);
+            return 2;
+        }
+        fprintf(f, "kind,from,to,ramp_ms,load,supply,rise_ms,overshoot_pct,settle_ms,sse_rpm,rms_rpm,sat_pct\n");
+        for (size_t i = 0; i < scenarios.size(); i++) {
+            const Scenario& s = scenarios[i];
+            const Result& r = results[i];
+            fprintf(f, "%s,%.0f,%.0f,%d,%.2f,%.1f,%.1f,%.2f,%.1f,%.3f,%.3f,%.1f\n", KIND_NAMES[s.kind], s.from, s.to,
+                    s.rampMs, s.loadScale, s.supply, r.riseMs, r.overshootPct, r.settleMs, r.sseRpm, r.rmsRpm,
+                    r.satPct);
+        }
+        fclose(f);
+    }
+
+    printf("controller %s: Kp=%.2f Ki=%.2f Kd=%.2f ff=%s(A=%.1f B=%.0f) deadzone=%d\n", o.label, o.pid.kpBase,
+           o.pid.kiBase, o.pid.kdBase, o.pid.useFeedforward ? "on" : "off", o.pid.ffA, o.pid.ffB, o.pid.deadZonePWM);
+    printf("%zu scenarios, %.0f s simulated in %.2f s (%.0fx real time)\n\n", scenarios.size(), simSec, wallSec,
+           simSec / wallSec);
+
+    for (int k = 0; k < KIND_COUNT; k++) {
+        std::vector<float> rise, over, sse, settle, rms, sat;
+        int noRise = 0;
+        for (size_t i = 0; i < scenarios.size(); i++) {
+            if (scenarios[i].kind != k) continue;
+            const Result& r = results[i];
+            if (std::isnan(r.riseMs)) noRise++;
+            rise.push_back(r.riseMs);
+            over.push_back(r.overshootPct);
+            sse.push_back(r.sseRpm);
+            settle.push_back(r.settleMs);
+            rms.push_back(r.rmsRpm);
+            sat.push_back(r.satPct);
+        }
+        if (over.empty()) continue;
+        printf("%s (%zu, %d never reach 90 %%)\n", KIND_NAMES[k], over.size(), noRise);
+        printStat("rise", rise, "ms");
+        printStat("overshoot", over, "%");
+        printStat("settle", settle, "ms");
+        printStat("sse", sse, "RPM");
+        if (k == RAMP) printStat("ramp rms", rms, "RPM");
+        printStat("pwm sat", sat, "% of ticks");
+    }
+
+    // per-scenario requirements
+    const char* const REQ_NAMES[4] = { "settle", "overshoot", "sse", "ramp rms" };
+    const float reqs[4] = { o.reqSettle, o.reqOvershoot, o.reqSse, o.reqRampRms };
+    int violations[4] = { 0, 0, 0, 0 };
+    int listed = 0;
+    for (size_t i = 0; i < scenarios.size(); i++) {
+        const Scenario& s = scenarios[i];
+        const Result& r = results[i];
+        bool ramp = s.kind == RAMP;
+        float overshootLimit = std::max(reqs[1] / 100.0f * fabsf(s.to - s.from), OVERSHOOT_FLOOR_RPM);
+        // the speed window reports the average over the last SPEED_CALC_PERIOD, i.e. half a window late
+        float rampLimit = reqs[3] + (ramp ? fabsf(s.to - s.from) / s.rampMs * SPEED_CALC_PERIOD / 2.0f : 0.0f);
+        bool bad[4] = {
+            !ramp && r.settleMs > reqs[0],
+            !ramp && r.overshootRpm > overshootLimit,
+            r.sseRpm > reqs[2],
+            ramp && r.rmsRpm > rampLimit,   // NaN (never inside the envelope) compares false
+        };
+        for (int q = 0; q < 4; q++) {
+            if (std::isnan(reqs[q]) || !bad[q]) continue;
+            violations[q]++;
+            if (listed++ < 10) {
+                printf("  violates %-9s: %s %.0f -> %.0f ramp %d ms, load x%.1f, %.1f V (settle %.0f ms, overshoot %.1f %%, "
+                       "sse %.2f, rms %.2f)\n", REQ_NAMES[q], KIND_NAMES[s.kind], s.from, s.to, s.rampMs, s.loadScale,
+                       s.supply, r.settleMs, r.overshootPct, r.sseRpm, r.rmsRpm);
+            }
+        }
+    }
+    int failed = 0;
+    printf("\n");
+    for (int q = 0; q < 4; q++) {
+        if (std::isnan(reqs[q])) continue;
+        printf("%-9s <= %-6.1f %s: %d violations\n", REQ_NAMES[q], reqs[q], q == 0 ? "ms" : q == 1 ? "% " : "RPM",
+               violations[q]);
+        failed += violations[q];
+    }
+    printf("%s\n", failed ? "FAIL" : "ok");
+    return failed ? 1 : 0;
+}
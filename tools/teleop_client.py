@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Stream 50 Hz teleop packets to the servant over UDP and report jitter.
+
+Connect to the ESP32-MobileBase access point first. Every period the
+client sends one 12-byte packet (same layout as the web page's binary
+WebSocket frames, see gagac-2/teleop.h):
+
+    'T' | flags | seq u16 | linear i16 | angular i16 | sentMs u32   (little endian)
+
+linear/angular are in 0.1 % units. flags bit 0 is the deadman: without
+--enable the packets carry a zero setpoint and the car stays put, which is
+the safe way to measure the link on the bench. The board answers each
+packet it actually applied with an ack carrying the time the packet waited
+on the board (receipt -> target RPM set).
+
+Reported:
+  send jitter   how far this host's own send times drift from the period
+  rtt           send -> ack, min/median/p99/max
+  ack jitter    RFC 3550 interarrival jitter of the acks
+  hold          board-side receipt -> apply time
+  no ack        packets never acked (lost, or overwritten by a newer one
+                before the control loop picked it up)
+
+--gap-at/--gap-ms pause the stream once to check the deadman timeout: with
+--enable the wheels should stop teleopTimeoutMs after the pause starts
+(STATUS on the servant counts it under "timeouts").
+
+Usage:
+    python3 tools/teleop_client.py                              # 10 s, zero setpoint
+    python3 tools/teleop_client.py --enable --linear 20 --seconds 3
+    python3 tools/teleop_client.py --enable --angular 30 --gap-at 2 --gap-ms 600
+"""
+
+import argparse
+import socket
+import statistics
+import struct
+import threading
+import time
+
+PACKET = struct.Struct("<cBHhhI")
+ACK = struct.Struct("<cBHII")
+FLAG_ENABLE = 0x01
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return float("nan")
+    k = min(len(sorted_values) - 1, int(round(p * (len(sorted_values) - 1))))
+    return sorted_values[k]
+
+
+def receiver(sock, sent, acks, stop):
+    while not stop.is_set():
+        try:
+            data = sock.recv(64)
+        except socket.timeout:
+            continue
+        except OSError:
+            break
+        now = time.perf_counter()
+        if len(data) != ACK.size:
+            continue
+        magic, _flags, seq, _sent_ms, hold_us = ACK.unpack(data)
+        if magic != b"A" or seq not in sent:
+            continue
+        acks[seq] = (now, hold_us)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--host", default="192.168.4.1")
+    ap.add_argument("--port", type=int, default=4210)
+    ap.add_argument("--rate", type=float, default=50.0, help="packets per second")
+    ap.add_argument("--seconds", type=float, default=10.0)
+    ap.add_argument("--linear", type=float, default=0.0, help="percent, forward positive")
+    ap.add_argument("--angular", type=float, default=0.0, help="percent, right turn positive")
+    ap.add_argument("--enable", action="store_true", help="hold the deadman (the car moves)")
+    ap.add_argument("--gap-at", type=float, default=None, help="pause the stream after this many seconds")
+    ap.add_argument("--gap-ms", type=float, default=500.0)
+    args = ap.parse_args()
+
+    period = 1.0 / args.rate
+    flags = FLAG_ENABLE if args.enable else 0
+    lin = int(round(max(-100.0, min(100.0, args.linear)) * 10))
+    ang = int(round(max(-100.0, min(100.0, args.angular)) * 10))
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(0.2)
+    sock.connect((args.host, args.port))
+
+    sent = {}     # seq -> send time (one run stays well under 65536 packets at 50 Hz)
+    acks = {}     # seq -> (ack time, hold us)
+    stop = threading.Event()
+    rx = threading.Thread(target=receiver, args=(sock, sent, acks, stop), daemon=True)
+    rx.start()
+
+    print("streaming to %s:%d at %.0f Hz for %.0f s, %s linear=%.1f%% angular=%.1f%%" % (
+        args.host, args.port, args.rate, args.seconds,
+        "ENABLED" if args.enable else "deadman released,", lin / 10.0, ang / 10.0))
+    t0 = time.perf_counter()
+    seq = 0
+    next_t = t0
+    gap_done = args.gap_at is None
+    send_times = []
+    try:
+        while True:
+            now = time.perf_counter()
+            if now - t0 >= args.seconds:
+                break
+            if not gap_done and now - t0 >= args.gap_at:
+                gap_done = True
+                print("pausing %.0f ms ..." % args.gap_ms)
+                time.sleep(args.gap_ms / 1000.0)
+                next_t = time.perf_counter()
+                continue
+            if now < next_t:
+                time.sleep(next_t - now)
+                continue
+            seq = (seq + 1) & 0xFFFF
+            ts = time.perf_counter()
+            sent[seq] = ts
+            sock.send(PACKET.pack(b"T", flags, seq, lin, ang, int(ts * 1000) & 0xFFFFFFFF))
+            send_times.append(ts)
+            next_t += period
+            if next_t < ts - period:   # fell far behind (e.g. after the gap): do not burst
+                next_t = ts + period
+    finally:
+        # final packet: deadman released, zero setpoint
+        seq = (seq + 1) & 0xFFFF
+        sock.send(PACKET.pack(b"T", 0, seq, 0, 0, int(time.perf_counter() * 1000) & 0xFFFFFFFF))
+        time.sleep(0.3)
+        stop.set()
+        rx.join()
+        sock.close()
+
+    intervals = [(b - a) * 1000.0 for a, b in zip(send_times, send_times[1:])]
+    if args.gap_at is not None:
+        intervals = [d for d in intervals if d < args.gap_ms]
+    send_dev = [abs(d - period * 1000.0) for d in intervals]
+
+    rtts = sorted((acks[s][0] - sent[s]) * 1000.0 for s in acks)
+    holds = sorted(acks[s][1] / 1000.0 for s in acks)
+    jitter = 0.0
+    prev = None
+    for s in sorted(acks, key=lambda s: sent[s]):
+        transit = acks[s][0] - sent[s]
+        if prev is not None:
+            jitter += (abs(transit - prev) - jitter) / 16.0
+        prev = transit
+
+    n = len(send_times)
+    print()
+    print("sent     : %d packets" % n)
+    if send_dev:
+        print("send     : interval mean=%.2f ms, |dev| mean=%.2f max=%.2f ms" % (
+            statistics.mean(intervals), statistics.mean(send_dev), max(send_dev)))
+    if rtts:
+        print("rtt      : min=%.2f median=%.2f p99=%.2f max=%.2f ms" % (
+            rtts[0], percentile(rtts, 0.5), percentile(rtts, 0.99), rtts[-1]))
+        print("ack jitter (RFC 3550): %.2f ms" % (jitter * 1000.0))
+        print("hold     : median=%.2f p99=%.2f max=%.2f ms" % (
+            percentile(holds, 0.5), percentile(holds, 0.99), holds[-1]))
+    print("no ack   : %d (%.1f%%)" % (n - len(acks), 100.0 * (n - len(acks)) / max(n, 1)))
+
+
+if __name__ == "__main__":
+    main()